@@ -0,0 +1,93 @@
+#include "ai.h"
+#include <cstring>
+
+const char *DIFFICULTY_NAMES[AI_DIFFICULTY_COUNT] = {"easy", "normal", "hard"};
+
+//Difficulty from its name, or -1 if there is no such difficulty
+int parse_difficulty(const char *name)
+{
+    for (int i = 0; i < AI_DIFFICULTY_COUNT; i++)
+    {
+        if (strcmp(name, DIFFICULTY_NAMES[i]) == 0)
+            return i;
+    }
+    return -1;
+}
+
+PaddleAI::PaddleAI()
+{
+    init(SIDE_RIGHT, AI_NORMAL, 0);
+}
+
+//The seed only decides the AI's mistakes, the match seed is a good choice
+void PaddleAI::init(int paddleSide, int difficulty, unsigned int seed)
+{
+    if (difficulty < 0 || difficulty >= AI_DIFFICULTY_COUNT)
+        difficulty = AI_NORMAL;
+
+    side = paddleSide;
+    random.seed(seed, side == SIDE_LEFT ? STREAM_AI_LEFT : STREAM_AI_RIGHT);
+    set_skill(AI_REACTION_MS[difficulty], AI_ERROR[difficulty]);
+    towards = false;
+    waitSteps = 0;
+    target = (SCREEN_HEIGHT - PADDLE_HEIGHT_DEF) / 2.0;
+}
+
+void PaddleAI::set_skill(int reactionMs, double errorPixels)
+{
+    reactionSteps = reactionMs * SIM_HZ / 1000;
+    error = errorPixels;
+}
+
+//Where to put the paddle's top edge, decided once per change of direction
+void PaddleAI::choose_target(MatchState *match)
+{
+    Paddle &paddle = side == SIDE_LEFT ? match->leftPaddle : match->rightPaddle;
+    double height = paddle.get_position()->h;
+
+    //ball going away, drift back to the middle
+    if (!towards)
+    {
+        target = (SCREEN_HEIGHT - height) / 2;
+        return;
+    }
+
+    Rect *pos = match->theBall.get_position();
+    double vx, vy;
+    match->theBall.get_velocity(&vx, &vy);
+
+    double face = side == SIDE_LEFT ? LEFT_FACE : RIGHT_FACE;
+    double t = (face - pos->x) / vx;
+    double interceptY = fold_walls(pos->y + vy * t, BALL_SPAN, &vy);
+
+    target = interceptY + BALL_WIDTH / 2.0 - height / 2 + (random.next_unit() * 2 - 1) * error;
+}
+
+//Paddle input for this step
+int PaddleAI::think(MatchState *match)
+{
+    Ball &ball = match->theBall;
+    Paddle &paddle = side == SIDE_LEFT ? match->leftPaddle : match->rightPaddle;
+
+    double vx, vy;
+    ball.get_velocity(&vx, &vy);
+    bool inPlay = !match->justStarted && !ball.is_delayed() && !ball.is_scored();
+    bool nowTowards = inPlay && (side == SIDE_LEFT ? vx < 0 : vx > 0);
+
+    //something changed, react to it once the reaction time is up
+    if (nowTowards != towards)
+    {
+        towards = nowTowards;
+        waitSteps = reactionSteps + 1;
+    }
+    if (waitSteps > 0 && --waitSteps == 0)
+        choose_target(match);
+
+    double offset = target - paddle.get_position()->y;
+    if (offset < -AI_DEAD_ZONE)
+        return INPUT_UP;
+    else if (offset > AI_DEAD_ZONE)
+        return INPUT_DOWN;
+
+    return INPUT_NONE;
+}
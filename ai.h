@@ -0,0 +1,49 @@
+#ifndef AI_H
+#define AI_H
+
+#include "sim.h"
+
+//CPU opponent difficulty
+enum AIDifficulties
+{
+    AI_EASY,
+    AI_NORMAL,
+    AI_HARD,
+    AI_DIFFICULTY_COUNT,
+};
+
+//time the AI takes to notice the ball turning, in milliseconds, and the
+//most it misjudges the intercept by, in pixels, for each difficulty
+const int AI_REACTION_MS[AI_DIFFICULTY_COUNT] = {250, 120, 40};
+const double AI_ERROR[AI_DIFFICULTY_COUNT] = {45, 20, 6};
+
+//how close to its target the paddle has to be to stop
+const double AI_DEAD_ZONE = 2;
+
+int parse_difficulty(const char *name);
+
+//CPU paddle - whenever the ball turns towards it, waits out its reaction
+//time and then predicts where the ball will reach its face, folding the
+//path off the walls, plus some random error. Between decisions it just
+//steers towards the prediction, so every step costs the same and nothing
+//is allocated. Returns ordinary paddle inputs, so replays record it like a player.
+class PaddleAI
+{
+    private:
+        int side;
+        int reactionSteps;
+        double error;
+        SplitMix random;
+        bool towards;
+        int waitSteps;
+        double target;
+
+        void choose_target(MatchState *match);
+    public:
+        PaddleAI();
+        void init(int paddleSide, int difficulty, unsigned int seed);
+        void set_skill(int reactionMs, double errorPixels);
+        int think(MatchState *match);
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef BAKEDFONT_H
+#define BAKEDFONT_H
+
+//Glyphs baked at build time by fontbake (fontbake.cpp) into fontdata.h, so
+//the game can build its glyph atlases without opening the font file. No
+//SDL in here, the generator doesn't link it.
+
+//glyphs kept in an atlas - printable ASCII
+const int FIRST_GLYPH = 32;
+const int LAST_GLYPH = 126;
+const int GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+const int ATLAS_COLUMNS = 16;
+
+//One glyph - its coverage bitmap sits at (left, top) in a cell width by
+//height pixels, drawn with the pen at the cell's left edge
+struct BakedGlyph
+{
+    short left, top;
+    short w, h;
+    short width;
+    short advance;
+    int runs; //where its bitmap starts in the font's runs
+};
+
+//One font at one size. Bitmaps are run length coded as (count, coverage)
+//byte pairs, row by row, each glyph's runs following the last one's.
+struct BakedFont
+{
+    int size;
+    int height;
+    BakedGlyph glyphs[GLYPH_COUNT];
+    const unsigned char *runs;
+};
+
+//Whether one of the count fonts is baked at size, so the game can check
+//when it is built that fontdata.h has the sizes it draws with
+constexpr bool has_baked_size(const BakedFont *const *fonts, int count, int size)
+{
+    return count > 0 && (fonts[0]->size == size || has_baked_size(fonts + 1, count - 1, size));
+}
+
+#endif
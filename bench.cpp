@@ -0,0 +1,362 @@
+#include "pong.h"
+#include "raster.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+//Benchmarks for the physics, collision and rendering paths
+//usage: bench [-json]
+//Rendering runs against SDL's dummy video driver, so no window is needed.
+//Every benchmark is a steady state loop - one that allocates after its
+//warm-up run fails, and bench exits with 1.
+
+//iterations per benchmark
+const long long PHYSICS_OPS = 10000000;
+const long long SCORE_OPS = 200000;
+const long long RENDER_FRAMES = 5000;
+const long long SWARM_OPS = 20000;
+const long long RASTER_FRAMES = 200000;
+
+//balls in the multi-ball swarm benchmark
+const int SWARM_BALLS = 1024;
+
+//positions cycled through by the collision benchmark
+const int COLLISION_CASES = 1024;
+
+//Allocation counting - every operator new in the process goes through here,
+//and with glibc every malloc as well, so SDL's surfaces count too.
+//Elsewhere only C++ allocations are counted.
+std::atomic<long long> allocations(0);
+
+#ifdef __GLIBC__
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *p, size_t size);
+
+extern "C" void *malloc(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *p, size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(p, size);
+}
+#endif
+
+void *operator new(size_t size)
+{
+#ifndef __GLIBC__
+    allocations.fetch_add(1, std::memory_order_relaxed);
+#endif
+    void *p = malloc(size ? size : 1);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+struct BenchResult
+{
+    const char *name;
+    long long ops;
+    double nsPerOp;
+    double allocsPerOp;
+};
+
+typedef void (*BenchFunction)(long long ops);
+
+//stops the compiler from throwing the benchmarked work away
+volatile long long sink;
+
+int collisionX[COLLISION_CASES], collisionY[COLLISION_CASES];
+Game *game;
+
+BenchResult run_bench(const char *name, BenchFunction function, long long ops)
+{
+    //warm up first so one-off allocations don't count
+    function(ops / 100 + 1);
+
+    long long allocsBefore = allocations.load();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    function(ops);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    long long allocsAfter = allocations.load();
+
+    BenchResult result;
+    result.name = name;
+    result.ops = ops;
+    result.nsPerOp = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / double(ops);
+    result.allocsPerOp = (allocsAfter - allocsBefore) / double(ops);
+    return result;
+}
+
+void bench_check_collision(long long ops)
+{
+    Rect pad = {30, 215, PADDLE_WIDTH, PADDLE_HEIGHT_DEF};
+    long long hits = 0;
+
+    for (long long i = 0; i < ops; i++)
+    {
+        int c = i & (COLLISION_CASES - 1);
+        if (check_collision(collisionX[c], collisionY[c], &pad))
+            hits++;
+    }
+    sink = hits;
+}
+
+void bench_paddle_move(long long ops)
+{
+    Paddle paddle;
+    Rect pos = {30, 215, PADDLE_WIDTH, PADDLE_HEIGHT_DEF};
+    paddle.init(pos);
+
+    for (long long i = 0; i < ops; i++)
+    {
+        //sweep up and down the whole screen
+        paddle.set_input((i / SIM_HZ) % 2 == 0 ? INPUT_UP : INPUT_DOWN);
+        paddle.move();
+    }
+    sink = paddle.get_position()->y;
+}
+
+//on either physics backend, whichever the build plays on
+template <class Number>
+void bench_ball_move(long long ops)
+{
+    //full height paddles, so the ball never scores
+    Rect leftPad = {0, 0, 30, SCREEN_HEIGHT};
+    Rect rightPad = {SCREEN_WIDTH - 30, 0, 30, SCREEN_HEIGHT};
+    BasicBall<Number> ball;
+    SplitMix random;
+    ball.stop_delay();
+
+    for (long long i = 0; i < ops; i++)
+    {
+        //every hit speeds the ball up, start over before it gets silly
+        if ((i & 4095) == 0)
+        {
+            ball.reset(&random);
+            ball.stop_delay();
+        }
+        ball.move(&leftPad, &rightPad);
+    }
+    sink = ball.get_position()->x;
+}
+
+void bench_match_step(long long ops)
+{
+    MatchState match;
+    match_init(&match, 1);
+
+    for (long long i = 0; i < ops; i++)
+    {
+        if (match.endGame)
+            match_init(&match, i);
+        match_step(&match, (i / SIM_HZ) % 3, (i / SIM_HZ / 2) % 3);
+    }
+    sink = match.leftScore;
+}
+
+//AI against AI, the think calls are most of the cost on top of match_step
+void bench_ai_think(long long ops)
+{
+    MatchState match;
+    PaddleAI leftAI, rightAI;
+    match_init(&match, 1);
+    leftAI.init(SIDE_LEFT, AI_HARD, 1);
+    rightAI.init(SIDE_RIGHT, AI_EASY, 1);
+
+    for (long long i = 0; i < ops; i++)
+    {
+        if (match.endGame)
+        {
+            match_init(&match, i);
+            leftAI.init(SIDE_LEFT, AI_HARD, i);
+            rightAI.init(SIDE_RIGHT, AI_EASY, i);
+        }
+        match_step(&match, leftAI.think(&match), rightAI.think(&match));
+    }
+    sink = match.leftScore;
+}
+
+//Offscreen frames for pixel observations, grey at a quarter of the screen size
+void bench_raster(long long ops)
+{
+    static unsigned char frame[SCREEN_WIDTH * SCREEN_HEIGHT];
+    MatchState match;
+    Rasterizer raster;
+    match_init(&match, 1);
+    raster.init(4, RASTER_GRAY8);
+
+    for (long long i = 0; i < ops; i++)
+    {
+        match_step(&match, INPUT_NONE, INPUT_NONE);
+        raster.render(&match, frame);
+    }
+    sink = frame[0];
+}
+
+//One step of a multi-ball swarm, so ns/op divided by SWARM_BALLS is per ball
+void bench_swarm_step(long long ops)
+{
+    static BallSwarm swarm;
+    Rect leftPad = {30, 215, PADDLE_WIDTH, PADDLE_HEIGHT_DEF};
+    Rect rightPad = {SCREEN_WIDTH - 30 - PADDLE_WIDTH, 215, PADDLE_WIDTH, PADDLE_HEIGHT_DEF};
+    int leftPoints = 0, rightPoints = 0;
+    swarm.init(SWARM_BALLS, 1);
+
+    for (long long i = 0; i < ops; i++)
+        swarm.step(&leftPad, &rightPad, &leftPoints, &rightPoints);
+    sink = leftPoints + rightPoints;
+}
+
+void bench_update_scores(long long ops)
+{
+    for (long long i = 0; i < ops; i++)
+        game->update_scores(3, 4);
+}
+
+void bench_update_scores_changing(long long ops)
+{
+    for (long long i = 0; i < ops; i++)
+        game->update_scores(i % 10, (i / 10) % 10);
+}
+
+//One frame of play - four physics steps (60 fps) and a render
+void bench_render(long long ops)
+{
+    for (long long i = 0; i < ops; i++)
+    {
+        for (int s = 0; s < SIM_HZ / 60; s++)
+            game->step();
+        game->render();
+        present();
+    }
+}
+
+void bench_render_dirty(long long ops)
+{
+    dirtyRendering = true;
+    bench_render(ops);
+}
+
+void bench_render_full(long long ops)
+{
+    dirtyRendering = false;
+    bench_render(ops);
+}
+
+//Anything allocated after warm-up is a regression, returns how many benchmarks did
+int check_allocations(BenchResult *results, int count)
+{
+    int failures = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (results[i].allocsPerOp > 0)
+        {
+            std::cerr << "FAIL " << results[i].name << ": " << results[i].allocsPerOp;
+            std::cerr << " allocs/op after warm-up" << std::endl;
+            failures++;
+        }
+    }
+    return failures;
+}
+
+void print_results(BenchResult *results, int count, bool json)
+{
+    if (json)
+    {
+        std::cout << "[" << std::endl;
+        for (int i = 0; i < count; i++)
+        {
+            std::cout << "  {\"name\": \"" << results[i].name << "\", \"ops\": " << results[i].ops;
+            std::cout << ", \"ns_per_op\": " << results[i].nsPerOp;
+            std::cout << ", \"ops_per_sec\": " << 1e9 / results[i].nsPerOp;
+            std::cout << ", \"allocs_per_op\": " << results[i].allocsPerOp << "}";
+            if (i + 1 < count)
+                std::cout << ",";
+            std::cout << std::endl;
+        }
+        std::cout << "]" << std::endl;
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        std::cout << results[i].name << ": " << results[i].nsPerOp << " ns/op, ";
+        std::cout << 1e9 / results[i].nsPerOp << " ops/s, ";
+        std::cout << results[i].allocsPerOp << " allocs/op" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bool json = (argc > 1 && std::string(argv[1]) == "-json");
+
+    srand(1);
+    for (int i = 0; i < COLLISION_CASES; i++)
+    {
+        collisionX[i] = rand() % SCREEN_WIDTH;
+        collisionY[i] = rand() % SCREEN_HEIGHT;
+    }
+
+    BenchResult results[16];
+    int count = 0;
+
+    results[count++] = run_bench("check_collision", bench_check_collision, PHYSICS_OPS);
+    results[count++] = run_bench("Paddle::move", bench_paddle_move, PHYSICS_OPS);
+    results[count++] = run_bench("Ball::move fixed", bench_ball_move<Fixed>, PHYSICS_OPS);
+    results[count++] = run_bench("Ball::move double", bench_ball_move<double>, PHYSICS_OPS);
+    results[count++] = run_bench("match_step", bench_match_step, PHYSICS_OPS);
+    results[count++] = run_bench("match_step + 2 x PaddleAI::think", bench_ai_think, PHYSICS_OPS);
+    results[count++] = run_bench("BallSwarm::step 1024 balls", bench_swarm_step, SWARM_OPS);
+    results[count++] = run_bench("match_step + Rasterizer::render grey 1/4", bench_raster, RASTER_FRAMES);
+
+    //rendering needs SDL, but not a real display
+    SDL_putenv((char *)"SDL_VIDEODRIVER=dummy");
+    SDL_putenv((char *)"SDL_AUDIODRIVER=dummy");
+    if (!init() || !load_files())
+    {
+        std::cerr << "could not start SDL: " << SDL_GetError() << std::endl;
+        print_results(results, count, json);
+        return 1;
+    }
+
+    recordReplays = false;
+    game = new Game();
+    game->enter();
+
+    results[count++] = run_bench("Game::update_scores", bench_update_scores, SCORE_OPS);
+    results[count++] = run_bench("Game::update_scores changing", bench_update_scores_changing, SCORE_OPS / 10);
+    results[count++] = run_bench("Game::render dirty rects", bench_render_dirty, RENDER_FRAMES);
+    results[count++] = run_bench("Game::render full redraw", bench_render_full, RENDER_FRAMES);
+
+    //a redraw clipped to part of the screen must leave the rects it drew alone
+    bool clippingOk = game->check_clipped_redraw();
+    present();
+    if (!clippingOk)
+        std::cerr << "FAIL Game::redraw_region changed the divider, paddle or ball rects" << std::endl;
+
+    game->exit();
+    delete game;
+    print_results(results, count, json);
+
+    clean_up();
+    return (check_allocations(results, count) > 0 || !clippingOk) ? 1 : 0;
+}
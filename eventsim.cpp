@@ -0,0 +1,177 @@
+#define _USE_MATH_DEFINES
+#include "eventsim.h"
+#include <cmath>
+
+const double PADDLE_SPAN = SCREEN_HEIGHT - PADDLE_HEIGHT_DEF;
+
+//Default policy - centre the paddle on where the ball will arrive
+double intercept_policy(int side, double interceptY, double timeLeft, void *data)
+{
+    return interceptY + BALL_WIDTH / 2.0 - PADDLE_HEIGHT_DEF / 2.0;
+}
+
+EventMatch::EventMatch()
+{
+    for (int side = SIDE_LEFT; side <= SIDE_RIGHT; side++)
+    {
+        policies[side] = intercept_policy;
+        policyData[side] = NULL;
+    }
+    init(0);
+}
+
+void EventMatch::set_policy(int side, EventPolicy policy, void *data)
+{
+    policies[side] = policy;
+    policyData[side] = data;
+}
+
+//Same serve order as Ball::reset, so a seed serves the same way in both engines
+void EventMatch::serve()
+{
+    ballX = (SCREEN_WIDTH - BALL_WIDTH) / 2;
+    ballY = (SCREEN_HEIGHT - BALL_WIDTH) / 2;
+    vel = BALL_INIT_VEL;
+    right = random.next_bool();
+    vy = random.next_bool() ? -vel * M_SQRT1_2 : vel * M_SQRT1_2;
+    time += SERVE_DELAY / 1000.0;
+}
+
+//Ask the policy of the paddle the ball is heading for where to go
+void EventMatch::aim(int side)
+{
+    double face = right ? RIGHT_FACE : LEFT_FACE;
+    double timeLeft = fabs(face - ballX) / (vel * M_SQRT1_2);
+    double velocity = vy;
+    double interceptY = fold_walls(ballY + vy * timeLeft, BALL_SPAN, &velocity);
+    double target = policies[side](side, interceptY, timeLeft, policyData[side]);
+
+    if (target < 0)
+        target = 0;
+    else if (target > PADDLE_SPAN)
+        target = PADDLE_SPAN;
+
+    paddleStartY[side] = paddle_at(side, time);
+    paddleStartTime[side] = time;
+    paddleTarget[side] = target;
+}
+
+//One event - the ball reaches the next paddle face, then bounces or scores
+void EventMatch::fly()
+{
+    int side = right ? SIDE_RIGHT : SIDE_LEFT;
+    double face = right ? RIGHT_FACE : LEFT_FACE;
+    double vx = vel * M_SQRT1_2;
+    double t = fabs(face - ballX) / vx;
+
+    ballY = fold_walls(ballY + vy * t, BALL_SPAN, &vy);
+    ballX = face;
+    time += t;
+    events++;
+
+    double paddleY = paddle_at(side, time);
+    if (ballY < paddleY + PADDLE_HEIGHT_DEF && ballY + BALL_WIDTH > paddleY)
+    {
+        right = !right;
+        vel += BALL_SPEED_UP;
+        vy = vy < 0 ? -vel * M_SQRT1_2 : vel * M_SQRT1_2;
+        hits++;
+        aim(right ? SIDE_RIGHT : SIDE_LEFT);
+        return;
+    }
+
+    //missed - carry on off the screen, then the point goes to the other side
+    if (right)
+    {
+        time += (SCREEN_WIDTH - BALL_WIDTH - face) / vx;
+        leftScore++;
+    }
+    else
+    {
+        time += face / vx;
+        rightScore++;
+    }
+
+    if (leftScore >= SCORE_LIMIT || rightScore >= SCORE_LIMIT)
+    {
+        endGame = true;
+        return;
+    }
+
+    time += SCORED_DELAY / 1000.0;
+    serve();
+    aim(right ? SIDE_RIGHT : SIDE_LEFT);
+}
+
+void EventMatch::init(unsigned int seed)
+{
+    random.seed(seed, STREAM_SERVE);
+    leftScore = 0;
+    rightScore = 0;
+    endGame = false;
+    events = 0;
+    hits = 0;
+
+    for (int side = SIDE_LEFT; side <= SIDE_RIGHT; side++)
+    {
+        paddleStartY[side] = PADDLE_SPAN / 2;
+        paddleStartTime[side] = 0;
+        paddleTarget[side] = PADDLE_SPAN / 2;
+    }
+
+    time = START_DELAY / 1000.0;
+    serve();
+    aim(right ? SIDE_RIGHT : SIDE_LEFT);
+}
+
+//Play to SCORE_LIMIT (or give up after MAX_MATCH_EVENTS / MAX_MATCH_TIME)
+void EventMatch::play()
+{
+    while (!endGame && events < MAX_MATCH_EVENTS && time < MAX_MATCH_TIME)
+        fly();
+}
+
+//Where a paddle's top edge is at a given time, in closed form
+double EventMatch::paddle_at(int side, double when)
+{
+    double travel = PADDLE_VEL * (when - paddleStartTime[side]);
+    double distance = paddleTarget[side] - paddleStartY[side];
+
+    if (distance > travel)
+        distance = travel;
+    else if (distance < -travel)
+        distance = -travel;
+
+    return paddleStartY[side] + distance;
+}
+
+int EventMatch::get_left_score()
+{
+    return leftScore;
+}
+
+int EventMatch::get_right_score()
+{
+    return rightScore;
+}
+
+bool EventMatch::is_over()
+{
+    return endGame;
+}
+
+//Seconds of game time played
+double EventMatch::get_time()
+{
+    return time;
+}
+
+long long EventMatch::get_events()
+{
+    return events;
+}
+
+long long EventMatch::get_hits()
+{
+    return hits;
+}
@@ -0,0 +1,61 @@
+#ifndef EVENTSIM_H
+#define EVENTSIM_H
+
+#include "sim.h"
+
+//Event driven match - instead of stepping SIM_DT at a time, jumps straight
+//from one paddle face to the next. Wall bounces in between are folded into
+//the flight in closed form, so a whole rally costs one event per paddle hit.
+//Paddles move at PADDLE_VEL towards a target picked by a policy every time
+//the ball turns towards them, so their trajectories are known ahead too.
+
+//give up on a match after this many events or this much game time (seconds)
+const long long MAX_MATCH_EVENTS = 1000000;
+const double MAX_MATCH_TIME = 60 * 60;
+
+//Picks where a paddle's top edge should go, given the y the ball will have
+//when it reaches that paddle's face and the time left until it does
+typedef double (*EventPolicy)(int side, double interceptY, double timeLeft, void *data);
+
+double intercept_policy(int side, double interceptY, double timeLeft, void *data);
+
+class EventMatch
+{
+    private:
+        SplitMix random;
+        double ballX, ballY;
+        double vel;
+        double vy;
+        bool right;
+
+        //paddle tops: at startY at startTime, moving towards target at PADDLE_VEL
+        double paddleStartY[2];
+        double paddleStartTime[2];
+        double paddleTarget[2];
+        EventPolicy policies[2];
+        void *policyData[2];
+
+        double time;
+        int leftScore, rightScore;
+        bool endGame;
+        long long events;
+        long long hits;
+
+        void serve();
+        void aim(int side);
+        void fly();
+    public:
+        EventMatch();
+        void set_policy(int side, EventPolicy policy, void *data);
+        void init(unsigned int seed);
+        void play();
+        double paddle_at(int side, double when);
+        int get_left_score();
+        int get_right_score();
+        bool is_over();
+        double get_time();
+        long long get_events();
+        long long get_hits();
+};
+
+#endif
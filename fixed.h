@@ -0,0 +1,63 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+//16.16 fixed point number. Everything is integer arithmetic, so the same
+//inputs give the same bits on every compiler, optimisation level and CPU -
+//no x87 extended precision, no fused multiply-adds, no libm. Products and
+//quotients are worked out in 64 bits; products round down (this assumes
+//an arithmetic right shift, as every compiler we build with does) and
+//quotients round towards zero.
+const int FIXED_SHIFT = 16;
+const int FIXED_ONE = 1 << FIXED_SHIFT;
+
+class Fixed
+{
+    private:
+        int raw;
+    public:
+        Fixed() : raw(0) {}
+        Fixed(int value) : raw(value * FIXED_ONE) {}
+
+        static Fixed from_raw(int raw)
+        {
+            Fixed result;
+            result.raw = raw;
+            return result;
+        }
+
+        //num / den, without going through floating point
+        static Fixed ratio(long long num, long long den)
+        {
+            return from_raw(int(num * FIXED_ONE / den));
+        }
+
+        int get_raw() const { return raw; }
+
+        //rounds down
+        int to_int() const { return raw >> FIXED_SHIFT; }
+        double to_double() const { return raw / double(FIXED_ONE); }
+
+        Fixed operator-() const { return from_raw(-raw); }
+        Fixed &operator+=(Fixed other) { raw += other.raw; return *this; }
+        Fixed &operator-=(Fixed other) { raw -= other.raw; return *this; }
+
+        friend Fixed operator+(Fixed a, Fixed b) { return from_raw(a.raw + b.raw); }
+        friend Fixed operator-(Fixed a, Fixed b) { return from_raw(a.raw - b.raw); }
+        friend Fixed operator*(Fixed a, Fixed b)
+        {
+            return from_raw(int(((long long)a.raw * b.raw) >> FIXED_SHIFT));
+        }
+        friend Fixed operator/(Fixed a, Fixed b)
+        {
+            return from_raw(int((long long)a.raw * FIXED_ONE / b.raw));
+        }
+
+        friend bool operator==(Fixed a, Fixed b) { return a.raw == b.raw; }
+        friend bool operator!=(Fixed a, Fixed b) { return a.raw != b.raw; }
+        friend bool operator<(Fixed a, Fixed b) { return a.raw < b.raw; }
+        friend bool operator>(Fixed a, Fixed b) { return a.raw > b.raw; }
+        friend bool operator<=(Fixed a, Fixed b) { return a.raw <= b.raw; }
+        friend bool operator>=(Fixed a, Fixed b) { return a.raw >= b.raw; }
+};
+
+#endif
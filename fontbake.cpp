@@ -0,0 +1,169 @@
+#include "bakedfont.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+//Font baker - renders the printable ASCII glyphs of a font at each size
+//given into a header of constexpr run length coded bitmaps the game builds
+//its glyph atlases from. Uses FreeType directly, the same way SDL_ttf
+//lays glyphs out, so baked text matches text rendered from the font file.
+//usage: fontbake font.ttf output.h size [size ...]
+//Rerun it (FontBake target) whenever the font or the game's font sizes change:
+//fontbake Eurosti.TTF fontdata.h 48 24
+
+//longest run a (count, coverage) pair holds
+const int MAX_RUN = 255;
+
+//bytes of run data per line of the generated header
+const int RUNS_PER_LINE = 24;
+
+//FreeType 26.6 fixed point, rounded up the way SDL_ttf does
+int ft_ceil(long value)
+{
+    return ((value + 63) & -64) / 64;
+}
+
+//Append a glyph's coverage as (count, coverage) pairs, runs never cross a row
+void add_runs(std::vector<unsigned char> *runs, const unsigned char *pixels, int w, int h, int pitch)
+{
+    for (int row = 0; row < h; row++)
+    {
+        const unsigned char *line = pixels + row * pitch;
+        int col = 0;
+        while (col < w)
+        {
+            int length = 1;
+            while (col + length < w && length < MAX_RUN && line[col + length] == line[col])
+                length++;
+            runs->push_back((unsigned char)length);
+            runs->push_back(line[col]);
+            col += length;
+        }
+    }
+}
+
+bool bake_size(FT_Face face, int size, std::ofstream &out)
+{
+    //SDL_ttf sizes fonts in points at 72 dpi, so points are pixels
+    if (FT_Set_Char_Size(face, 0, size * 64, 0, 0) != 0)
+        return false;
+
+    FT_Fixed scale = face->size->metrics.y_scale;
+    int ascent = ft_ceil(FT_MulFix(face->ascender, scale));
+    int descent = ft_ceil(FT_MulFix(face->descender, scale));
+    int height = ascent - descent + 1;
+
+    BakedGlyph glyphs[GLYPH_COUNT];
+    std::vector<unsigned char> runs;
+
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        BakedGlyph &glyph = glyphs[i];
+        glyph.left = glyph.top = glyph.w = glyph.h = 0;
+        glyph.width = glyph.advance = 0;
+        glyph.runs = (int)runs.size();
+
+        FT_UInt index = FT_Get_Char_Index(face, FIRST_GLYPH + i);
+        if (FT_Load_Glyph(face, index, FT_LOAD_DEFAULT) != 0
+            || FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL) != 0)
+            continue;
+
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap *bitmap = &slot->bitmap;
+        glyph.advance = ft_ceil(slot->metrics.horiAdvance);
+
+        //the cell spans the pen's advance and the ink, whichever sticks out further
+        int minX = slot->bitmap_left < 0 ? slot->bitmap_left : 0;
+        int maxX = slot->bitmap_left + (int)bitmap->width;
+        if (maxX < glyph.advance)
+            maxX = glyph.advance;
+
+        //rows above or below the line height are cut off, as SDL_ttf does
+        int top = ascent - slot->bitmap_top;
+        int firstRow = top < 0 ? -top : 0;
+        int rows = (int)bitmap->rows - firstRow;
+        if (top + firstRow + rows > height)
+            rows = height - top - firstRow;
+        if (rows < 0)
+            rows = 0;
+
+        glyph.left = slot->bitmap_left - minX;
+        glyph.top = top + firstRow;
+        glyph.w = bitmap->width;
+        glyph.h = rows;
+        glyph.width = maxX - minX;
+        add_runs(&runs, bitmap->buffer + firstRow * bitmap->pitch, glyph.w, glyph.h, bitmap->pitch);
+    }
+
+    out << "constexpr unsigned char BAKED_RUNS_" << size << "[] =\n{";
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        if (i % RUNS_PER_LINE == 0)
+            out << "\n    ";
+        out << (int)runs[i] << ",";
+    }
+    out << "\n};\n\n";
+
+    out << "constexpr BakedFont BAKED_FONT_" << size << " =\n{\n";
+    out << "    " << size << ", " << height << ",\n    {\n";
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        BakedGlyph &glyph = glyphs[i];
+        out << "        {" << glyph.left << ", " << glyph.top << ", " << glyph.w << ", " << glyph.h << ", ";
+        out << glyph.width << ", " << glyph.advance << ", " << glyph.runs << "},\n";
+    }
+    out << "    },\n    BAKED_RUNS_" << size << "\n};\n\n";
+
+    printf("%d: %d px high, %d bytes of runs\n", size, height, (int)runs.size());
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 4)
+    {
+        fprintf(stderr, "usage: fontbake font.ttf output.h size [size ...]\n");
+        return 1;
+    }
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, argv[1], 0, &face) != 0)
+    {
+        fprintf(stderr, "could not open %s\n", argv[1]);
+        return 1;
+    }
+
+    std::ofstream out(argv[2]);
+    if (!out)
+    {
+        fprintf(stderr, "could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    out << "//Generated by fontbake from " << argv[1] << " - do not edit, rerun it instead\n";
+    out << "#ifndef FONTDATA_H\n#define FONTDATA_H\n\n#include \"bakedfont.h\"\n\n";
+
+    int sizes = argc - 3;
+    for (int i = 0; i < sizes; i++)
+    {
+        int size = atoi(argv[3 + i]);
+        if (size <= 0 || !bake_size(face, size, out))
+        {
+            fprintf(stderr, "could not bake size %s\n", argv[3 + i]);
+            return 1;
+        }
+    }
+
+    out << "constexpr const BakedFont *BAKED_FONTS[] =\n{\n";
+    for (int i = 0; i < sizes; i++)
+        out << "    &BAKED_FONT_" << atoi(argv[3 + i]) << ",\n";
+    out << "};\n\nconst int BAKED_FONT_COUNT = " << sizes << ";\n\n#endif\n";
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
@@ -0,0 +1,2614 @@
+//Generated by fontbake from Eurosti.TTF - do not edit, rerun it instead
+#ifndef FONTDATA_H
+#define FONTDATA_H
+
+#include "bakedfont.h"
+
+constexpr unsigned char BAKED_RUNS_48[] =
+{
+    1,62,3,255,1,172,1,57,3,255,1,167,1,53,3,255,1,162,1,48,3,255,1,157,
+    1,44,3,255,1,152,1,39,3,255,1,146,1,35,3,255,1,141,1,30,3,255,1,136,
+    1,26,3,255,1,131,1,21,3,255,1,126,1,17,3,255,1,120,1,12,3,255,1,115,
+    1,8,3,255,1,110,1,3,3,255,1,105,1,0,1,254,2,255,1,99,1,0,1,250,
+    2,255,1,94,1,0,1,246,2,255,1,89,1,0,1,241,2,255,1,84,1,0,1,237,
+    2,255,1,79,1,0,1,232,2,255,1,73,1,0,1,228,2,255,1,68,1,0,1,223,
+    2,255,1,63,1,0,1,218,2,255,1,58,5,0,5,0,5,0,5,0,5,0,1,16,
+    3,255,1,140,1,16,3,255,1,140,1,16,3,255,1,140,1,16,3,255,1,140,1,204,
+    2,255,1,102,3,0,1,108,2,255,1,199,1,195,2,255,1,93,3,0,1,98,2,255,
+    1,190,1,187,2,255,1,84,3,0,1,89,2,255,1,182,1,178,2,255,1,75,3,0,
+    1,80,2,255,1,173,1,169,2,255,1,66,3,0,1,71,2,255,1,164,1,161,2,255,
+    1,56,3,0,1,61,2,255,1,156,1,152,2,255,1,47,3,0,1,52,2,255,1,147,
+    1,144,2,255,1,38,3,0,1,43,2,255,1,139,1,135,2,255,1,29,3,0,1,34,
+    2,255,1,130,1,126,2,255,1,19,3,0,1,24,2,255,1,121,1,118,2,255,1,10,
+    3,0,1,15,2,255,1,113,1,109,2,255,1,2,3,0,1,6,2,255,1,104,1,100,
+    1,255,1,248,5,0,1,252,1,255,1,96,9,0,1,229,1,255,1,163,6,0,1,69,
+    2,255,1,75,4,0,8,0,1,13,2,255,1,122,6,0,1,109,2,255,1,34,4,0,
+    8,0,1,53,2,255,1,81,6,0,1,150,1,255,1,247,1,2,4,0,8,0,1,94,
+    2,255,1,40,6,0,1,191,1,255,1,208,5,0,8,0,1,134,1,255,1,250,1,5,
+    6,0,1,232,1,255,1,167,5,0,8,0,1,175,1,255,1,215,6,0,1,16,2,255,
+    1,127,5,0,8,0,1,215,1,255,1,174,6,0,1,57,2,255,1,86,5,0,7,0,
+    1,4,1,250,1,255,1,133,6,0,1,98,2,255,1,45,5,0,7,0,1,40,2,255,
+    1,92,6,0,1,139,1,255,1,253,1,7,5,0,7,0,1,80,2,255,1,52,6,0,
+    1,180,1,255,1,220,6,0,1,0,1,8,1,252,22,255,1,43,1,0,1,52,22,255,
+    1,247,1,3,7,0,1,215,1,255,1,177,6,0,1,51,2,255,1,85,6,0,6,0,
+    1,2,1,248,1,255,1,140,6,0,1,88,2,255,1,49,6,0,6,0,1,32,2,255,
+    1,104,6,0,1,125,2,255,1,13,6,0,6,0,1,68,2,255,1,67,6,0,1,162,
+    1,255,1,233,7,0,6,0,1,105,2,255,1,31,6,0,1,199,1,255,1,197,7,0,
+    6,0,1,141,1,255,1,248,1,2,6,0,1,236,1,255,1,161,7,0,6,0,1,178,
+    1,255,1,214,6,0,1,17,2,255,1,125,7,0,6,0,1,214,1,255,1,178,6,0,
+    1,54,2,255,1,89,7,0,1,136,22,255,1,183,2,0,1,181,22,255,1,135,2,0,
+    5,0,1,89,2,255,1,43,6,0,1,181,1,255,1,211,8,0,5,0,1,130,1,255,
+    1,252,1,6,6,0,1,223,1,255,1,170,8,0,5,0,1,171,1,255,1,217,6,0,
+    1,10,1,254,1,255,1,129,8,0,5,0,1,212,1,255,1,176,6,0,1,50,2,255,
+    1,88,8,0,4,0,1,4,1,249,1,255,1,135,6,0,1,92,2,255,1,47,8,0,
+    4,0,1,39,2,255,1,95,6,0,1,133,1,255,1,253,1,9,8,0,4,0,1,80,
+    2,255,1,54,6,0,1,175,1,255,1,222,9,0,4,0,1,121,2,255,1,14,6,0,
+    1,216,1,255,1,181,9,0,4,0,1,162,1,255,1,228,6,0,1,6,1,251,1,255,
+    1,140,9,0,4,0,1,203,1,255,1,188,6,0,1,43,2,255,1,100,9,0,12,0,
+    1,152,2,255,1,32,12,0,12,0,1,152,2,255,1,32,12,0,12,0,1,152,2,255,
+    1,32,12,0,4,0,1,13,1,82,1,139,1,181,1,210,1,232,1,245,1,252,3,255,
+    1,253,1,246,1,237,1,227,1,208,1,173,1,130,1,57,1,2,4,0,2,0,1,7,
+    1,140,1,245,18,255,1,208,1,53,3,0,1,0,1,3,1,178,21,255,1,239,1,38,
+    2,0,1,0,1,93,3,255,1,242,1,150,1,87,1,53,1,30,1,23,1,16,1,158,
+    2,255,1,56,1,29,1,37,1,48,1,75,1,126,1,218,3,255,1,166,2,0,1,0,
+    1,204,2,255,1,232,1,32,6,0,1,152,2,255,1,32,5,0,1,8,1,209,2,255,
+    1,249,1,7,1,0,1,14,1,253,2,255,1,120,7,0,1,152,2,255,1,32,6,0,
+    1,101,3,255,1,55,1,0,1,59,3,255,1,54,7,0,1,152,2,255,1,32,6,0,
+    1,49,3,255,1,84,1,0,1,78,3,255,1,27,7,0,1,152,2,255,1,32,6,0,
+    1,29,3,255,1,100,1,0,1,91,3,255,1,19,7,0,1,152,2,255,1,32,6,0,
+    1,18,3,255,1,105,1,0,1,84,3,255,1,30,7,0,1,152,2,255,1,32,12,0,
+    1,69,3,255,1,58,7,0,1,152,2,255,1,32,12,0,1,39,3,255,1,113,7,0,
+    1,152,2,255,1,32,12,0,1,1,1,239,2,255,1,213,1,6,6,0,1,152,2,255,
+    1,32,12,0,1,0,1,161,3,255,1,184,1,48,5,0,1,152,2,255,1,32,12,0,
+    1,0,1,43,1,249,4,255,1,233,1,194,1,167,1,156,1,148,1,209,2,255,1,152,
+    1,132,1,122,1,107,1,83,1,49,1,8,6,0,2,0,1,82,1,246,17,255,1,250,
+    1,194,1,105,1,8,3,0,3,0,1,28,1,126,1,199,1,247,17,255,1,217,1,28,
+    2,0,6,0,1,3,1,32,1,60,1,79,1,91,1,97,1,192,2,255,1,132,1,120,
+    1,128,1,142,1,169,1,216,4,255,1,213,1,4,1,0,12,0,1,152,2,255,1,32,
+    5,0,1,37,1,189,3,255,1,96,1,0,12,0,1,152,2,255,1,32,6,0,1,11,
+    1,234,2,255,1,180,1,0,12,0,1,152,2,255,1,32,7,0,1,148,2,255,1,238,
+    1,0,12,0,1,152,2,255,1,32,7,0,1,100,3,255,1,12,1,174,2,255,1,212,
+    8,0,1,152,2,255,1,32,7,0,1,82,3,255,1,29,1,162,2,255,1,220,8,0,
+    1,152,2,255,1,32,7,0,1,88,3,255,1,33,1,140,2,255,1,233,8,0,1,152,
+    2,255,1,32,7,0,1,113,3,255,1,17,1,98,3,255,1,12,7,0,1,152,2,255,
+    1,32,7,0,1,175,2,255,1,248,1,2,1,40,3,255,1,70,7,0,1,152,2,255,
+    1,32,6,0,1,36,1,251,2,255,1,197,1,0,1,0,1,212,2,255,1,184,1,1,
+    6,0,1,152,2,255,1,32,5,0,1,20,1,209,3,255,1,128,1,0,1,0,1,90,
+    3,255,1,201,1,107,1,53,1,23,1,5,2,0,1,152,2,255,1,32,2,0,1,6,
+    1,42,1,120,1,234,3,255,1,246,1,22,1,0,1,0,1,1,1,174,7,255,1,253,
+    1,245,1,248,2,255,1,244,1,253,1,250,1,254,5,255,1,254,1,89,2,0,2,0,
+    1,9,1,162,19,255,1,212,1,69,3,0,4,0,1,56,1,152,1,204,1,236,1,249,
+    1,254,5,255,1,253,1,244,1,235,1,224,1,202,1,165,1,122,1,49,5,0,12,0,
+    1,152,2,255,1,32,12,0,12,0,1,152,2,255,1,32,12,0,12,0,1,152,2,255,
+    1,32,12,0,12,0,1,152,2,255,1,32,12,0,2,0,1,14,1,109,1,180,1,221,
+    1,240,1,251,1,249,1,240,1,217,1,180,1,110,1,10,13,0,1,5,1,208,1,255,
+    1,124,6,0,1,0,1,20,1,221,10,255,1,207,1,3,12,0,1,131,1,255,1,203,
+    1,4,6,0,1,0,1,136,1,255,1,220,1,92,1,38,1,11,1,2,1,5,1,15,
+    1,40,1,99,1,238,1,255,1,68,11,0,1,51,1,251,1,247,1,41,7,0,1,0,
+    1,212,1,255,1,62,8,0,1,123,1,255,1,123,10,0,1,7,1,212,1,255,1,115,
+    8,0,1,3,1,251,1,250,1,4,8,0,1,71,1,255,1,157,10,0,1,137,1,255,
+    1,194,1,2,8,0,1,28,1,255,1,225,9,0,1,57,1,255,1,177,9,0,1,56,
+    1,252,1,244,1,35,9,0,1,41,1,255,1,211,9,0,1,56,1,255,1,189,8,0,
+    1,9,1,216,1,255,1,105,10,0,1,49,1,255,1,205,9,0,1,56,1,255,1,194,
+    8,0,1,143,1,255,1,186,11,0,1,50,1,255,1,208,9,0,1,56,1,255,1,193,
+    7,0,1,61,1,253,1,240,1,29,11,0,1,43,1,255,1,214,9,0,1,56,1,255,
+    1,186,6,0,1,11,1,220,1,255,1,96,12,0,1,27,1,255,1,232,9,0,1,60,
+    1,255,1,174,6,0,1,149,1,255,1,178,13,0,1,4,1,252,1,253,1,8,8,0,
+    1,94,1,255,1,152,5,0,1,66,1,254,1,236,1,23,13,0,1,0,1,214,1,255,
+    1,66,8,0,1,189,1,255,1,116,4,0,1,13,1,224,1,255,1,86,14,0,1,0,
+    1,146,1,255,1,220,1,102,1,50,1,24,1,9,1,3,1,14,1,53,1,173,2,255,
+    1,56,4,0,1,155,1,255,1,168,15,0,1,0,1,31,1,229,10,255,1,191,4,0,
+    1,71,1,255,1,231,1,19,15,0,2,0,1,18,1,112,1,180,1,218,1,240,1,250,
+    1,252,1,243,1,222,1,181,1,104,1,6,3,0,1,15,1,227,1,255,1,77,16,0,
+    17,0,1,161,1,255,1,158,4,0,1,10,1,103,1,177,1,219,1,240,1,251,1,249,
+    1,240,1,219,1,183,1,116,1,14,1,0,16,0,1,77,1,255,1,226,1,15,3,0,
+    1,12,1,213,10,255,1,218,1,8,15,0,1,18,1,231,1,254,1,68,4,0,1,120,
+    1,255,1,225,1,96,1,39,1,12,1,3,1,5,1,14,1,39,1,97,1,235,1,255,
+    1,84,15,0,1,166,1,255,1,149,5,0,1,196,1,255,1,74,8,0,1,112,1,255,
+    1,139,14,0,1,83,1,255,1,220,1,11,5,0,1,238,1,255,1,11,8,0,1,60,
+    1,255,1,173,13,0,1,21,1,234,1,253,1,59,5,0,1,12,1,255,1,237,9,0,
+    1,45,1,255,1,193,13,0,1,171,1,255,1,139,6,0,1,25,1,255,1,223,9,0,
+    1,44,1,255,1,205,12,0,1,89,1,255,1,213,1,7,6,0,1,33,1,255,1,217,
+    9,0,1,44,1,255,1,210,11,0,1,24,1,237,1,251,1,52,7,0,1,34,1,255,
+    1,220,9,0,1,44,1,255,1,209,11,0,1,177,1,255,1,130,8,0,1,27,1,255,
+    1,226,9,0,1,44,1,255,1,202,10,0,1,95,1,255,1,206,1,5,8,0,1,11,
+    1,255,1,244,9,0,1,48,1,255,1,190,9,0,1,27,1,239,1,249,1,45,10,0,
+    1,240,1,255,1,18,8,0,1,82,1,255,1,168,9,0,1,183,1,255,1,120,11,0,
+    1,198,1,255,1,78,8,0,1,177,1,255,1,132,8,0,1,101,1,255,1,199,1,3,
+    11,0,1,130,1,255,1,225,1,106,1,51,1,25,1,9,1,3,1,13,1,50,1,166,
+    2,255,1,73,7,0,1,31,1,242,1,246,1,38,12,0,1,22,1,222,10,255,1,204,
+    1,4,6,0,1,1,1,188,1,255,1,110,14,0,1,14,1,107,1,176,1,215,1,239,
+    1,249,1,253,1,243,1,224,1,184,1,111,1,10,1,0,7,0,1,12,1,85,1,155,
+    1,195,1,228,1,240,1,251,1,248,1,238,1,221,1,184,1,138,1,60,1,1,11,0,
+    6,0,1,90,1,235,12,255,1,198,1,37,10,0,5,0,1,79,1,254,14,255,1,221,
+    1,15,9,0,4,0,1,1,1,217,2,255,1,252,1,151,1,71,1,32,1,11,1,2,
+    1,6,1,17,1,45,1,99,1,209,3,255,1,120,9,0,4,0,1,53,3,255,1,110,
+    9,0,1,16,1,238,2,255,1,209,9,0,4,0,1,107,2,255,1,250,1,9,10,0,
+    1,165,2,255,1,252,1,10,8,0,4,0,1,137,2,255,1,221,11,0,1,124,3,255,
+    1,34,8,0,4,0,1,152,2,255,1,220,11,0,1,103,3,255,1,49,8,0,4,0,
+    1,146,2,255,1,246,1,5,10,0,1,94,3,255,1,52,8,0,4,0,1,111,3,255,
+    1,75,10,0,1,92,3,255,1,46,8,0,4,0,1,30,1,254,2,255,1,209,1,7,
+    22,0,5,0,1,160,3,255,1,179,1,8,21,0,5,0,1,18,1,220,3,255,1,198,
+    1,23,20,0,6,0,1,45,1,243,3,255,1,225,1,48,19,0,3,0,1,23,1,124,
+    1,204,1,253,5,255,1,244,1,82,18,0,2,0,1,89,1,242,4,255,1,244,1,214,
+    3,255,1,254,1,125,17,0,1,0,1,56,1,252,2,255,1,250,1,158,1,64,1,4,
+    1,1,1,130,1,254,3,255,1,168,1,9,15,0,1,0,1,171,2,255,1,245,1,50,
+    5,0,1,84,1,244,3,255,1,204,1,27,14,0,1,0,1,239,2,255,1,152,7,0,
+    1,47,1,224,3,255,1,230,1,54,3,0,1,76,3,255,1,72,5,0,1,24,3,255,
+    1,94,8,0,1,21,1,193,3,255,1,247,1,90,2,0,1,76,3,255,1,77,5,0,
+    1,48,3,255,1,64,9,0,1,5,1,151,4,255,1,134,1,1,1,76,3,255,1,77,
+    5,0,1,59,3,255,1,53,11,0,1,104,1,250,3,255,1,176,1,88,3,255,1,69,
+    5,0,1,61,3,255,1,51,12,0,1,62,1,234,3,255,1,242,3,255,1,58,5,0,
+    1,54,3,255,1,61,13,0,1,31,1,208,6,255,1,33,5,0,1,34,3,255,1,79,
+    14,0,1,11,1,171,4,255,1,251,1,3,5,0,1,6,1,251,2,255,1,119,15,0,
+    1,1,1,125,4,255,1,150,1,5,4,0,1,0,1,209,2,255,1,187,16,0,1,68,
+    5,255,1,193,1,21,3,0,1,0,1,137,2,255,1,253,1,65,14,0,1,76,1,236,
+    6,255,1,224,1,48,2,0,1,0,1,35,1,251,2,255,1,248,1,164,1,99,1,60,
+    1,34,1,17,1,7,1,2,1,1,1,6,1,18,1,41,1,78,1,130,1,210,4,255,
+    1,155,1,165,3,255,1,245,1,86,1,0,2,0,1,118,20,255,1,180,1,8,1,0,
+    1,121,1,253,3,255,1,74,3,0,1,88,1,215,16,255,1,222,1,102,1,1,3,0,
+    1,77,1,242,1,255,1,191,1,4,5,0,1,44,1,105,1,150,1,185,1,211,1,229,
+    1,242,1,250,1,254,1,253,1,246,1,233,1,208,1,173,1,125,1,57,1,2,6,0,
+    1,43,1,192,1,22,1,0,1,204,2,255,1,102,1,195,2,255,1,93,1,187,2,255,
+    1,84,1,178,2,255,1,75,1,169,2,255,1,66,1,161,2,255,1,56,1,152,2,255,
+    1,47,1,144,2,255,1,38,1,135,2,255,1,29,1,126,2,255,1,19,1,118,2,255,
+    1,10,1,109,2,255,1,2,1,100,1,255,1,248,1,0,8,0,1,17,3,0,1,45,
+    1,142,1,202,1,236,1,250,1,231,2,0,1,126,1,253,4,255,1,232,1,0,1,74,
+    6,255,1,232,1,0,1,171,3,255,1,215,1,93,1,33,1,11,1,0,1,223,2,255,
+    1,233,1,18,3,0,1,6,1,254,2,255,1,157,4,0,1,32,3,255,1,118,4,0,
+    1,54,3,255,1,93,4,0,1,72,3,255,1,75,4,0,1,88,3,255,1,62,4,0,
+    1,100,3,255,1,52,4,0,1,110,3,255,1,44,4,0,1,119,3,255,1,40,4,0,
+    1,126,3,255,1,37,4,0,1,132,3,255,1,36,4,0,1,137,3,255,1,36,4,0,
+    1,141,3,255,1,37,4,0,1,144,3,255,1,38,4,0,1,145,3,255,1,40,4,0,
+    1,146,3,255,1,41,4,0,1,147,3,255,1,43,4,0,1,148,3,255,1,44,4,0,
+    1,146,3,255,1,44,4,0,1,145,3,255,1,44,4,0,1,144,3,255,1,44,4,0,
+    1,141,3,255,1,44,4,0,1,137,3,255,1,44,4,0,1,132,3,255,1,44,4,0,
+    1,126,3,255,1,45,4,0,1,119,3,255,1,48,4,0,1,110,3,255,1,52,4,0,
+    1,100,3,255,1,60,4,0,1,88,3,255,1,70,4,0,1,72,3,255,1,83,4,0,
+    1,54,3,255,1,101,4,0,1,32,3,255,1,126,4,0,1,6,1,254,2,255,1,166,
+    4,0,1,0,1,224,2,255,1,238,1,22,3,0,1,0,1,172,3,255,1,220,1,98,
+    1,36,1,14,1,0,1,76,6,255,1,232,2,0,1,129,1,254,4,255,1,232,3,0,
+    1,46,1,143,1,204,1,237,1,252,1,232,1,15,1,1,7,0,1,156,1,253,1,242,
+    1,215,1,163,1,78,1,1,2,0,1,156,5,255,1,188,1,12,1,0,1,156,6,255,
+    1,150,1,0,1,6,1,24,1,71,1,175,3,255,1,241,1,4,4,0,1,176,3,255,
+    1,42,4,0,1,82,3,255,1,79,4,0,1,43,3,255,1,106,4,0,1,18,3,255,
+    1,128,4,0,1,1,1,254,2,255,1,147,5,0,1,243,2,255,1,162,5,0,1,234,
+    2,255,1,174,5,0,1,226,2,255,1,185,5,0,1,222,2,255,1,193,5,0,1,218,
+    2,255,1,201,5,0,1,217,2,255,1,208,5,0,1,216,2,255,1,211,5,0,1,218,
+    2,255,1,215,5,0,1,219,2,255,1,218,5,0,1,221,2,255,1,220,5,0,1,222,
+    2,255,1,221,5,0,1,223,2,255,1,223,5,0,1,224,2,255,1,222,5,0,1,224,
+    2,255,1,221,5,0,1,224,2,255,1,220,5,0,1,224,2,255,1,218,5,0,1,224,
+    2,255,1,215,5,0,1,224,2,255,1,211,5,0,1,225,2,255,1,208,5,0,1,226,
+    2,255,1,201,5,0,1,230,2,255,1,193,5,0,1,234,2,255,1,185,5,0,1,242,
+    2,255,1,174,5,0,1,251,2,255,1,162,4,0,1,8,3,255,1,147,4,0,1,26,
+    3,255,1,129,4,0,1,51,3,255,1,107,4,0,1,91,3,255,1,80,4,0,1,185,
+    3,255,1,42,1,7,1,27,1,75,1,181,3,255,1,242,1,4,1,156,6,255,1,152,
+    1,0,1,156,5,255,1,191,1,13,1,0,1,156,1,253,1,243,1,216,1,165,1,79,
+    1,1,2,0,7,0,1,116,1,255,1,240,8,0,7,0,1,116,1,255,1,240,8,0,
+    7,0,1,116,1,255,1,240,8,0,7,0,1,116,1,255,1,240,8,0,1,5,1,35,
+    5,0,1,116,1,255,1,240,5,0,1,8,1,32,1,0,1,74,1,255,1,194,1,99,
+    1,13,2,0,1,116,1,255,1,240,3,0,1,55,1,151,1,239,1,188,1,0,1,159,
+    3,255,1,245,1,163,1,68,1,118,1,255,1,240,1,25,1,118,1,214,3,255,1,252,
+    1,23,1,60,1,165,1,247,4,255,1,250,1,255,1,254,1,252,4,255,1,210,1,111,
+    1,13,2,0,1,17,1,109,1,208,7,255,1,241,1,152,1,53,3,0,5,0,1,52,
+    1,182,3,255,1,238,1,95,1,10,5,0,5,0,1,14,1,219,1,255,1,253,2,255,
+    1,78,6,0,5,0,1,168,1,255,1,254,1,80,1,199,1,255,1,235,1,24,5,0,
+    4,0,1,103,2,255,1,137,1,0,1,36,1,243,1,255,1,184,1,1,4,0,3,0,
+    1,46,1,247,1,255,1,196,1,4,2,0,1,100,2,255,1,111,4,0,2,0,1,11,
+    1,216,1,255,1,235,1,28,4,0,1,176,1,255,1,248,1,45,3,0,2,0,1,28,
+    1,205,1,254,1,71,5,0,1,20,1,231,1,232,1,61,3,0,3,0,1,6,1,74,
+    7,0,1,56,1,23,4,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,
+    1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,
+    10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,
+    2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,
+    9,0,1,92,21,255,1,208,1,92,21,255,1,208,1,92,21,255,1,208,10,0,1,236,
+    2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,
+    9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,
+    1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,
+    1,92,9,0,10,0,1,236,2,255,1,92,9,0,10,0,1,236,2,255,1,92,9,0,
+    1,0,1,248,2,255,1,164,1,0,1,248,2,255,1,164,1,0,1,248,2,255,1,164,
+    1,0,1,248,2,255,1,164,2,0,1,112,1,255,1,161,2,0,1,135,1,255,1,145,
+    1,3,1,63,1,235,1,255,1,100,1,111,2,255,1,240,1,19,1,101,1,249,1,209,
+    1,62,1,0,1,240,8,255,1,248,1,246,8,255,1,248,1,253,8,255,1,248,1,28,
+    3,255,1,128,1,28,3,255,1,128,1,28,3,255,1,128,1,28,3,255,1,128,28,0,
+    1,94,2,255,1,77,27,0,1,26,1,239,1,255,1,162,1,0,27,0,1,181,1,255,
+    1,229,1,17,1,0,26,0,1,97,2,255,1,75,2,0,25,0,1,28,1,240,1,255,
+    1,159,3,0,25,0,1,183,1,255,1,228,1,16,3,0,24,0,1,100,2,255,1,73,
+    4,0,23,0,1,29,1,241,1,255,1,157,5,0,23,0,1,185,1,255,1,227,1,14,
+    5,0,22,0,1,103,2,255,1,71,6,0,21,0,1,31,1,242,1,255,1,154,7,0,
+    20,0,1,1,1,188,1,255,1,225,1,14,7,0,20,0,1,106,2,255,1,68,8,0,
+    19,0,1,33,1,243,1,255,1,152,9,0,18,0,1,1,1,191,1,255,1,224,1,12,
+    9,0,18,0,1,108,1,255,1,254,1,66,10,0,17,0,1,35,1,244,1,255,1,149,
+    11,0,16,0,1,1,1,193,1,255,1,222,1,12,11,0,16,0,1,111,1,255,1,254,
+    1,64,12,0,15,0,1,36,1,245,1,255,1,147,13,0,14,0,1,2,1,195,1,255,
+    1,220,1,10,13,0,14,0,1,114,1,255,1,254,1,61,14,0,13,0,1,38,1,246,
+    1,255,1,144,15,0,12,0,1,2,1,198,1,255,1,218,1,9,15,0,12,0,1,117,
+    1,255,1,253,1,60,16,0,11,0,1,40,1,247,1,255,1,141,17,0,10,0,1,3,
+    1,200,1,255,1,217,1,9,17,0,10,0,1,120,1,255,1,253,1,57,18,0,9,0,
+    1,42,1,248,1,255,1,139,19,0,8,0,1,3,1,202,1,255,1,215,1,8,19,0,
+    8,0,1,123,1,255,1,252,1,55,20,0,7,0,1,44,1,249,1,255,1,136,21,0,
+    6,0,1,4,1,204,1,255,1,213,1,7,21,0,6,0,1,126,1,255,1,252,1,53,
+    22,0,5,0,1,46,1,250,1,255,1,134,23,0,4,0,1,5,1,207,1,255,1,212,
+    1,6,23,0,4,0,1,128,1,255,1,251,1,51,24,0,3,0,1,49,1,250,1,255,
+    1,131,25,0,2,0,1,6,1,209,1,255,1,209,1,6,25,0,2,0,1,131,1,255,
+    1,251,1,49,26,0,1,0,1,51,1,251,1,255,1,129,27,0,1,6,1,211,1,255,
+    1,208,1,5,27,0,4,0,1,25,1,93,1,143,1,182,1,209,1,228,1,242,1,249,
+    1,254,1,251,1,247,1,235,1,220,1,196,1,165,1,122,1,62,1,4,4,0,2,0,
+    1,35,1,177,1,253,16,255,1,230,1,110,3,0,1,0,1,25,1,234,20,255,1,131,
+    2,0,1,0,1,143,3,255,1,250,1,173,1,105,1,62,1,34,1,16,1,5,1,1,
+    1,4,1,10,1,25,1,49,1,85,1,139,1,224,3,255,1,247,1,15,1,0,1,0,
+    1,228,2,255,1,231,1,39,13,0,1,4,1,154,3,255,1,87,1,0,1,34,3,255,
+    1,118,15,0,1,14,1,248,2,255,1,146,1,0,1,81,3,255,1,51,16,0,1,196,
+    2,255,1,189,1,0,1,115,2,255,1,254,1,9,16,0,1,153,2,255,1,223,1,0,
+    1,143,2,255,1,233,17,0,1,122,2,255,1,249,1,1,1,164,2,255,1,210,17,0,
+    1,99,3,255,1,14,1,181,2,255,1,193,17,0,1,83,3,255,1,31,1,192,2,255,
+    1,181,17,0,1,70,3,255,1,43,1,200,2,255,1,172,17,0,1,61,3,255,1,52,
+    1,204,2,255,1,165,17,0,1,54,3,255,1,60,1,207,2,255,1,162,17,0,1,52,
+    3,255,1,63,1,207,2,255,1,160,17,0,1,49,3,255,1,66,1,205,2,255,1,160,
+    17,0,1,50,3,255,1,66,1,202,2,255,1,162,17,0,1,52,3,255,1,63,1,196,
+    2,255,1,165,17,0,1,55,3,255,1,60,1,187,2,255,1,172,17,0,1,62,3,255,
+    1,51,1,176,2,255,1,181,17,0,1,70,3,255,1,42,1,161,2,255,1,193,17,0,
+    1,83,3,255,1,28,1,143,2,255,1,211,17,0,1,100,3,255,1,11,1,119,2,255,
+    1,233,17,0,1,122,2,255,1,243,1,0,1,91,3,255,1,9,16,0,1,153,2,255,
+    1,216,1,0,1,55,3,255,1,50,16,0,1,195,2,255,1,177,1,0,1,10,1,251,
+    2,255,1,116,15,0,1,13,1,248,2,255,1,128,1,0,1,0,1,198,2,255,1,229,
+    1,36,13,0,1,3,1,150,3,255,1,61,1,0,1,0,1,100,3,255,1,248,1,170,
+    1,104,1,60,1,32,1,14,1,4,1,0,1,2,1,9,1,23,1,46,1,82,1,137,
+    1,221,3,255,1,215,1,1,1,0,1,0,1,2,1,166,19,255,1,236,1,49,2,0,
+    3,0,1,94,1,216,15,255,1,247,1,156,1,25,3,0,5,0,1,47,1,112,1,161,
+    1,197,1,223,1,240,1,250,1,254,1,252,1,246,1,231,1,211,1,179,1,137,1,80,
+    1,12,5,0,8,0,1,1,1,167,4,255,1,252,8,0,1,140,5,255,1,252,7,0,
+    1,110,3,255,1,251,2,255,1,252,6,0,1,82,1,253,2,255,1,191,1,166,2,255,
+    1,252,5,0,1,59,1,247,2,255,1,212,1,16,1,160,2,255,1,252,4,0,1,40,
+    1,237,2,255,1,229,1,30,1,0,1,160,2,255,1,252,3,0,1,24,1,223,2,255,
+    1,242,1,48,2,0,1,160,2,255,1,252,2,0,1,12,1,205,2,255,1,251,1,71,
+    3,0,1,160,2,255,1,252,1,0,1,4,1,184,3,255,1,98,4,0,1,160,2,255,
+    1,252,1,0,1,158,3,255,1,129,5,0,1,160,2,255,1,252,1,1,1,141,2,255,
+    1,160,6,0,1,160,2,255,1,252,2,0,1,122,1,186,1,5,6,0,1,160,2,255,
+    1,252,3,0,1,3,7,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,
+    1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,
+    1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,
+    1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,
+    1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,
+    1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,
+    1,160,2,255,1,252,11,0,1,160,2,255,1,252,11,0,1,160,2,255,1,252,4,0,
+    1,1,1,57,1,120,1,166,1,200,1,224,1,240,1,249,1,254,1,251,1,243,1,227,
+    1,200,1,160,1,103,1,26,4,0,3,0,1,96,1,224,14,255,1,252,1,163,1,18,
+    2,0,2,0,1,122,18,255,1,208,1,9,1,0,1,0,1,46,3,255,1,246,1,159,
+    1,96,1,56,1,31,1,14,1,5,1,1,1,6,1,15,1,35,1,71,1,136,1,232,
+    3,255,1,136,1,0,1,0,1,160,2,255,1,247,1,51,12,0,1,15,1,211,2,255,
+    1,236,1,7,1,0,1,230,2,255,1,153,14,0,1,74,3,255,1,66,1,28,3,255,
+    1,85,14,0,1,4,1,249,2,255,1,114,1,56,3,255,1,52,15,0,1,211,2,255,
+    1,153,1,71,3,255,1,39,15,0,1,193,2,255,1,167,1,83,3,255,1,39,15,0,
+    1,183,2,255,1,181,1,87,3,255,1,45,15,0,1,189,2,255,1,180,20,0,1,200,
+    2,255,1,167,20,0,1,231,2,255,1,152,19,0,1,22,3,255,1,112,19,0,1,110,
+    3,255,1,64,17,0,1,3,1,86,1,242,2,255,1,231,1,4,12,0,1,3,1,32,
+    1,69,1,114,1,168,1,234,4,255,1,119,1,0,6,0,1,15,1,68,1,115,1,156,
+    1,193,1,225,1,252,8,255,1,176,1,2,1,0,3,0,1,26,1,123,1,204,1,253,
+    12,255,1,211,1,97,1,2,2,0,2,0,1,103,1,248,10,255,1,247,1,211,1,165,
+    1,109,1,41,5,0,1,0,1,67,1,254,4,255,1,246,1,197,1,151,1,114,1,81,
+    1,52,1,24,1,1,9,0,1,0,1,187,3,255,1,203,1,76,1,7,16,0,1,9,
+    1,252,2,255,1,237,1,18,18,0,1,55,3,255,1,161,19,0,1,80,3,255,1,111,
+    19,0,1,93,3,255,1,80,19,0,1,100,3,255,1,67,19,0,1,100,3,255,1,59,
+    19,0,1,100,3,255,1,56,19,0,1,100,22,255,1,164,1,100,22,255,1,164,1,100,
+    22,255,1,164,4,0,1,17,1,90,1,147,1,187,1,215,1,235,1,247,1,253,1,254,
+    1,250,1,241,1,227,1,205,1,174,1,131,1,72,1,6,4,0,2,0,1,2,1,137,
+    1,247,15,255,1,234,1,96,3,0,2,0,1,140,19,255,1,97,2,0,1,0,1,29,
+    1,252,2,255,1,239,1,140,1,79,1,44,1,21,1,11,1,4,1,1,1,5,1,13,
+    1,29,1,54,1,95,1,168,1,254,2,255,1,234,1,11,1,0,1,0,1,121,2,255,
+    1,254,1,51,13,0,1,131,3,255,1,79,1,0,1,0,1,174,2,255,1,196,14,0,
+    1,21,1,254,2,255,1,137,1,0,1,0,1,215,2,255,1,144,15,0,1,224,2,255,
+    1,164,1,0,1,0,1,231,2,255,1,120,15,0,1,196,2,255,1,181,1,0,1,0,
+    1,244,2,255,1,110,15,0,1,185,2,255,1,181,1,0,1,0,1,253,2,255,1,108,
+    15,0,1,189,2,255,1,171,1,0,20,0,1,209,2,255,1,145,1,0,19,0,1,11,
+    1,251,2,255,1,103,1,0,19,0,1,124,2,255,1,252,1,31,1,0,10,0,2,1,
+    1,3,1,9,1,19,1,36,1,60,1,98,1,167,3,255,1,143,2,0,9,0,1,72,
+    10,255,1,219,1,105,1,1,2,0,9,0,1,72,8,255,1,210,1,108,1,16,4,0,
+    9,0,1,72,10,255,1,250,1,175,1,41,2,0,14,0,1,3,1,12,1,31,1,66,
+    1,131,1,235,2,255,1,242,1,47,1,0,19,0,1,27,1,234,2,255,1,181,1,0,
+    20,0,1,130,2,255,1,250,1,10,20,0,1,69,3,255,1,48,20,0,1,39,3,255,
+    1,73,1,136,2,255,1,252,16,0,1,27,3,255,1,83,1,135,2,255,1,252,16,0,
+    1,35,3,255,1,78,1,125,3,255,1,5,15,0,1,49,3,255,1,63,1,109,3,255,
+    1,25,15,0,1,88,3,255,1,42,1,74,3,255,1,75,15,0,1,155,2,255,1,244,
+    1,3,1,16,1,254,2,255,1,184,1,1,13,0,1,43,1,245,2,255,1,185,1,0,
+    1,0,1,175,3,255,1,191,1,107,1,65,1,39,1,22,1,10,1,4,2,1,1,9,
+    1,19,1,45,1,83,1,150,1,245,3,255,1,76,1,0,1,0,1,41,1,239,19,255,
+    1,166,1,1,1,0,2,0,1,48,1,203,16,255,1,245,1,137,1,6,2,0,4,0,
+    1,43,1,108,1,156,1,190,1,215,1,233,1,245,1,252,1,255,1,253,1,246,1,234,
+    1,214,1,183,1,141,1,84,1,13,4,0,15,0,1,53,1,249,4,255,1,200,5,0,
+    14,0,1,18,1,224,5,255,1,200,5,0,13,0,1,1,1,180,2,255,1,237,1,232,
+    2,255,1,200,5,0,13,0,1,123,2,255,1,254,1,75,1,212,2,255,1,200,5,0,
+    12,0,1,65,1,252,2,255,1,136,1,0,1,212,2,255,1,200,5,0,11,0,1,25,
+    1,232,2,255,1,193,1,3,1,0,1,212,2,255,1,200,5,0,10,0,1,4,1,194,
+    2,255,1,233,1,25,2,0,1,212,2,255,1,200,5,0,10,0,1,139,2,255,1,253,
+    1,68,3,0,1,212,2,255,1,200,5,0,9,0,1,79,3,255,1,126,4,0,1,212,
+    2,255,1,200,5,0,8,0,1,34,1,239,2,255,1,186,1,2,4,0,1,212,2,255,
+    1,200,5,0,7,0,1,8,1,206,2,255,1,228,1,21,5,0,1,212,2,255,1,200,
+    5,0,7,0,1,155,2,255,1,251,1,60,6,0,1,212,2,255,1,200,5,0,6,0,
+    1,94,3,255,1,117,7,0,1,212,2,255,1,200,5,0,5,0,1,44,1,245,2,255,
+    1,178,1,1,7,0,1,212,2,255,1,200,5,0,4,0,1,13,1,217,2,255,1,223,
+    1,17,8,0,1,212,2,255,1,200,5,0,4,0,1,170,2,255,1,249,1,53,9,0,
+    1,212,2,255,1,200,5,0,3,0,1,111,3,255,1,108,10,0,1,212,2,255,1,200,
+    5,0,2,0,1,56,1,250,2,255,1,170,11,0,1,212,2,255,1,200,5,0,1,0,
+    1,19,1,226,2,255,1,218,1,13,11,0,1,212,2,255,1,200,5,0,1,2,1,184,
+    2,255,1,246,1,46,12,0,1,212,2,255,1,200,5,0,1,123,3,255,1,99,13,0,
+    1,212,2,255,1,200,5,0,1,188,2,255,1,161,14,0,1,212,2,255,1,200,5,0,
+    1,188,25,255,1,144,1,188,25,255,1,144,1,188,25,255,1,144,18,0,1,212,2,255,
+    1,200,5,0,18,0,1,212,2,255,1,200,5,0,18,0,1,212,2,255,1,200,5,0,
+    18,0,1,212,2,255,1,200,5,0,18,0,1,212,2,255,1,200,5,0,18,0,1,212,
+    2,255,1,200,5,0,18,0,1,212,2,255,1,200,5,0,1,76,21,255,1,64,1,0,
+    1,76,21,255,1,64,1,0,1,76,21,255,1,64,1,0,1,76,3,255,1,73,19,0,
+    1,76,3,255,1,69,19,0,1,76,3,255,1,64,19,0,1,76,3,255,1,60,19,0,
+    1,76,3,255,1,55,19,0,1,76,3,255,1,51,19,0,1,76,3,255,1,46,19,0,
+    1,76,3,255,1,42,1,0,1,10,1,89,1,156,1,202,1,230,1,247,1,253,1,245,
+    1,233,1,217,1,179,1,136,1,67,1,2,4,0,1,76,3,255,1,37,1,104,1,238,
+    12,255,1,228,1,88,3,0,1,76,3,255,1,162,16,255,1,129,2,0,1,76,4,255,
+    1,253,1,181,1,107,1,59,1,30,1,11,1,3,1,5,1,13,1,27,1,58,1,101,
+    1,176,1,254,2,255,1,254,1,60,1,0,1,76,3,255,1,217,1,43,12,0,1,66,
+    1,251,2,255,1,172,1,0,1,76,3,255,1,47,14,0,1,153,2,255,1,251,1,10,
+    19,0,1,70,3,255,1,55,19,0,1,25,3,255,1,101,20,0,1,249,2,255,1,119,
+    20,0,1,238,2,255,1,133,20,0,1,229,2,255,1,142,20,0,1,232,2,255,1,137,
+    20,0,1,242,2,255,1,126,1,224,2,255,1,137,15,0,1,4,1,254,2,255,1,109,
+    1,218,2,255,1,149,15,0,1,29,3,255,1,80,1,201,2,255,1,182,15,0,1,72,
+    3,255,1,42,1,172,2,255,1,236,1,5,14,0,1,142,2,255,1,240,1,3,1,109,
+    3,255,1,109,13,0,1,39,1,241,2,255,1,168,1,0,1,24,1,244,2,255,1,253,
+    1,169,1,96,1,54,1,28,1,12,1,3,1,0,1,2,1,9,1,24,1,50,1,91,
+    1,157,1,246,3,255,1,61,1,0,1,0,1,108,19,255,1,151,2,0,2,0,1,94,
+    1,230,15,255,1,235,1,113,1,1,2,0,3,0,1,4,1,64,1,126,1,169,1,202,
+    1,224,1,240,1,250,2,254,1,248,1,235,1,214,1,182,1,136,1,74,1,7,4,0,
+    4,0,1,16,1,89,1,148,1,190,1,220,1,238,1,249,1,254,1,252,1,246,1,234,
+    1,216,1,191,1,156,1,106,1,38,5,0,2,0,1,8,1,140,1,247,15,255,1,194,
+    1,37,3,0,1,0,1,2,1,188,18,255,1,238,1,37,2,0,1,0,1,99,3,255,
+    1,251,1,170,1,104,1,63,1,36,1,18,1,8,1,3,1,1,1,8,1,21,1,47,
+    1,96,1,191,3,255,1,182,2,0,1,0,1,205,2,255,1,250,1,63,12,0,1,1,
+    1,171,2,255,1,252,1,18,1,0,1,23,3,255,1,160,14,0,1,61,3,255,1,68,
+    1,0,1,74,3,255,1,87,14,0,1,24,3,255,1,89,1,0,1,109,3,255,1,50,
+    14,0,1,27,3,255,1,95,1,0,1,131,3,255,1,36,20,0,1,143,3,255,1,32,
+    20,0,1,148,3,255,1,32,20,0,1,153,3,255,1,32,20,0,1,158,3,255,1,32,
+    20,0,1,162,3,255,1,32,1,0,1,16,1,92,1,151,1,192,1,222,1,241,1,250,
+    1,254,1,249,1,239,1,220,1,190,1,147,1,86,1,11,4,0,1,167,3,255,1,43,
+    1,142,1,247,13,255,1,242,1,121,1,2,2,0,1,171,3,255,1,217,17,255,1,135,
+    2,0,1,169,4,255,1,232,1,141,1,84,1,49,1,24,1,12,1,5,1,1,1,5,
+    1,14,1,30,1,55,1,96,1,164,1,250,3,255,1,43,1,0,1,167,3,255,1,200,
+    1,14,13,0,1,70,1,254,2,255,1,147,1,0,1,164,3,255,1,55,15,0,1,195,
+    2,255,1,210,1,0,1,161,2,255,1,236,1,1,15,0,1,127,2,255,1,252,1,7,
+    1,158,2,255,1,207,16,0,1,89,3,255,1,27,1,154,2,255,1,199,16,0,1,73,
+    3,255,1,41,1,149,2,255,1,207,16,0,1,63,3,255,1,49,1,135,2,255,1,219,
+    16,0,1,70,3,255,1,42,1,111,2,255,1,248,1,2,15,0,1,84,3,255,1,24,
+    1,74,3,255,1,37,15,0,1,122,2,255,1,248,1,2,1,21,1,254,2,255,1,114,
+    15,0,1,186,2,255,1,204,1,0,1,0,1,200,2,255,1,234,1,29,13,0,1,64,
+    1,253,2,255,1,134,1,0,1,0,1,90,3,255,1,242,1,154,1,91,1,50,1,25,
+    1,10,1,2,1,0,1,3,1,11,1,27,1,52,1,91,1,158,1,248,2,255,1,252,
+    1,36,1,0,2,0,1,174,19,255,1,125,2,0,2,0,1,4,1,122,1,237,15,255,
+    1,231,1,103,3,0,4,0,1,6,1,71,1,132,1,176,1,208,1,230,1,245,1,252,
+    1,255,1,252,1,243,1,229,1,206,1,174,1,129,1,67,1,4,4,0,1,180,22,255,
+    1,160,1,180,22,255,1,160,1,180,22,255,1,160,20,0,1,171,2,255,1,160,19,0,
+    1,62,3,255,1,151,18,0,1,2,1,207,2,255,1,251,1,41,18,0,1,103,3,255,
+    1,148,1,0,17,0,1,15,1,234,2,255,1,239,1,19,1,0,17,0,1,143,3,255,
+    1,113,2,0,16,0,1,40,1,250,2,255,1,219,1,5,2,0,16,0,1,182,3,255,
+    1,79,3,0,15,0,1,76,3,255,1,190,4,0,14,0,1,5,1,217,2,255,1,253,
+    1,48,4,0,14,0,1,116,3,255,1,156,5,0,13,0,1,22,1,241,2,255,1,243,
+    1,24,5,0,13,0,1,156,3,255,1,121,6,0,12,0,1,50,1,253,2,255,1,224,
+    1,8,6,0,12,0,1,195,3,255,1,87,7,0,11,0,1,89,3,255,1,198,8,0,
+    10,0,1,9,1,226,2,255,1,254,1,55,8,0,10,0,1,129,3,255,1,164,9,0,
+    9,0,1,30,1,246,2,255,1,246,1,29,9,0,9,0,1,169,3,255,1,130,10,0,
+    8,0,1,61,3,255,1,229,1,11,10,0,7,0,1,2,1,206,3,255,1,95,11,0,
+    7,0,1,102,3,255,1,205,1,1,11,0,6,0,1,15,1,234,3,255,1,62,12,0,
+    6,0,1,142,3,255,1,172,13,0,5,0,1,39,1,250,2,255,1,249,1,34,13,0,
+    5,0,1,182,3,255,1,138,14,0,4,0,1,73,3,255,1,234,1,15,14,0,3,0,
+    1,5,1,216,3,255,1,104,15,0,4,0,1,35,1,107,1,158,1,195,1,220,1,237,
+    1,248,1,253,1,254,1,250,1,241,1,229,1,209,1,183,1,147,1,95,1,25,4,0,
+    2,0,1,19,1,179,16,255,1,252,1,162,1,8,2,0,1,0,1,4,1,203,19,255,
+    1,169,2,0,1,0,1,91,3,255,1,214,1,114,1,64,1,35,1,17,1,7,1,2,
+    1,1,1,4,1,11,1,25,1,46,1,80,1,137,1,239,3,255,1,47,1,0,1,0,
+    1,180,2,255,1,236,1,18,13,0,1,53,1,254,2,255,1,134,1,0,1,0,1,234,
+    2,255,1,156,15,0,1,196,2,255,1,185,1,0,1,11,3,255,1,110,15,0,1,147,
+    2,255,1,219,1,0,1,25,3,255,1,90,15,0,1,129,2,255,1,233,1,0,1,33,
+    3,255,1,82,15,0,1,125,2,255,1,244,1,0,1,26,3,255,1,92,15,0,1,136,
+    2,255,1,237,1,0,1,7,1,254,2,255,1,116,15,0,1,168,2,255,1,219,1,0,
+    1,0,1,224,2,255,1,173,14,0,1,1,1,223,2,255,1,182,1,0,1,0,1,159,
+    2,255,1,250,1,43,13,0,1,88,3,255,1,114,1,0,1,0,1,42,1,245,2,255,
+    1,238,1,142,1,86,1,53,1,31,1,16,1,7,1,2,1,0,1,5,1,14,1,40,
+    1,80,1,156,1,251,2,255,1,228,1,15,1,0,2,0,1,53,1,204,17,255,1,190,
+    1,34,2,0,4,0,1,55,1,172,12,255,1,251,1,152,1,48,4,0,2,0,1,31,
+    1,151,1,237,15,255,1,211,1,116,1,9,2,0,1,0,1,65,1,245,2,255,1,217,
+    1,124,1,72,1,39,1,19,1,7,1,2,1,1,1,4,1,14,1,29,1,54,1,93,
+    1,157,1,245,2,255,1,218,1,28,1,0,1,2,1,222,2,255,1,205,1,9,13,0,
+    1,49,1,245,2,255,1,168,1,0,1,51,3,255,1,85,15,0,1,148,2,255,1,246,
+    1,7,1,98,3,255,1,24,15,0,1,80,3,255,1,43,1,127,2,255,1,245,16,0,
+    1,48,3,255,1,69,1,138,2,255,1,233,16,0,1,35,3,255,1,79,1,140,2,255,
+    1,231,16,0,1,40,3,255,1,75,1,127,2,255,1,240,16,0,1,53,3,255,1,61,
+    1,111,3,255,1,11,15,0,1,82,3,255,1,41,1,69,3,255,1,56,15,0,1,138,
+    2,255,1,246,1,3,1,15,1,253,2,255,1,144,14,0,1,18,1,231,2,255,1,193,
+    1,0,1,0,1,171,2,255,1,252,1,121,1,16,10,0,1,9,1,83,1,215,3,255,
+    1,91,1,0,1,0,1,41,1,239,3,255,1,253,1,219,1,199,1,197,1,211,1,225,
+    1,239,1,251,1,245,1,233,1,225,1,252,4,255,1,191,1,4,1,0,2,0,1,52,
+    1,206,16,255,1,252,1,162,1,16,2,0,4,0,1,44,1,109,1,155,1,190,1,215,
+    1,233,1,245,1,252,1,255,1,254,1,248,1,236,1,217,1,189,1,151,1,97,1,24,
+    4,0,4,0,1,5,1,70,1,133,1,178,1,209,1,230,1,245,1,251,1,254,1,249,
+    1,238,1,221,1,194,1,157,1,106,1,36,5,0,2,0,1,1,1,107,1,233,15,255,
+    1,192,1,52,3,0,2,0,1,139,18,255,1,250,1,71,2,0,1,0,1,47,1,254,
+    2,255,1,247,1,154,1,87,1,49,1,22,1,12,2,3,1,8,1,21,1,41,1,74,
+    1,126,1,212,3,255,1,233,1,11,1,0,1,0,1,150,2,255,1,247,1,46,12,0,
+    1,1,1,153,3,255,1,105,1,0,1,0,1,222,2,255,1,161,14,0,1,17,1,248,
+    2,255,1,185,1,0,1,16,3,255,1,94,15,0,1,192,2,255,1,241,1,0,1,50,
+    3,255,1,57,15,0,1,148,3,255,1,24,1,72,3,255,1,37,15,0,1,120,3,255,
+    1,49,1,83,3,255,1,28,15,0,1,105,3,255,1,63,1,85,3,255,1,28,15,0,
+    1,98,3,255,1,70,1,75,3,255,1,38,15,0,1,103,3,255,1,73,1,62,3,255,
+    1,60,15,0,1,116,3,255,1,76,1,33,3,255,1,98,15,0,1,155,3,255,1,79,
+    1,0,1,240,2,255,1,168,14,0,1,1,1,219,3,255,1,82,1,0,1,175,2,255,
+    1,250,1,54,13,0,1,104,4,255,1,85,1,0,1,74,3,255,1,248,1,154,1,83,
+    1,43,1,17,1,7,1,0,1,2,1,8,1,19,1,38,1,65,1,108,1,179,1,254,
+    4,255,1,88,2,0,1,168,16,255,1,244,1,148,3,255,1,90,2,0,1,7,1,136,
+    1,250,13,255,1,189,1,44,1,92,3,255,1,93,4,0,1,18,1,98,1,157,1,198,
+    1,228,1,240,1,251,1,253,1,246,1,230,1,206,1,167,1,113,1,39,2,0,1,92,
+    3,255,1,93,20,0,1,92,3,255,1,87,20,0,1,92,3,255,1,81,20,0,1,100,
+    3,255,1,73,20,0,1,109,3,255,1,60,1,151,2,255,1,211,16,0,1,131,3,255,
+    1,46,1,154,2,255,1,219,16,0,1,168,3,255,1,17,1,134,2,255,1,248,1,9,
+    14,0,1,3,1,233,2,255,1,220,1,0,1,88,3,255,1,109,14,0,1,108,3,255,
+    1,153,1,0,1,14,1,242,2,255,1,253,1,158,1,88,1,50,1,28,1,12,1,6,
+    2,1,1,5,1,15,1,33,1,61,1,104,1,178,1,254,3,255,1,44,1,0,1,0,
+    1,100,20,255,1,128,2,0,2,0,1,87,1,229,16,255,1,233,1,110,3,0,3,0,
+    1,3,1,63,1,123,1,166,1,198,1,221,1,237,1,248,1,253,1,255,1,252,1,244,
+    1,229,1,207,1,174,1,130,1,69,1,5,4,0,1,28,3,255,1,128,1,28,3,255,
+    1,128,1,28,3,255,1,128,1,28,3,255,1,128,5,0,5,0,5,0,5,0,5,0,
+    5,0,5,0,5,0,5,0,5,0,5,0,5,0,5,0,5,0,1,28,3,255,1,128,
+    1,28,3,255,1,128,1,28,3,255,1,128,1,28,3,255,1,128,1,44,3,255,1,112,
+    1,44,3,255,1,112,1,44,3,255,1,112,1,44,3,255,1,112,5,0,5,0,5,0,
+    5,0,5,0,5,0,5,0,5,0,5,0,5,0,5,0,5,0,5,0,5,0,1,0,
+    1,240,2,255,1,172,1,0,1,240,2,255,1,172,1,0,1,240,2,255,1,172,1,0,
+    1,240,2,255,1,172,2,0,1,102,1,255,1,169,2,0,1,127,1,255,1,153,1,2,
+    1,59,1,231,1,255,1,108,1,103,2,255,1,243,1,23,1,93,1,249,1,212,1,66,
+    1,0,20,0,1,1,18,0,1,12,1,115,1,177,16,0,1,20,1,130,1,238,1,255,
+    1,204,14,0,1,29,1,144,1,245,3,255,1,204,12,0,1,40,1,159,1,250,4,255,
+    1,233,1,109,10,0,1,54,1,174,1,254,4,255,1,214,1,101,1,8,1,0,8,0,
+    1,68,1,189,5,255,1,191,1,75,1,1,3,0,5,0,1,2,1,83,1,204,4,255,
+    1,251,1,165,1,50,6,0,3,0,1,6,1,98,1,216,4,255,1,241,1,140,1,29,
+    8,0,1,0,1,11,1,113,1,227,4,255,1,225,1,114,1,13,10,0,1,128,1,237,
+    4,255,1,204,1,89,1,4,12,0,3,255,1,254,1,179,1,63,15,0,3,255,1,230,
+    1,107,1,10,15,0,1,198,4,255,1,237,1,134,1,26,13,0,1,0,1,59,1,176,
+    1,254,3,255,1,250,1,161,1,47,11,0,3,0,1,39,1,154,1,248,4,255,1,189,
+    1,74,1,1,8,0,5,0,1,23,1,132,1,237,4,255,1,214,1,102,1,8,6,0,
+    7,0,1,11,1,110,1,223,4,255,1,234,1,129,1,22,4,0,9,0,1,3,1,88,
+    1,204,4,255,1,248,1,156,1,43,2,0,12,0,1,66,1,183,5,255,1,184,1,64,
+    14,0,1,45,1,161,1,250,3,255,1,204,16,0,1,27,1,138,1,241,1,255,1,204,
+    18,0,1,14,1,116,1,175,21,0,1,92,21,255,1,208,1,92,21,255,1,208,1,92,
+    21,255,1,208,23,0,23,0,23,0,23,0,23,0,23,0,1,92,21,255,1,208,1,92,
+    21,255,1,208,1,92,21,255,1,208,21,0,1,203,1,83,1,2,18,0,2,255,1,216,
+    1,98,1,6,16,0,4,255,1,227,1,113,1,11,14,0,1,150,1,245,4,255,1,237,
+    1,128,1,19,12,0,1,0,1,19,1,124,1,232,4,255,1,244,1,143,1,28,10,0,
+    3,0,1,7,1,99,1,213,4,255,1,250,1,159,1,40,8,0,5,0,1,1,1,73,
+    1,189,4,255,1,254,1,174,1,54,6,0,8,0,1,48,1,163,1,250,4,255,1,189,
+    1,69,4,0,10,0,1,27,1,138,1,240,4,255,1,204,1,84,1,2,1,0,12,0,
+    1,13,1,112,1,223,4,255,1,217,1,88,14,0,1,3,1,87,1,202,3,255,1,204,
+    15,0,1,24,1,130,1,246,2,255,1,204,13,0,1,46,1,159,1,249,3,255,1,254,
+    1,152,10,0,1,1,1,73,1,187,4,255,1,248,1,156,1,40,1,0,8,0,1,8,
+    1,101,1,214,4,255,1,238,1,134,1,24,3,0,6,0,1,23,1,130,1,235,4,255,
+    1,224,1,111,1,11,5,0,4,0,1,44,1,158,1,248,4,255,1,205,1,89,1,3,
+    7,0,1,0,1,1,1,72,1,186,5,255,1,183,1,66,10,0,1,100,1,213,4,255,
+    1,250,1,161,1,44,12,0,4,255,1,240,1,138,1,27,14,0,2,255,1,227,1,116,
+    1,14,16,0,1,209,1,93,1,5,18,0,21,0,3,0,1,1,1,57,1,127,1,176,
+    1,209,1,232,1,246,1,252,1,251,1,240,1,227,1,192,1,149,1,75,1,5,3,0,
+    2,0,1,47,1,209,13,255,1,222,1,62,2,0,1,0,1,25,1,231,15,255,1,244,
+    1,41,1,0,1,0,1,139,3,255,1,201,1,104,1,52,1,22,1,10,1,2,1,8,
+    1,19,1,46,1,94,1,188,3,255,1,171,1,0,1,0,1,230,2,255,1,192,1,1,
+    10,0,1,178,2,255,1,250,1,15,1,27,3,255,1,84,11,0,1,73,3,255,1,63,
+    1,69,3,255,1,30,11,0,1,23,3,255,1,103,1,85,2,255,1,254,1,2,12,0,
+    1,251,2,255,1,119,1,98,2,255,1,246,13,0,1,240,2,255,1,131,1,108,2,255,
+    1,241,13,0,1,247,2,255,1,126,16,0,1,15,3,255,1,111,16,0,1,67,3,255,
+    1,79,16,0,1,159,3,255,1,28,15,0,1,77,1,254,2,255,1,209,1,0,13,0,
+    1,29,1,145,1,252,3,255,1,101,1,0,10,0,1,3,1,81,1,185,1,253,4,255,
+    1,196,1,2,1,0,9,0,1,77,1,217,6,255,1,193,1,18,2,0,8,0,1,125,
+    5,255,1,254,1,194,1,89,1,2,3,0,7,0,1,39,1,253,3,255,1,243,1,138,
+    1,30,6,0,7,0,1,117,3,255,1,222,1,37,8,0,7,0,1,158,3,255,1,66,
+    9,0,7,0,1,177,2,255,1,239,10,0,7,0,1,185,2,255,1,209,10,0,21,0,
+    21,0,21,0,21,0,21,0,7,0,1,236,2,255,1,176,10,0,7,0,1,236,2,255,
+    1,176,10,0,7,0,1,236,2,255,1,176,10,0,7,0,1,236,2,255,1,176,10,0,
+    6,0,1,43,1,104,1,150,1,184,1,211,1,229,1,243,1,249,1,254,1,252,1,247,
+    1,235,1,218,1,193,1,158,1,112,1,49,5,0,3,0,1,2,1,103,1,216,17,255,
+    1,215,1,83,3,0,2,0,1,3,1,178,2,255,1,209,1,144,1,97,1,63,1,40,
+    1,22,1,10,1,5,1,1,1,3,1,7,1,17,1,32,1,54,1,87,1,135,1,207,
+    2,255,1,109,2,0,2,0,1,113,1,255,1,218,1,54,17,0,1,81,1,251,1,248,
+    1,27,1,0,1,0,1,2,1,228,1,254,1,45,19,0,1,153,1,255,1,126,1,0,
+    1,0,1,59,1,255,1,191,14,0,1,96,2,255,1,4,2,0,1,65,1,255,1,200,
+    1,0,1,0,1,122,1,255,1,124,5,0,1,41,1,150,1,213,1,241,1,251,1,238,
+    1,210,1,149,1,39,1,96,2,255,1,4,2,0,1,10,1,254,1,248,1,3,1,0,
+    1,168,1,255,1,76,4,0,1,78,1,249,7,255,1,250,1,162,2,255,1,4,3,0,
+    1,228,1,255,1,32,1,0,1,205,1,255,1,41,3,0,1,11,1,233,1,255,1,226,
+    1,96,1,32,1,8,1,7,1,41,1,130,1,249,3,255,1,4,3,0,1,203,1,255,
+    1,55,1,0,1,231,1,255,1,17,3,0,1,82,2,255,1,48,6,0,1,77,3,255,
+    1,4,3,0,1,188,1,255,1,70,1,0,1,250,1,254,1,1,3,0,1,140,1,255,
+    1,220,8,0,1,196,2,255,1,4,3,0,1,178,1,255,1,77,1,8,1,255,1,244,
+    4,0,1,176,1,255,1,181,8,0,1,131,2,255,1,4,3,0,1,173,1,255,1,76,
+    1,15,1,255,1,239,4,0,1,195,1,255,1,159,8,0,1,108,2,255,1,4,3,0,
+    1,176,1,255,1,71,1,18,1,255,1,236,4,0,1,204,1,255,1,151,8,0,1,109,
+    2,255,1,4,3,0,1,181,1,255,1,66,1,17,1,255,1,238,4,0,1,202,1,255,
+    1,152,8,0,1,114,2,255,1,4,3,0,1,195,1,255,1,53,1,12,1,255,1,243,
+    4,0,1,192,1,255,1,161,8,0,1,130,2,255,1,4,3,0,1,214,1,255,1,35,
+    1,3,1,255,1,253,4,0,1,170,1,255,1,185,8,0,1,153,2,255,1,5,2,0,
+    1,1,1,245,1,255,1,12,1,0,1,243,1,255,1,13,3,0,1,134,1,255,1,229,
+    8,0,1,197,2,255,1,17,2,0,1,38,1,255,1,229,1,0,1,0,1,221,1,255,
+    1,36,3,0,1,72,2,255,1,62,6,0,1,30,1,251,2,255,1,50,2,0,1,116,
+    1,255,1,181,1,0,1,0,1,191,1,255,1,66,3,0,1,7,1,226,1,255,1,232,
+    1,99,1,28,1,5,1,8,1,31,1,93,1,219,1,198,1,196,1,255,1,183,1,25,
+    1,43,1,233,1,255,1,105,1,0,1,0,1,151,1,255,1,107,4,0,1,69,1,247,
+    7,255,1,222,1,40,1,77,1,254,4,255,1,222,1,9,1,0,1,0,1,99,1,255,
+    1,164,5,0,1,37,1,149,1,214,1,242,1,250,1,230,1,196,1,117,1,15,2,0,
+    1,78,1,197,1,240,1,241,1,177,1,32,2,0,1,0,1,32,1,255,1,237,1,7,
+    23,0,2,0,1,196,1,255,1,115,23,0,2,0,1,67,1,255,1,251,1,124,1,13,
+    14,0,1,10,1,175,1,119,1,2,3,0,3,0,1,119,1,254,1,255,1,246,1,182,
+    1,127,1,87,1,57,1,34,1,19,1,8,1,3,1,0,1,4,1,15,1,38,1,76,
+    1,138,1,231,1,255,1,235,1,22,3,0,4,0,1,59,1,182,1,252,15,255,1,198,
+    1,41,4,0,6,0,1,18,1,81,1,131,1,172,1,201,1,223,1,238,1,248,1,253,
+    1,254,1,249,1,235,1,213,1,177,1,126,1,51,6,0,11,0,1,59,5,255,1,51,
+    11,0,11,0,1,153,5,255,1,147,11,0,10,0,1,7,1,239,5,255,1,236,1,6,
+    10,0,10,0,1,85,3,255,1,174,3,255,1,82,10,0,10,0,1,178,2,255,1,248,
+    1,19,1,228,2,255,1,178,10,0,9,0,1,20,1,250,2,255,1,169,1,0,1,136,
+    2,255,1,251,1,22,9,0,9,0,1,110,3,255,1,74,1,0,1,40,3,255,1,113,
+    9,0,9,0,1,204,2,255,1,231,1,3,2,0,1,200,2,255,1,208,9,0,8,0,
+    1,41,3,255,1,140,3,0,1,104,3,255,1,48,8,0,8,0,1,135,3,255,1,46,
+    3,0,1,16,1,247,2,255,1,144,8,0,7,0,1,2,1,226,2,255,1,207,5,0,
+    1,168,2,255,1,234,1,5,7,0,7,0,1,67,3,255,1,112,5,0,1,72,3,255,
+    1,79,7,0,7,0,1,160,2,255,1,251,1,22,5,0,1,3,1,229,2,255,1,175,
+    7,0,6,0,1,10,1,243,2,255,1,178,7,0,1,136,2,255,1,250,1,20,6,0,
+    6,0,1,92,3,255,1,83,7,0,1,40,3,255,1,110,6,0,6,0,1,186,2,255,
+    1,237,1,6,8,0,1,200,2,255,1,205,6,0,5,0,1,25,1,253,2,255,1,149,
+    9,0,1,104,3,255,1,45,5,0,5,0,1,117,3,255,1,54,9,0,1,16,1,247,
+    2,255,1,141,5,0,5,0,1,210,2,255,1,215,11,0,1,168,2,255,1,232,1,4,
+    4,0,4,0,1,49,3,255,1,120,11,0,1,72,3,255,1,76,4,0,4,0,1,142,
+    2,255,1,253,1,28,11,0,1,3,1,229,2,255,1,172,4,0,3,0,1,3,1,231,
+    2,255,1,187,13,0,1,136,2,255,1,249,1,18,3,0,3,0,1,74,21,255,1,107,
+    3,0,3,0,1,168,21,255,1,202,3,0,2,0,1,14,1,246,22,255,1,42,2,0,
+    2,0,1,99,3,255,1,86,15,0,1,28,1,254,2,255,1,138,2,0,2,0,1,193,
+    2,255,1,243,1,9,16,0,1,192,2,255,1,230,1,3,1,0,1,0,1,31,1,254,
+    2,255,1,163,17,0,1,101,3,255,1,73,1,0,1,0,1,124,3,255,1,73,17,0,
+    1,17,1,249,2,255,1,169,1,0,1,0,1,217,2,255,1,235,1,4,18,0,1,175,
+    2,255,1,248,1,16,1,56,3,255,1,150,19,0,1,84,3,255,1,104,1,149,3,255,
+    1,60,19,0,1,8,1,241,2,255,1,200,1,244,13,255,1,254,1,248,1,235,1,212,
+    1,178,1,125,1,45,4,0,1,244,20,255,1,170,1,6,2,0,1,244,21,255,1,144,
+    2,0,1,244,2,255,1,168,10,0,1,3,1,12,1,35,1,75,1,157,1,252,2,255,
+    1,247,1,16,1,0,1,244,2,255,1,168,15,0,1,116,3,255,1,84,1,0,1,244,
+    2,255,1,168,15,0,1,11,1,250,2,255,1,129,1,0,1,244,2,255,1,168,16,0,
+    1,212,2,255,1,160,1,0,1,244,2,255,1,168,16,0,1,192,2,255,1,172,1,0,
+    1,244,2,255,1,168,16,0,1,188,2,255,1,180,1,0,1,244,2,255,1,168,16,0,
+    1,201,2,255,1,167,1,0,1,244,2,255,1,168,16,0,1,236,2,255,1,131,1,0,
+    1,244,2,255,1,168,15,0,1,44,3,255,1,62,1,0,1,244,2,255,1,168,14,0,
+    1,1,1,174,2,255,1,204,2,0,1,244,2,255,1,168,9,0,1,2,1,10,1,26,
+    1,57,1,111,1,206,2,255,1,236,1,41,2,0,1,244,19,255,1,183,1,35,3,0,
+    1,244,18,255,1,237,1,137,1,28,3,0,1,244,20,255,1,246,1,92,2,0,1,244,
+    2,255,1,168,9,0,1,2,1,6,1,16,1,34,1,62,1,108,1,190,2,255,1,253,
+    1,72,1,0,1,244,2,255,1,168,16,0,1,163,2,255,1,219,1,2,1,244,2,255,
+    1,168,16,0,1,45,3,255,1,64,1,244,2,255,1,168,17,0,1,243,2,255,1,125,
+    1,244,2,255,1,168,17,0,1,209,2,255,1,161,1,244,2,255,1,168,17,0,1,197,
+    2,255,1,175,1,244,2,255,1,168,17,0,1,191,2,255,1,169,1,244,2,255,1,168,
+    17,0,1,203,2,255,1,155,1,244,2,255,1,168,17,0,1,236,2,255,1,128,1,244,
+    2,255,1,168,16,0,1,45,3,255,1,80,1,244,2,255,1,168,15,0,1,3,1,178,
+    2,255,1,248,1,18,1,244,2,255,1,168,8,0,1,2,1,5,1,8,1,15,1,28,
+    1,59,1,113,1,210,3,255,1,165,1,0,1,244,21,255,1,234,1,24,1,0,1,244,
+    20,255,1,205,1,37,2,0,1,244,15,255,1,245,1,231,1,199,1,147,1,67,4,0,
+    6,0,1,26,1,87,1,135,1,170,1,198,1,219,1,234,1,245,1,250,1,254,1,248,
+    1,237,1,224,1,190,1,151,1,86,1,11,4,0,4,0,1,79,1,199,16,255,1,244,
+    1,115,1,2,2,0,2,0,1,3,1,151,20,255,1,135,2,0,2,0,1,151,3,255,
+    1,251,1,184,1,122,1,81,1,53,1,33,1,18,1,9,1,4,1,1,1,7,1,17,
+    1,44,1,86,1,165,1,253,3,255,1,42,1,0,1,0,1,65,3,255,1,227,1,38,
+    14,0,1,91,3,255,1,144,1,0,1,0,1,169,3,255,1,90,16,0,1,216,2,255,
+    1,207,1,0,1,0,1,223,2,255,1,248,1,9,16,0,1,154,2,255,1,250,1,5,
+    1,0,1,250,2,255,1,203,17,0,1,119,3,255,1,23,1,13,3,255,1,169,17,0,
+    1,107,3,255,1,37,1,27,3,255,1,148,17,0,1,98,3,255,1,50,1,37,3,255,
+    1,139,22,0,1,45,3,255,1,136,22,0,1,50,3,255,1,137,22,0,1,53,3,255,
+    1,138,22,0,1,56,3,255,1,140,22,0,1,56,3,255,1,145,22,0,1,54,3,255,
+    1,150,22,0,1,51,3,255,1,156,22,0,1,46,3,255,1,166,22,0,1,36,3,255,
+    1,176,22,0,1,23,3,255,1,189,22,0,1,5,3,255,1,205,18,0,1,245,2,255,
+    1,156,1,0,1,238,2,255,1,226,18,0,1,238,2,255,1,154,1,0,1,207,2,255,
+    1,249,1,1,17,0,1,244,2,255,1,148,1,0,1,170,3,255,1,29,16,0,1,3,
+    3,255,1,133,1,0,1,121,3,255,1,75,16,0,1,44,3,255,1,108,1,0,1,59,
+    3,255,1,152,16,0,1,116,3,255,1,69,1,0,1,3,1,230,2,255,1,252,1,96,
+    14,0,1,33,1,232,2,255,1,251,1,15,2,0,1,118,4,255,1,211,1,128,1,73,
+    1,38,1,16,1,5,1,1,1,2,1,7,1,17,1,34,1,58,1,96,1,154,1,241,
+    3,255,1,180,1,0,2,0,1,5,1,182,20,255,1,249,1,49,1,0,3,0,1,3,
+    1,113,1,231,17,255,1,212,1,66,2,0,5,0,1,3,1,65,1,127,1,174,1,208,
+    1,230,1,246,1,252,1,255,1,252,1,247,1,238,1,225,1,207,1,182,1,149,1,105,
+    1,44,4,0,1,244,14,255,1,250,1,241,1,219,1,185,1,136,1,68,1,2,5,0,
+    1,244,20,255,1,225,1,96,4,0,1,244,22,255,1,161,1,2,2,0,1,244,2,255,
+    1,168,11,0,1,11,1,26,1,51,1,106,1,180,4,255,1,124,2,0,1,244,2,255,
+    1,168,16,0,1,54,1,234,2,255,1,245,1,22,1,0,1,244,2,255,1,168,17,0,
+    1,57,3,255,1,116,1,0,1,244,2,255,1,168,18,0,1,200,2,255,1,195,1,0,
+    1,244,2,255,1,168,18,0,1,131,2,255,1,249,1,7,1,244,2,255,1,168,18,0,
+    1,83,3,255,1,47,1,244,2,255,1,168,18,0,1,46,3,255,1,82,1,244,2,255,
+    1,168,18,0,1,19,3,255,1,110,1,244,2,255,1,168,18,0,1,1,1,253,2,255,
+    1,129,1,244,2,255,1,168,19,0,1,239,2,255,1,143,1,244,2,255,1,168,19,0,
+    1,229,2,255,1,150,1,244,2,255,1,168,19,0,1,222,2,255,1,154,1,244,2,255,
+    1,168,19,0,1,219,2,255,1,152,1,244,2,255,1,168,19,0,1,217,2,255,1,148,
+    1,244,2,255,1,168,19,0,1,220,2,255,1,142,1,244,2,255,1,168,19,0,1,225,
+    2,255,1,130,1,244,2,255,1,168,19,0,1,237,2,255,1,117,1,244,2,255,1,168,
+    18,0,1,1,1,251,2,255,1,96,1,244,2,255,1,168,18,0,1,19,3,255,1,73,
+    1,244,2,255,1,168,18,0,1,51,3,255,1,42,1,244,2,255,1,168,18,0,1,94,
+    2,255,1,252,1,9,1,244,2,255,1,168,18,0,1,152,2,255,1,214,1,0,1,244,
+    2,255,1,168,17,0,1,3,1,229,2,255,1,154,1,0,1,244,2,255,1,168,17,0,
+    1,104,3,255,1,81,1,0,1,244,2,255,1,168,15,0,1,1,1,98,1,249,2,255,
+    1,234,1,6,1,0,1,244,2,255,1,168,10,0,1,2,1,11,1,32,1,69,1,126,
+    1,214,4,255,1,107,2,0,1,244,22,255,1,162,1,1,2,0,1,244,20,255,1,238,
+    1,111,1,1,3,0,1,244,15,255,1,250,1,237,1,208,1,161,1,92,1,12,5,0,
+    1,60,20,255,1,80,1,60,20,255,1,80,1,60,20,255,1,80,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,19,255,1,156,1,0,1,60,19,255,1,156,
+    1,0,1,60,19,255,1,156,1,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,17,0,1,60,3,255,1,96,
+    17,0,1,60,3,255,1,96,17,0,1,60,20,255,1,80,1,60,20,255,1,80,1,60,
+    20,255,1,80,1,244,18,255,1,172,1,244,18,255,1,172,1,244,18,255,1,172,1,244,
+    2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,
+    2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,
+    2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,
+    2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,18,255,1,64,1,244,18,255,
+    1,64,1,244,18,255,1,64,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,
+    1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,
+    1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,
+    1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,
+    1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,1,244,2,255,1,168,16,0,
+    1,244,2,255,1,168,16,0,6,0,1,41,1,105,1,152,1,188,1,215,1,232,1,246,
+    1,251,1,254,1,251,1,246,1,237,1,223,1,204,1,177,1,141,1,93,1,28,4,0,
+    3,0,1,1,1,95,1,212,17,255,1,254,1,178,1,20,2,0,2,0,1,6,1,175,
+    21,255,1,214,1,7,1,0,2,0,1,137,3,255,1,243,1,163,1,100,1,59,1,32,
+    1,15,1,4,1,1,1,2,1,6,1,13,1,24,1,41,1,66,1,103,1,166,1,251,
+    3,255,1,111,1,0,1,0,1,26,1,249,2,255,1,199,1,22,15,0,1,75,3,255,
+    1,195,1,0,1,0,1,116,2,255,1,254,1,40,17,0,1,193,2,255,1,249,1,4,
+    1,0,1,185,2,255,1,202,18,0,1,130,3,255,1,21,1,0,1,236,2,255,1,145,
+    18,0,1,105,3,255,1,38,1,14,3,255,1,108,18,0,1,92,3,255,1,44,1,37,
+    3,255,1,84,23,0,1,50,3,255,1,70,23,0,1,55,3,255,1,65,23,0,1,58,
+    3,255,1,61,23,0,1,59,3,255,1,58,23,0,1,60,3,255,1,55,23,0,1,59,
+    3,255,1,53,23,0,1,58,3,255,1,52,8,0,1,136,13,255,1,49,1,57,3,255,
+    1,54,8,0,1,136,13,255,1,60,1,56,3,255,1,56,8,0,1,136,13,255,1,64,
+    1,54,3,255,1,58,18,0,1,77,3,255,1,66,1,49,3,255,1,60,18,0,1,51,
+    3,255,1,63,1,38,3,255,1,64,18,0,1,47,3,255,1,57,1,21,3,255,1,76,
+    18,0,1,54,3,255,1,44,1,1,1,249,2,255,1,99,18,0,1,69,3,255,1,27,
+    1,0,1,217,2,255,1,136,18,0,1,97,2,255,1,253,1,4,1,0,1,170,2,255,
+    1,194,18,0,1,142,2,255,1,222,1,0,1,0,1,108,2,255,1,253,1,35,17,0,
+    1,215,2,255,1,175,1,0,1,0,1,26,1,252,2,255,1,197,1,22,15,0,1,106,
+    3,255,1,110,1,0,2,0,1,160,3,255,1,246,1,174,1,115,1,76,1,47,1,27,
+    1,14,1,5,1,1,1,0,1,4,1,14,1,33,1,64,1,112,1,192,3,255,1,249,
+    1,25,1,0,2,0,1,17,1,210,21,255,1,132,2,0,3,0,1,11,1,131,1,235,
+    17,255,1,230,1,109,1,1,2,0,5,0,1,5,1,62,1,121,1,166,1,198,1,222,
+    1,239,1,249,2,254,1,251,1,244,1,232,1,215,1,191,1,159,1,116,1,58,1,2,
+    4,0,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,
+    1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,
+    1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,
+    1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,
+    2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,
+    18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,
+    2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,
+    1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,
+    1,164,2,255,1,248,1,244,24,255,1,248,1,244,24,255,1,248,1,244,24,255,1,248,
+    1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,
+    2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,
+    18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,
+    2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,
+    1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,
+    1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,
+    1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,
+    1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,18,0,1,164,
+    2,255,1,248,1,244,2,255,1,168,18,0,1,164,2,255,1,248,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,
+    1,244,2,255,1,168,1,244,2,255,1,168,1,244,2,255,1,168,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,1,12,16,0,1,144,3,255,
+    1,12,16,0,1,144,3,255,1,12,1,180,2,255,1,220,12,0,1,144,3,255,1,12,
+    1,186,2,255,1,220,12,0,1,144,3,255,1,12,1,190,2,255,1,220,12,0,1,151,
+    3,255,1,8,1,191,2,255,1,223,12,0,1,159,2,255,1,252,1,0,1,181,2,255,
+    1,232,12,0,1,183,2,255,1,239,1,0,1,165,2,255,1,252,1,5,11,0,1,217,
+    2,255,1,206,1,0,1,128,3,255,1,47,10,0,1,25,3,255,1,160,1,0,1,69,
+    3,255,1,144,10,0,1,150,3,255,1,89,1,0,1,3,1,221,2,255,1,254,1,163,
+    1,79,1,37,1,13,2,4,1,14,1,41,1,91,1,186,3,255,1,236,1,8,1,0,
+    1,0,1,74,1,252,15,255,1,83,2,0,2,0,1,76,1,224,12,255,1,232,1,80,
+    3,0,3,0,1,5,1,71,1,143,1,186,1,222,1,238,1,248,1,252,1,241,1,228,
+    1,195,1,150,1,80,1,5,4,0,1,244,2,255,1,168,15,0,1,133,3,255,1,240,
+    1,49,2,0,1,244,2,255,1,168,14,0,1,116,3,255,1,244,1,59,3,0,1,244,
+    2,255,1,168,13,0,1,101,3,255,1,248,1,68,4,0,1,244,2,255,1,168,12,0,
+    1,86,1,253,2,255,1,251,1,79,5,0,1,244,2,255,1,168,11,0,1,73,1,250,
+    2,255,1,253,1,90,6,0,1,244,2,255,1,168,10,0,1,61,1,246,3,255,1,102,
+    7,0,1,244,2,255,1,168,9,0,1,50,1,241,3,255,1,115,8,0,1,244,2,255,
+    1,168,8,0,1,41,1,235,3,255,1,128,9,0,1,244,2,255,1,168,7,0,1,32,
+    1,228,3,255,1,142,10,0,1,244,2,255,1,168,6,0,1,24,1,219,3,255,1,154,
+    11,0,1,244,2,255,1,168,5,0,1,17,1,210,3,255,1,167,1,2,11,0,1,244,
+    2,255,1,168,4,0,1,12,1,200,3,255,1,177,1,4,12,0,1,244,2,255,1,168,
+    3,0,1,7,1,188,3,255,1,188,1,7,13,0,1,244,2,255,1,168,2,0,1,3,
+    1,176,3,255,1,198,1,11,14,0,1,244,9,255,1,207,1,16,15,0,1,244,9,255,
+    1,58,16,0,1,244,9,255,1,228,1,36,15,0,1,244,2,255,1,168,2,0,1,4,
+    1,171,3,255,1,227,1,35,14,0,1,244,2,255,1,168,3,0,1,5,1,176,3,255,
+    1,226,1,33,13,0,1,244,2,255,1,168,4,0,1,6,1,182,3,255,1,225,1,32,
+    12,0,1,244,2,255,1,168,5,0,1,8,1,186,3,255,1,223,1,31,11,0,1,244,
+    2,255,1,168,6,0,1,9,1,191,3,255,1,222,1,30,10,0,1,244,2,255,1,168,
+    7,0,1,11,1,195,3,255,1,221,1,28,9,0,1,244,2,255,1,168,8,0,1,13,
+    1,200,3,255,1,220,1,27,8,0,1,244,2,255,1,168,9,0,1,15,1,204,3,255,
+    1,219,1,26,7,0,1,244,2,255,1,168,10,0,1,18,1,208,3,255,1,217,1,25,
+    6,0,1,244,2,255,1,168,11,0,1,20,1,212,3,255,1,216,1,24,5,0,1,244,
+    2,255,1,168,12,0,1,23,1,216,3,255,1,214,1,23,4,0,1,244,2,255,1,168,
+    13,0,1,26,1,219,3,255,1,213,1,22,3,0,1,244,2,255,1,168,14,0,1,29,
+    1,223,3,255,1,212,1,21,2,0,1,244,2,255,1,168,15,0,1,32,1,226,3,255,
+    1,210,1,20,1,0,1,244,2,255,1,168,16,0,1,36,1,229,3,255,1,209,1,19,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,
+    1,244,2,255,1,168,17,0,1,244,2,255,1,168,17,0,1,244,19,255,1,28,1,244,
+    19,255,1,28,1,244,19,255,1,28,1,244,5,255,1,131,21,0,1,100,6,255,1,40,
+    1,244,5,255,1,231,1,5,20,0,1,204,6,255,1,40,1,244,6,255,1,84,19,0,
+    1,51,3,255,1,243,3,255,1,40,1,244,2,255,1,191,1,254,2,255,1,189,19,0,
+    1,156,3,255,1,159,3,255,1,40,1,244,2,255,1,166,1,191,2,255,1,254,1,38,
+    17,0,1,14,1,244,2,255,1,210,1,114,3,255,1,40,1,244,2,255,1,168,1,87,
+    3,255,1,142,17,0,1,107,3,255,1,110,1,116,3,255,1,40,1,244,2,255,1,168,
+    1,5,1,231,2,255,1,237,1,8,16,0,1,210,2,255,1,245,1,16,1,116,3,255,
+    1,40,1,244,2,255,1,168,1,0,1,129,3,255,1,95,15,0,1,59,3,255,1,155,
+    1,0,1,116,3,255,1,40,1,244,2,255,1,168,1,0,1,25,1,250,2,255,1,199,
+    15,0,1,163,3,255,1,49,1,0,1,116,3,255,1,40,1,244,2,255,1,168,2,0,
+    1,169,3,255,1,48,13,0,1,18,1,247,2,255,1,199,2,0,1,116,3,255,1,40,
+    1,244,2,255,1,168,2,0,1,61,3,255,1,152,13,0,1,114,3,255,1,92,2,0,
+    1,116,3,255,1,40,1,244,2,255,1,168,3,0,1,208,2,255,1,243,1,13,12,0,
+    1,216,2,255,1,235,1,7,2,0,1,116,3,255,1,40,1,244,2,255,1,168,3,0,
+    1,101,3,255,1,105,11,0,1,66,3,255,1,136,3,0,1,116,3,255,1,40,1,244,
+    2,255,1,168,3,0,1,10,1,238,2,255,1,209,11,0,1,170,2,255,1,253,1,32,
+    3,0,1,116,3,255,1,40,1,244,2,255,1,168,4,0,1,141,3,255,1,58,9,0,
+    1,23,1,250,2,255,1,179,4,0,1,116,3,255,1,40,1,244,2,255,1,168,4,0,
+    1,35,1,253,2,255,1,162,9,0,1,122,3,255,1,73,4,0,1,116,3,255,1,40,
+    1,244,2,255,1,168,5,0,1,181,2,255,1,247,1,19,7,0,1,2,1,223,2,255,
+    1,221,1,1,4,0,1,116,3,255,1,40,1,244,2,255,1,168,5,0,1,73,3,255,
+    1,115,7,0,1,73,3,255,1,116,5,0,1,116,3,255,1,40,1,244,2,255,1,168,
+    5,0,1,1,1,219,2,255,1,219,1,1,6,0,1,177,2,255,1,247,1,18,5,0,
+    1,116,3,255,1,40,1,244,2,255,1,168,6,0,1,114,3,255,1,68,5,0,1,28,
+    1,252,2,255,1,160,6,0,1,116,3,255,1,40,1,244,2,255,1,168,6,0,1,16,
+    1,245,2,255,1,173,5,0,1,128,3,255,1,54,6,0,1,116,3,255,1,40,1,244,
+    2,255,1,168,7,0,1,154,2,255,1,251,1,26,3,0,1,5,1,229,2,255,1,203,
+    7,0,1,116,3,255,1,40,1,244,2,255,1,168,7,0,1,46,3,255,1,128,3,0,
+    1,88,3,255,1,97,7,0,1,116,3,255,1,40,1,244,2,255,1,168,8,0,1,194,
+    2,255,1,230,1,4,2,0,1,197,2,255,1,238,1,9,7,0,1,116,3,255,1,40,
+    1,244,2,255,1,168,8,0,1,86,3,255,1,84,1,0,1,46,3,255,1,140,8,0,
+    1,116,3,255,1,40,1,244,2,255,1,168,8,0,1,4,1,229,2,255,1,189,1,0,
+    1,149,2,255,1,254,1,36,8,0,1,116,3,255,1,40,1,244,2,255,1,168,9,0,
+    1,126,2,255,1,254,1,50,1,241,2,255,1,184,9,0,1,116,3,255,1,40,1,244,
+    2,255,1,168,9,0,1,23,1,249,2,255,1,224,3,255,1,78,9,0,1,116,3,255,
+    1,40,1,244,2,255,1,168,10,0,1,166,5,255,1,224,1,2,9,0,1,116,3,255,
+    1,40,1,244,2,255,1,168,10,0,1,58,5,255,1,121,10,0,1,116,3,255,1,40,
+    1,244,2,255,1,168,11,0,1,206,3,255,1,249,1,22,10,0,1,116,3,255,1,40,
+    1,244,2,255,1,168,11,0,1,98,3,255,1,165,11,0,1,116,3,255,1,40,1,244,
+    5,255,1,65,16,0,1,60,3,255,1,96,1,244,5,255,1,214,1,5,15,0,1,60,
+    3,255,1,96,1,244,6,255,1,119,15,0,1,60,3,255,1,96,1,244,2,255,1,197,
+    1,250,2,255,1,244,1,29,14,0,1,60,3,255,1,96,1,244,2,255,1,163,1,140,
+    3,255,1,173,14,0,1,60,3,255,1,96,1,244,2,255,1,166,1,14,1,232,3,255,
+    1,72,13,0,1,60,3,255,1,96,1,244,2,255,1,168,1,0,1,98,3,255,1,219,
+    1,7,12,0,1,60,3,255,1,96,1,244,2,255,1,168,1,0,1,2,1,202,3,255,
+    1,127,12,0,1,60,3,255,1,96,1,244,2,255,1,168,2,0,1,54,1,254,2,255,
+    1,247,1,34,11,0,1,60,3,255,1,96,1,244,2,255,1,168,3,0,1,157,3,255,
+    1,181,11,0,1,60,3,255,1,96,1,244,2,255,1,168,3,0,1,21,1,238,3,255,
+    1,80,10,0,1,60,3,255,1,96,1,244,2,255,1,168,4,0,1,101,3,255,1,225,
+    1,10,9,0,1,60,3,255,1,96,1,244,2,255,1,168,4,0,1,1,1,195,3,255,
+    1,134,9,0,1,60,3,255,1,96,1,244,2,255,1,168,5,0,1,42,1,249,2,255,
+    1,249,1,39,8,0,1,60,3,255,1,96,1,244,2,255,1,168,6,0,1,132,3,255,
+    1,188,8,0,1,60,3,255,1,96,1,244,2,255,1,168,6,0,1,8,1,219,3,255,
+    1,88,7,0,1,60,3,255,1,96,1,244,2,255,1,168,7,0,1,67,3,255,1,229,
+    1,13,6,0,1,60,3,255,1,96,1,244,2,255,1,168,8,0,1,163,3,255,1,142,
+    6,0,1,60,3,255,1,96,1,244,2,255,1,168,8,0,1,21,1,237,2,255,1,251,
+    1,45,5,0,1,60,3,255,1,96,1,244,2,255,1,168,9,0,1,98,3,255,1,196,
+    1,1,4,0,1,60,3,255,1,96,1,244,2,255,1,168,10,0,1,192,3,255,1,99,
+    4,0,1,60,3,255,1,96,1,244,2,255,1,168,10,0,1,39,1,249,2,255,1,237,
+    1,20,3,0,1,60,3,255,1,96,1,244,2,255,1,168,11,0,1,128,3,255,1,160,
+    3,0,1,60,3,255,1,96,1,244,2,255,1,168,11,0,1,7,1,216,3,255,1,63,
+    2,0,1,60,3,255,1,96,1,244,2,255,1,168,12,0,1,64,3,255,1,215,1,6,
+    1,0,1,60,3,255,1,96,1,244,2,255,1,168,13,0,1,159,3,255,1,125,1,0,
+    1,60,3,255,1,96,1,244,2,255,1,168,13,0,1,19,1,235,2,255,1,247,1,36,
+    1,59,3,255,1,96,1,244,2,255,1,168,14,0,1,94,3,255,1,184,1,55,3,255,
+    1,96,1,244,2,255,1,168,15,0,1,189,3,255,1,134,3,255,1,96,1,244,2,255,
+    1,168,15,0,1,37,1,247,2,255,1,251,3,255,1,96,1,244,2,255,1,168,16,0,
+    1,125,6,255,1,96,1,244,2,255,1,168,16,0,1,6,1,214,5,255,1,96,5,0,
+    1,5,1,62,1,122,1,166,1,199,1,223,1,239,1,249,1,254,1,251,1,246,1,235,
+    1,219,1,194,1,162,1,118,1,61,1,4,5,0,3,0,1,19,1,139,1,236,16,255,
+    1,235,1,133,1,13,3,0,2,0,1,54,1,232,20,255,1,216,1,23,2,0,1,0,
+    1,27,1,236,2,255,1,251,1,184,1,119,1,75,1,46,1,25,1,12,1,5,1,1,
+    1,3,1,9,1,21,1,40,1,69,1,110,1,172,1,247,3,255,1,167,2,0,1,0,
+    1,160,2,255,1,228,1,41,15,0,1,24,1,200,2,255,1,253,1,28,1,0,1,18,
+    1,249,2,255,1,110,17,0,1,25,1,248,2,255,1,106,1,0,1,88,3,255,1,39,
+    18,0,1,166,2,255,1,166,1,0,1,142,2,255,1,248,1,2,18,0,1,105,2,255,
+    1,214,1,0,1,179,2,255,1,217,19,0,1,61,2,255,1,248,1,2,1,202,2,255,
+    1,193,19,0,1,43,3,255,1,22,1,212,2,255,1,176,19,0,1,30,3,255,1,45,
+    1,217,2,255,1,162,19,0,1,23,3,255,1,62,1,222,2,255,1,153,19,0,1,22,
+    3,255,1,74,1,226,2,255,1,146,19,0,1,20,3,255,1,83,1,228,2,255,1,143,
+    19,0,1,20,3,255,1,87,1,228,2,255,1,140,19,0,1,20,3,255,1,90,1,227,
+    2,255,1,141,19,0,1,22,3,255,1,88,1,224,2,255,1,143,19,0,1,24,3,255,
+    1,85,1,220,2,255,1,146,19,0,1,28,3,255,1,79,1,212,2,255,1,153,19,0,
+    1,35,3,255,1,68,1,200,2,255,1,162,19,0,1,43,3,255,1,57,1,183,2,255,
+    1,176,19,0,1,58,3,255,1,38,1,162,2,255,1,193,19,0,1,75,3,255,1,17,
+    1,134,2,255,1,217,19,0,1,99,2,255,1,244,1,0,1,99,2,255,1,248,1,2,
+    18,0,1,132,2,255,1,210,1,0,1,54,3,255,1,39,18,0,1,178,2,255,1,164,
+    1,0,1,7,1,245,2,255,1,108,17,0,1,7,1,240,2,255,1,107,1,0,1,0,
+    1,176,2,255,1,227,1,38,15,0,1,4,1,145,2,255,1,254,1,33,1,0,1,0,
+    1,69,3,255,1,251,1,181,1,117,1,74,1,44,1,24,1,11,1,3,1,0,1,2,
+    1,6,1,17,1,34,1,59,1,95,1,148,1,227,3,255,1,180,2,0,2,0,1,148,
+    21,255,1,228,1,33,2,0,3,0,1,88,1,208,17,255,1,243,1,148,1,21,3,0,
+    5,0,1,38,1,101,1,148,1,184,1,211,1,230,1,244,1,251,1,254,1,253,1,248,
+    1,238,1,221,1,198,1,168,1,125,1,69,1,8,5,0,1,244,14,255,1,245,1,231,
+    1,207,1,160,1,97,1,11,4,0,1,244,19,255,1,242,1,97,3,0,1,244,21,255,
+    1,99,2,0,1,244,2,255,1,168,10,0,1,3,1,13,1,28,1,67,1,143,1,248,
+    2,255,1,242,1,13,1,0,1,244,2,255,1,168,15,0,1,75,3,255,1,96,1,0,
+    1,244,2,255,1,168,16,0,1,218,2,255,1,164,1,0,1,244,2,255,1,168,16,0,
+    1,160,2,255,1,208,1,0,1,244,2,255,1,168,16,0,1,129,2,255,1,240,1,0,
+    1,244,2,255,1,168,16,0,1,113,2,255,1,252,1,0,1,244,2,255,1,168,16,0,
+    1,104,3,255,1,8,1,244,2,255,1,168,16,0,1,108,2,255,1,254,1,2,1,244,
+    2,255,1,168,16,0,1,123,2,255,1,243,1,0,1,244,2,255,1,168,16,0,1,164,
+    2,255,1,218,1,0,1,244,2,255,1,168,15,0,1,6,1,231,2,255,1,171,1,0,
+    1,244,2,255,1,168,15,0,1,135,3,255,1,107,1,0,1,244,2,255,1,168,8,0,
+    1,1,1,8,1,16,1,38,1,67,1,119,1,203,3,255,1,245,1,16,1,0,1,244,
+    21,255,1,102,2,0,1,244,19,255,1,238,1,96,3,0,1,244,12,255,1,254,1,249,
+    1,238,1,225,1,195,1,151,1,85,1,8,4,0,1,244,2,255,1,168,21,0,1,244,
+    2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,
+    2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,
+    2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,
+    2,255,1,168,21,0,1,244,2,255,1,168,21,0,1,244,2,255,1,168,21,0,5,0,
+    1,22,1,89,1,138,1,177,1,207,1,226,1,241,1,249,1,254,1,251,1,246,1,235,
+    1,219,1,194,1,162,1,118,1,61,1,4,7,0,3,0,1,57,1,185,1,254,16,255,
+    1,235,1,133,1,13,5,0,2,0,1,105,1,253,20,255,1,216,1,24,4,0,1,0,
+    1,42,1,251,2,255,1,252,1,186,1,120,1,76,1,47,1,25,1,12,1,5,1,1,
+    1,3,1,7,1,19,1,34,1,59,1,95,1,148,1,226,3,255,1,169,4,0,1,0,
+    1,158,2,255,1,232,1,45,15,0,1,4,1,137,2,255,1,253,1,30,3,0,1,3,
+    1,239,2,255,1,118,17,0,1,4,1,236,2,255,1,109,3,0,1,50,3,255,1,47,
+    18,0,1,176,2,255,1,170,3,0,1,98,2,255,1,252,1,6,18,0,1,134,2,255,
+    1,219,3,0,1,137,2,255,1,225,19,0,1,104,2,255,1,251,1,4,2,0,1,165,
+    2,255,1,201,19,0,1,82,3,255,1,28,2,0,1,188,2,255,1,184,19,0,1,63,
+    3,255,1,51,2,0,1,203,2,255,1,170,19,0,1,51,3,255,1,68,2,0,1,214,
+    2,255,1,161,19,0,1,39,3,255,1,80,2,0,1,220,2,255,1,154,19,0,1,32,
+    3,255,1,90,2,0,1,223,2,255,1,151,19,0,1,26,3,255,1,94,2,0,1,222,
+    2,255,1,148,19,0,1,20,3,255,1,98,2,0,1,219,2,255,1,149,19,0,1,19,
+    3,255,1,98,2,0,1,215,2,255,1,151,19,0,1,17,3,255,1,96,2,0,1,207,
+    2,255,1,154,10,0,1,60,1,68,7,0,1,18,3,255,1,93,2,0,1,198,2,255,
+    1,161,9,0,1,15,1,225,1,255,1,157,1,16,5,0,1,21,3,255,1,88,2,0,
+    1,184,2,255,1,170,9,0,1,142,3,255,1,230,1,81,4,0,1,27,3,255,1,81,
+    2,0,1,167,2,255,1,184,9,0,1,12,1,146,1,253,3,255,1,171,1,23,2,0,
+    1,36,3,255,1,70,2,0,1,146,2,255,1,201,11,0,1,56,1,213,3,255,1,237,
+    1,94,1,0,1,54,3,255,1,57,2,0,1,118,2,255,1,225,12,0,1,6,1,128,
+    1,249,3,255,1,183,1,113,3,255,1,38,2,0,1,85,2,255,1,252,1,5,13,0,
+    1,42,1,199,7,255,1,13,2,0,1,43,3,255,1,47,14,0,1,2,1,110,1,243,
+    4,255,1,231,3,0,1,3,1,241,2,255,1,116,16,0,1,30,1,185,3,255,1,248,
+    1,118,1,3,1,0,1,0,1,174,2,255,1,231,1,42,15,0,1,37,1,197,5,255,
+    1,203,1,46,1,0,1,74,3,255,1,251,1,183,1,118,1,75,1,45,1,24,1,10,
+    1,3,1,0,1,3,1,9,1,23,1,45,1,77,1,123,1,190,1,253,3,255,1,235,
+    3,255,1,191,2,0,1,163,21,255,1,198,1,21,1,74,1,225,1,252,1,47,2,0,
+    1,1,1,100,1,217,17,255,1,209,1,98,1,3,2,0,1,12,1,80,1,0,5,0,
+    1,44,1,105,1,152,1,185,1,212,1,230,1,244,1,251,1,254,1,252,1,245,1,233,
+    1,214,1,186,1,149,1,99,1,36,8,0,1,244,14,255,1,252,1,239,1,223,1,181,
+    1,130,1,42,4,0,1,244,20,255,1,176,1,21,2,0,1,244,21,255,1,215,1,12,
+    1,0,1,244,2,255,1,168,11,0,1,3,1,15,1,46,1,104,1,214,3,255,1,143,
+    1,0,1,244,2,255,1,168,15,0,1,10,1,205,2,255,1,241,1,11,1,244,2,255,
+    1,168,16,0,1,83,3,255,1,67,1,244,2,255,1,168,16,0,1,16,3,255,1,118,
+    1,244,2,255,1,168,17,0,1,235,2,255,1,144,1,244,2,255,1,168,17,0,1,214,
+    2,255,1,158,1,244,2,255,1,168,17,0,1,205,2,255,1,163,1,244,2,255,1,168,
+    17,0,1,208,2,255,1,154,1,244,2,255,1,168,17,0,1,225,2,255,1,137,1,244,
+    2,255,1,168,16,0,1,17,3,255,1,105,1,244,2,255,1,168,16,0,1,105,3,255,
+    1,51,1,244,2,255,1,168,15,0,1,43,1,236,2,255,1,222,1,2,1,244,2,255,
+    1,168,10,0,1,4,1,14,1,39,1,81,1,156,1,248,2,255,1,253,1,79,1,0,
+    1,244,20,255,1,218,1,73,2,0,1,244,18,255,1,205,1,93,1,1,3,0,1,244,
+    20,255,1,194,1,39,2,0,1,244,2,255,1,168,12,0,1,15,1,65,1,178,3,255,
+    1,234,1,26,1,0,1,244,2,255,1,168,15,0,1,148,3,255,1,156,1,0,1,244,
+    2,255,1,168,15,0,1,9,1,237,2,255,1,240,1,1,1,244,2,255,1,168,16,0,
+    1,161,3,255,1,32,1,244,2,255,1,168,16,0,1,119,3,255,1,50,1,244,2,255,
+    1,168,16,0,1,103,3,255,1,56,1,244,2,255,1,168,16,0,1,100,3,255,1,56,
+    1,244,2,255,1,168,16,0,1,100,3,255,1,56,1,244,2,255,1,168,16,0,1,100,
+    3,255,1,56,1,244,2,255,1,168,16,0,1,100,3,255,1,56,1,244,2,255,1,168,
+    16,0,1,100,3,255,1,56,1,244,2,255,1,168,16,0,1,100,3,255,1,56,1,244,
+    2,255,1,168,16,0,1,100,3,255,1,56,4,0,1,8,1,75,1,134,1,177,1,208,
+    1,230,1,243,1,251,1,254,1,251,1,244,1,230,1,209,1,179,1,138,1,79,1,10,
+    4,0,2,0,1,4,1,126,1,239,15,255,1,240,1,121,3,0,2,0,1,160,19,255,
+    1,124,2,0,1,0,1,77,3,255,1,251,1,174,1,108,1,62,1,38,1,17,1,10,
+    1,4,1,3,1,12,1,25,1,54,1,104,1,190,3,255,1,248,1,22,1,0,1,0,
+    1,188,2,255,1,247,1,58,13,0,1,141,3,255,1,113,1,0,1,5,1,247,2,255,
+    1,143,14,0,1,18,1,249,2,255,1,168,1,0,1,49,3,255,1,69,15,0,1,206,
+    2,255,1,213,1,0,1,70,3,255,1,37,15,0,1,170,2,255,1,231,1,0,1,85,
+    3,255,1,27,15,0,1,158,2,255,1,245,1,0,1,84,3,255,1,37,20,0,1,65,
+    3,255,1,65,20,0,1,20,1,254,2,255,1,123,20,0,1,0,1,205,2,255,1,228,
+    1,25,19,0,1,0,1,90,3,255,1,241,1,165,1,113,1,75,1,46,1,23,1,5,
+    13,0,2,0,1,174,9,255,1,247,1,233,1,218,1,198,1,175,1,144,1,106,1,57,
+    1,6,4,0,2,0,1,8,1,161,16,255,1,242,1,159,1,32,2,0,4,0,1,60,
+    1,172,1,242,15,255,1,232,1,33,1,0,6,0,1,5,1,41,1,74,1,94,1,107,
+    1,121,1,133,1,146,1,158,1,169,1,186,1,216,1,253,4,255,1,172,1,0,18,0,
+    1,14,1,107,1,244,2,255,1,252,1,19,20,0,1,108,3,255,1,71,20,0,1,20,
+    3,255,1,113,21,0,1,239,2,255,1,129,1,143,3,255,1,4,16,0,1,227,2,255,
+    1,142,1,138,3,255,1,11,16,0,1,235,2,255,1,142,1,124,3,255,1,24,15,0,
+    1,1,1,248,2,255,1,130,1,108,3,255,1,59,15,0,1,32,3,255,1,106,1,64,
+    3,255,1,119,15,0,1,96,3,255,1,64,1,11,1,249,2,255,1,224,1,18,13,0,
+    1,14,1,214,2,255,1,246,1,10,1,0,1,157,3,255,1,225,1,128,1,73,1,39,
+    1,18,1,6,1,1,1,0,1,4,1,12,1,26,1,48,1,81,1,134,1,224,3,255,
+    1,158,1,0,1,0,1,28,1,227,19,255,1,233,1,27,1,0,2,0,1,36,1,189,
+    16,255,1,254,1,183,1,36,2,0,4,0,1,37,1,108,1,159,1,196,1,222,1,240,
+    1,250,2,254,1,251,1,242,1,229,1,209,1,182,1,146,1,96,1,29,4,0,1,212,
+    23,255,1,140,1,212,23,255,1,140,1,212,23,255,1,140,10,0,1,104,3,255,1,52,
+    10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,
+    1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,
+    1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,
+    10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,
+    3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,
+    10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,
+    1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,
+    1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,
+    10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,
+    3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,
+    10,0,10,0,1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,10,0,
+    1,104,3,255,1,52,10,0,10,0,1,104,3,255,1,52,10,0,1,236,2,255,1,176,
+    17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,
+    2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,
+    1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,
+    1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,
+    1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,
+    1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,
+    3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,
+    17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,
+    2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,
+    1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,
+    1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,
+    1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,176,17,0,1,52,3,255,1,104,
+    1,236,2,255,1,176,17,0,1,52,3,255,1,104,1,236,2,255,1,177,17,0,1,53,
+    3,255,1,102,1,234,2,255,1,186,17,0,1,64,3,255,1,89,1,220,2,255,1,202,
+    17,0,1,80,3,255,1,74,1,201,2,255,1,243,1,1,16,0,1,124,3,255,1,48,
+    1,152,3,255,1,61,16,0,1,198,2,255,1,246,1,4,1,81,3,255,1,196,1,8,
+    14,0,1,91,3,255,1,183,1,0,1,3,1,211,3,255,1,222,1,132,1,79,1,44,
+    1,22,1,9,1,2,1,0,1,2,1,9,1,21,1,39,1,68,1,112,1,183,1,254,
+    3,255,1,69,1,0,1,0,1,48,1,235,20,255,1,151,2,0,2,0,1,36,1,175,
+    1,252,16,255,1,233,1,117,1,2,2,0,4,0,1,22,1,90,1,142,1,181,1,210,
+    1,231,1,244,1,252,1,255,1,253,1,248,1,237,1,221,1,197,1,165,1,121,1,63,
+    1,4,4,0,1,20,1,250,2,255,1,200,19,0,1,93,3,255,1,130,1,0,1,179,
+    3,255,1,35,18,0,1,181,3,255,1,40,1,0,1,88,3,255,1,124,17,0,1,18,
+    1,250,2,255,1,205,1,0,1,0,1,9,1,242,2,255,1,214,17,0,1,101,3,255,
+    1,114,1,0,2,0,1,161,3,255,1,48,16,0,1,189,2,255,1,253,1,26,1,0,
+    2,0,1,69,3,255,1,137,15,0,1,24,1,252,2,255,1,189,2,0,2,0,1,3,
+    1,230,2,255,1,225,1,1,14,0,1,110,3,255,1,98,2,0,3,0,1,142,3,255,
+    1,61,14,0,1,198,2,255,1,248,1,15,2,0,3,0,1,51,3,255,1,151,13,0,
+    1,30,1,254,2,255,1,173,3,0,4,0,1,215,2,255,1,236,1,5,12,0,1,118,
+    3,255,1,82,3,0,4,0,1,124,3,255,1,75,12,0,1,206,2,255,1,240,1,7,
+    3,0,4,0,1,33,3,255,1,164,11,0,1,38,3,255,1,157,4,0,5,0,1,197,
+    2,255,1,243,1,10,10,0,1,127,3,255,1,66,4,0,5,0,1,105,3,255,1,88,
+    10,0,1,214,2,255,1,229,1,2,4,0,5,0,1,19,1,250,2,255,1,178,9,0,
+    1,47,3,255,1,141,5,0,6,0,1,178,2,255,1,250,1,18,8,0,1,135,3,255,
+    1,50,5,0,6,0,1,87,3,255,1,102,8,0,1,222,2,255,1,216,6,0,6,0,
+    1,9,1,242,2,255,1,191,7,0,1,56,3,255,1,125,6,0,7,0,1,160,2,255,
+    1,253,1,27,6,0,1,144,3,255,1,35,6,0,7,0,1,68,3,255,1,115,5,0,
+    1,2,1,229,2,255,1,200,7,0,7,0,1,2,1,229,2,255,1,205,5,0,1,64,
+    3,255,1,109,7,0,8,0,1,141,3,255,1,39,4,0,1,152,2,255,1,252,1,23,
+    7,0,8,0,1,50,3,255,1,129,3,0,1,4,1,235,2,255,1,184,8,0,9,0,
+    1,214,2,255,1,218,3,0,1,73,3,255,1,93,8,0,9,0,1,123,3,255,1,52,
+    2,0,1,159,2,255,1,246,1,13,8,0,9,0,1,32,1,254,2,255,1,142,1,0,
+    1,5,1,238,2,255,1,168,9,0,10,0,1,196,2,255,1,229,1,2,1,71,3,255,
+    1,78,9,0,10,0,1,104,3,255,1,61,1,155,2,255,1,237,1,6,9,0,10,0,
+    1,18,1,250,2,255,1,147,1,235,2,255,1,152,10,0,11,0,1,177,2,255,1,251,
+    3,255,1,62,10,0,11,0,1,86,5,255,1,226,1,1,10,0,11,0,1,8,1,241,
+    4,255,1,137,11,0,1,197,2,255,1,234,1,2,15,0,1,5,1,240,4,255,1,172,
+    16,0,1,24,1,254,2,255,1,175,1,119,3,255,1,58,15,0,1,65,5,255,1,241,
+    1,5,15,0,1,101,3,255,1,94,1,40,3,255,1,134,15,0,1,140,6,255,1,65,
+    15,0,1,179,2,255,1,251,1,18,1,0,1,217,2,255,1,210,15,0,1,215,2,255,
+    1,214,1,253,2,255,1,140,14,0,1,10,1,246,2,255,1,189,1,0,1,0,1,139,
+    3,255,1,30,13,0,1,34,3,255,1,130,1,200,2,255,1,214,14,0,1,79,3,255,
+    1,108,1,0,1,0,1,61,3,255,1,106,13,0,1,109,3,255,1,60,1,132,3,255,
+    1,33,13,0,1,157,3,255,1,29,1,0,1,0,1,2,1,235,2,255,1,183,13,0,
+    1,184,2,255,1,240,1,4,1,63,3,255,1,107,12,0,1,1,1,232,2,255,1,203,
+    2,0,2,0,1,160,2,255,1,248,1,11,11,0,1,11,1,248,2,255,1,171,1,0,
+    1,5,1,242,2,255,1,182,12,0,1,57,3,255,1,122,2,0,2,0,1,81,3,255,
+    1,79,11,0,1,78,3,255,1,96,2,0,1,176,2,255,1,246,1,9,11,0,1,135,
+    3,255,1,42,2,0,2,0,1,11,1,247,2,255,1,155,11,0,1,153,2,255,1,254,
+    1,23,2,0,1,102,3,255,1,75,11,0,1,212,2,255,1,217,3,0,3,0,1,180,
+    2,255,1,230,1,1,10,0,1,227,2,255,1,200,3,0,1,27,3,255,1,149,10,0,
+    1,34,3,255,1,137,3,0,3,0,1,102,3,255,1,51,9,0,1,48,3,255,1,123,
+    4,0,1,207,2,255,1,224,10,0,1,112,3,255,1,56,3,0,3,0,1,24,1,254,
+    2,255,1,128,9,0,1,123,3,255,1,45,4,0,1,131,3,255,1,42,9,0,1,190,
+    2,255,1,230,1,1,3,0,4,0,1,201,2,255,1,204,9,0,1,198,2,255,1,223,
+    5,0,1,55,3,255,1,117,8,0,1,16,1,251,2,255,1,151,4,0,4,0,1,122,
+    2,255,1,254,1,25,7,0,1,19,1,253,2,255,1,146,5,0,1,1,1,233,2,255,
+    1,191,8,0,1,90,3,255,1,70,4,0,4,0,1,44,3,255,1,100,7,0,1,92,
+    3,255,1,69,6,0,1,159,2,255,1,251,1,14,7,0,1,168,2,255,1,240,1,5,
+    4,0,5,0,1,221,2,255,1,176,7,0,1,167,2,255,1,241,1,6,6,0,1,83,
+    3,255,1,84,6,0,1,5,1,240,2,255,1,165,5,0,5,0,1,143,2,255,1,244,
+    1,8,5,0,1,3,1,238,2,255,1,170,7,0,1,13,1,249,2,255,1,159,6,0,
+    1,68,3,255,1,84,5,0,5,0,1,64,3,255,1,73,5,0,1,61,3,255,1,93,
+    8,0,1,187,2,255,1,231,1,1,5,0,1,145,2,255,1,248,1,12,5,0,5,0,
+    1,3,1,237,2,255,1,149,5,0,1,136,2,255,1,252,1,19,8,0,1,111,3,255,
+    1,51,5,0,1,222,2,255,1,179,6,0,6,0,1,163,2,255,1,225,5,0,1,211,
+    2,255,1,194,9,0,1,34,3,255,1,126,4,0,1,45,3,255,1,98,6,0,6,0,
+    1,85,3,255,1,45,3,0,1,31,3,255,1,116,10,0,1,215,2,255,1,200,4,0,
+    1,123,2,255,1,253,1,21,6,0,6,0,1,13,1,248,2,255,1,121,3,0,1,106,
+    3,255,1,39,10,0,1,139,2,255,1,253,1,21,3,0,1,201,2,255,1,193,7,0,
+    7,0,1,184,2,255,1,198,3,0,1,181,2,255,1,218,11,0,1,63,3,255,1,95,
+    2,0,1,24,1,254,2,255,1,112,7,0,7,0,1,105,2,255,1,253,1,23,1,0,
+    1,10,1,247,2,255,1,140,11,0,1,4,1,238,2,255,1,173,2,0,1,102,3,255,
+    1,32,7,0,7,0,1,27,3,255,1,99,1,0,1,78,3,255,1,63,12,0,1,167,
+    2,255,1,243,1,7,1,0,1,181,2,255,1,207,8,0,8,0,1,204,2,255,1,178,
+    1,0,1,153,2,255,1,237,1,3,12,0,1,91,3,255,1,71,1,11,1,247,2,255,
+    1,127,8,0,8,0,1,126,2,255,1,246,1,11,1,229,2,255,1,164,13,0,1,18,
+    1,252,2,255,1,141,1,81,3,255,1,46,8,0,8,0,1,47,3,255,1,123,3,255,
+    1,86,14,0,1,195,2,255,1,214,1,160,2,255,1,221,9,0,9,0,1,224,2,255,
+    1,244,2,255,1,250,1,15,14,0,1,119,3,255,1,244,2,255,1,141,9,0,9,0,
+    1,146,5,255,1,187,15,0,1,43,6,255,1,60,9,0,9,0,1,67,5,255,1,110,
+    16,0,1,221,4,255,1,233,1,2,9,0,1,0,1,18,1,232,3,255,1,94,16,0,
+    1,59,1,254,2,255,1,239,1,25,1,0,2,0,1,80,3,255,1,237,1,23,14,0,
+    1,6,1,214,3,255,1,98,2,0,3,0,1,165,3,255,1,172,14,0,1,129,3,255,
+    1,187,3,0,3,0,1,18,1,231,3,255,1,82,12,0,1,42,1,249,2,255,1,244,
+    1,33,3,0,4,0,1,79,3,255,1,231,1,17,10,0,1,1,1,197,3,255,1,112,
+    4,0,5,0,1,164,3,255,1,160,10,0,1,107,3,255,1,199,1,2,4,0,5,0,
+    1,18,1,231,3,255,1,71,8,0,1,27,1,241,2,255,1,249,1,42,5,0,6,0,
+    1,78,3,255,1,224,1,12,7,0,1,177,3,255,1,126,6,0,7,0,1,163,3,255,
+    1,148,6,0,1,85,3,255,1,210,1,5,6,0,7,0,1,17,1,230,2,255,1,254,
+    1,60,4,0,1,16,1,231,2,255,1,252,1,53,7,0,8,0,1,77,3,255,1,217,
+    1,8,3,0,1,155,3,255,1,139,8,0,9,0,1,162,3,255,1,133,2,0,1,64,
+    1,254,2,255,1,219,1,9,8,0,9,0,1,17,1,230,2,255,1,250,1,45,1,8,
+    1,218,2,255,1,254,1,64,9,0,10,0,1,77,3,255,1,199,1,130,3,255,1,153,
+    10,0,11,0,1,162,6,255,1,228,1,14,10,0,11,0,1,17,1,240,5,255,1,87,
+    11,0,11,0,1,83,6,255,1,165,11,0,10,0,1,26,1,237,2,255,1,248,1,219,
+    3,255,1,82,10,0,9,0,1,1,1,186,3,255,1,123,1,54,1,253,2,255,1,234,
+    1,21,9,0,9,0,1,112,3,255,1,205,1,4,1,0,1,143,3,255,1,172,9,0,
+    8,0,1,43,1,247,2,255,1,246,1,41,2,0,1,9,1,217,3,255,1,89,8,0,
+    7,0,1,7,1,209,3,255,1,110,4,0,1,57,1,253,2,255,1,237,1,25,7,0,
+    7,0,1,141,3,255,1,189,1,1,5,0,1,138,3,255,1,179,7,0,6,0,1,66,
+    1,254,2,255,1,240,1,29,6,0,1,7,1,213,3,255,1,96,6,0,5,0,1,17,
+    1,227,3,255,1,93,8,0,1,52,1,252,2,255,1,240,1,28,5,0,5,0,1,168,
+    3,255,1,173,10,0,1,133,3,255,1,185,5,0,4,0,1,93,3,255,1,232,1,20,
+    10,0,1,6,1,209,3,255,1,103,4,0,3,0,1,32,1,241,3,255,1,77,12,0,
+    1,49,1,250,2,255,1,243,1,33,3,0,2,0,1,2,1,194,3,255,1,156,14,0,
+    1,128,3,255,1,191,1,1,2,0,2,0,1,122,3,255,1,223,1,13,14,0,1,5,
+    1,206,3,255,1,110,2,0,1,0,1,51,1,250,2,255,1,253,1,62,16,0,1,45,
+    1,249,2,255,1,246,1,37,1,0,1,9,1,215,3,255,1,140,18,0,1,122,3,255,
+    1,198,1,2,1,11,1,225,3,255,1,69,17,0,1,87,3,255,1,228,1,14,1,0,
+    1,76,3,255,1,218,1,7,15,0,1,13,1,229,3,255,1,78,1,0,2,0,1,173,
+    3,255,1,127,15,0,1,143,3,255,1,170,2,0,2,0,1,26,1,241,2,255,1,247,
+    1,36,13,0,1,47,1,252,2,255,1,238,1,23,2,0,3,0,1,109,3,255,1,184,
+    12,0,1,1,1,198,3,255,1,98,3,0,3,0,1,2,1,202,3,255,1,85,11,0,
+    1,100,3,255,1,189,4,0,4,0,1,48,1,252,2,255,1,229,1,13,9,0,1,19,
+    1,236,2,255,1,246,1,35,4,0,5,0,1,141,3,255,1,143,9,0,1,157,3,255,
+    1,118,5,0,5,0,1,11,1,225,2,255,1,252,1,47,7,0,1,58,1,254,2,255,
+    1,206,1,4,5,0,6,0,1,77,3,255,1,198,1,1,5,0,1,4,1,209,2,255,
+    1,252,1,50,6,0,7,0,1,174,3,255,1,101,5,0,1,114,3,255,1,139,7,0,
+    7,0,1,27,1,242,2,255,1,237,1,22,3,0,1,30,1,243,2,255,1,221,1,10,
+    7,0,8,0,1,110,3,255,1,170,3,0,1,184,3,255,1,68,8,0,8,0,1,2,
+    1,203,3,255,1,81,1,0,1,94,3,255,1,159,9,0,9,0,1,49,1,252,2,255,
+    1,229,1,31,1,235,2,255,1,233,1,18,9,0,10,0,1,142,3,255,1,235,3,255,
+    1,87,10,0,10,0,1,12,1,226,5,255,1,179,11,0,11,0,1,78,4,255,1,242,
+    1,28,11,0,12,0,1,175,3,255,1,108,12,0,12,0,1,112,3,255,1,44,12,0,
+    12,0,1,112,3,255,1,44,12,0,12,0,1,112,3,255,1,44,12,0,12,0,1,112,
+    3,255,1,44,12,0,12,0,1,112,3,255,1,44,12,0,12,0,1,112,3,255,1,44,
+    12,0,12,0,1,112,3,255,1,44,12,0,12,0,1,112,3,255,1,44,12,0,12,0,
+    1,112,3,255,1,44,12,0,12,0,1,112,3,255,1,44,12,0,12,0,1,112,3,255,
+    1,44,12,0,12,0,1,112,3,255,1,44,12,0,12,0,1,112,3,255,1,44,12,0,
+    1,72,23,255,1,172,1,0,1,72,23,255,1,172,1,0,1,72,23,255,1,172,1,0,
+    19,0,1,40,1,243,2,255,1,254,1,74,1,0,18,0,1,12,1,214,3,255,1,129,
+    2,0,18,0,1,169,3,255,1,184,1,2,2,0,17,0,1,113,3,255,1,224,1,19,
+    3,0,16,0,1,60,1,251,2,255,1,248,1,52,4,0,15,0,1,24,1,230,3,255,
+    1,101,5,0,14,0,1,4,1,193,3,255,1,159,6,0,14,0,1,141,3,255,1,207,
+    1,8,6,0,13,0,1,84,3,255,1,238,1,34,7,0,12,0,1,40,1,242,2,255,
+    1,254,1,75,8,0,11,0,1,12,1,213,3,255,1,131,9,0,11,0,1,168,3,255,
+    1,186,1,2,9,0,10,0,1,113,3,255,1,225,1,19,10,0,9,0,1,60,1,251,
+    2,255,1,249,1,53,11,0,8,0,1,24,1,230,3,255,1,103,12,0,7,0,1,4,
+    1,193,3,255,1,160,13,0,7,0,1,141,3,255,1,208,1,9,13,0,6,0,1,84,
+    3,255,1,239,1,35,14,0,5,0,1,40,1,242,2,255,1,254,1,77,15,0,4,0,
+    1,12,1,213,3,255,1,132,16,0,4,0,1,168,3,255,1,187,1,2,16,0,3,0,
+    1,112,3,255,1,226,1,20,17,0,2,0,1,59,1,251,2,255,1,249,1,55,18,0,
+    1,0,1,23,1,230,3,255,1,105,19,0,1,4,1,193,3,255,1,162,20,0,1,139,
+    3,255,1,210,1,10,20,0,1,224,24,255,1,24,1,224,24,255,1,24,1,224,24,255,
+    1,24,1,88,7,255,1,212,1,88,7,255,1,212,1,88,7,255,1,212,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,1,68,4,0,1,88,3,255,
+    1,206,3,188,1,155,1,88,7,255,1,212,1,88,7,255,1,212,1,6,1,211,1,255,
+    1,207,1,5,27,0,1,0,1,51,1,251,1,255,1,129,27,0,2,0,1,131,1,255,
+    1,251,1,49,26,0,2,0,1,6,1,209,1,255,1,209,1,6,25,0,3,0,1,49,
+    1,250,1,255,1,131,25,0,4,0,1,128,1,255,1,251,1,51,24,0,4,0,1,5,
+    1,207,1,255,1,211,1,6,23,0,5,0,1,46,1,250,1,255,1,134,23,0,6,0,
+    1,126,1,255,1,252,1,53,22,0,6,0,1,4,1,205,1,255,1,213,1,7,21,0,
+    7,0,1,44,1,249,1,255,1,136,21,0,8,0,1,123,1,255,1,252,1,55,20,0,
+    8,0,1,3,1,203,1,255,1,215,1,8,19,0,9,0,1,42,1,248,1,255,1,139,
+    19,0,10,0,1,120,1,255,1,253,1,57,18,0,10,0,1,3,1,201,1,255,1,217,
+    1,9,17,0,11,0,1,41,1,247,1,255,1,141,17,0,12,0,1,117,1,255,1,253,
+    1,59,16,0,12,0,1,2,1,198,1,255,1,218,1,9,15,0,13,0,1,38,1,246,
+    1,255,1,144,15,0,14,0,1,114,1,255,1,254,1,61,14,0,14,0,1,2,1,196,
+    1,255,1,220,1,10,13,0,15,0,1,37,1,245,1,255,1,147,13,0,16,0,1,111,
+    1,255,1,254,1,63,12,0,16,0,1,1,1,193,1,255,1,222,1,11,11,0,17,0,
+    1,35,1,244,1,255,1,149,11,0,18,0,1,108,1,255,1,254,1,66,10,0,18,0,
+    1,1,1,191,1,255,1,223,1,12,9,0,19,0,1,33,1,244,1,255,1,152,9,0,
+    20,0,1,106,2,255,1,68,8,0,20,0,1,1,1,188,1,255,1,225,1,13,7,0,
+    21,0,1,31,1,242,1,255,1,154,7,0,22,0,1,103,2,255,1,70,6,0,23,0,
+    1,186,1,255,1,226,1,14,5,0,23,0,1,29,1,241,1,255,1,157,5,0,24,0,
+    1,100,2,255,1,73,4,0,25,0,1,183,1,255,1,228,1,16,3,0,25,0,1,28,
+    1,240,1,255,1,159,3,0,26,0,1,97,2,255,1,75,2,0,27,0,1,181,1,255,
+    1,229,1,16,1,0,27,0,1,26,1,239,1,255,1,162,1,0,28,0,1,94,2,255,
+    1,78,1,136,7,255,1,164,1,136,7,255,1,164,1,136,7,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,
+    2,255,1,164,5,0,1,248,2,255,1,164,5,0,1,248,2,255,1,164,1,99,4,188,
+    1,253,2,255,1,164,1,136,7,255,1,164,1,136,7,255,1,164,8,0,1,190,3,255,
+    1,252,1,49,8,0,7,0,1,91,5,255,1,200,1,1,7,0,6,0,1,15,1,231,
+    2,255,1,233,3,255,1,102,7,0,6,0,1,148,2,255,1,248,1,40,1,197,2,255,
+    1,237,1,20,6,0,5,0,1,51,1,253,2,255,1,127,1,0,1,43,1,250,2,255,
+    1,159,6,0,4,0,1,2,1,202,2,255,1,216,1,7,2,0,1,132,2,255,1,254,
+    1,60,5,0,4,0,1,106,3,255,1,64,3,0,1,8,1,218,2,255,1,210,1,4,
+    4,0,3,0,1,22,1,239,2,255,1,159,5,0,1,66,3,255,1,115,4,0,3,0,
+    1,163,2,255,1,235,1,19,6,0,1,160,2,255,1,243,1,28,3,0,2,0,1,64,
+    3,255,1,95,7,0,1,19,1,235,2,255,1,172,3,0,1,0,1,5,1,214,2,255,
+    1,190,9,0,1,93,3,255,1,72,2,0,1,0,1,121,2,255,1,248,1,39,10,0,
+    1,187,2,255,1,220,1,8,1,0,1,31,1,245,2,255,1,127,11,0,1,35,1,246,
+    2,255,1,129,1,0,1,178,2,255,1,216,1,7,12,0,1,121,2,255,1,248,1,37,
+    24,255,24,255,24,255,2,0,1,102,1,4,5,0,1,0,1,109,1,255,1,194,1,24,
+    4,0,1,23,1,246,2,255,1,229,1,57,3,0,1,0,1,64,1,219,2,255,1,250,
+    1,106,2,0,2,0,1,9,1,137,1,252,2,255,1,159,1,8,4,0,1,50,1,206,
+    2,255,1,137,5,0,1,4,1,120,1,229,1,23,7,0,1,8,1,0,3,0,1,31,
+    1,115,1,175,1,209,1,235,1,245,1,253,1,248,1,238,1,223,1,190,1,149,1,79,
+    1,8,3,0,2,0,1,115,1,250,12,255,1,225,1,70,2,0,1,0,1,59,15,255,
+    1,246,1,45,1,0,1,0,1,160,3,255,1,201,1,104,1,51,1,21,1,7,1,2,
+    1,11,1,34,1,79,1,175,3,255,1,170,1,0,1,0,1,215,2,255,1,167,1,1,
+    9,0,1,172,2,255,1,242,1,2,1,0,1,235,2,255,1,79,10,0,1,70,3,255,
+    1,39,15,0,1,24,3,255,1,58,15,0,1,7,3,255,1,71,3,0,1,62,1,141,
+    1,189,1,225,1,240,1,251,1,250,1,236,1,208,1,159,1,81,1,2,1,0,3,255,
+    1,72,1,0,1,25,1,193,11,255,1,207,1,29,3,255,1,72,1,2,1,203,13,255,
+    1,200,3,255,1,72,1,81,3,255,1,218,1,105,1,49,1,21,1,8,1,2,1,8,
+    1,19,1,45,1,93,1,183,4,255,1,72,1,156,2,255,1,242,1,22,10,0,1,141,
+    3,255,1,72,1,203,2,255,1,172,11,0,1,17,1,252,2,255,1,72,1,222,2,255,
+    1,142,12,0,1,224,2,255,1,72,1,224,2,255,1,145,12,0,1,224,2,255,1,72,
+    1,203,2,255,1,181,11,0,1,36,1,254,2,255,1,72,1,146,2,255,1,248,1,33,
+    9,0,1,24,1,203,3,255,1,72,1,49,1,253,2,255,1,227,1,111,1,49,1,18,
+    1,5,1,2,1,11,1,36,1,77,1,148,1,241,4,255,1,72,1,0,1,136,13,255,
+    1,247,1,234,2,255,1,72,2,0,1,118,1,246,10,255,1,220,1,59,1,214,2,255,
+    1,72,3,0,1,23,1,112,1,178,1,222,1,242,1,252,1,243,1,228,1,201,1,147,
+    1,79,1,2,1,0,1,242,2,255,1,72,1,28,3,255,1,44,16,0,1,28,3,255,
+    1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,
+    1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,
+    1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,
+    1,44,1,0,1,52,1,139,1,194,1,228,1,246,1,253,1,240,1,222,1,177,1,113,
+    1,17,4,0,1,28,3,255,1,51,1,167,10,255,1,241,1,99,3,0,1,28,3,255,
+    1,188,13,255,1,97,2,0,1,28,5,255,1,208,1,105,1,48,1,17,1,4,1,11,
+    1,30,1,79,1,172,3,255,1,235,1,15,1,0,1,28,4,255,1,164,1,4,8,0,
+    1,112,3,255,1,99,1,0,1,28,3,255,1,243,1,15,9,0,1,2,1,220,2,255,
+    1,175,1,0,1,28,3,255,1,172,11,0,1,148,2,255,1,227,1,0,1,28,3,255,
+    1,123,11,0,1,102,2,255,1,254,1,9,1,28,3,255,1,90,11,0,1,73,3,255,
+    1,38,1,28,3,255,1,77,11,0,1,58,3,255,1,49,1,28,3,255,1,70,11,0,
+    1,50,3,255,1,60,1,28,3,255,1,75,11,0,1,47,3,255,1,64,1,28,3,255,
+    1,83,11,0,1,56,3,255,1,53,1,28,3,255,1,101,11,0,1,69,3,255,1,42,
+    1,28,3,255,1,130,11,0,1,99,3,255,1,18,1,28,3,255,1,175,11,0,1,144,
+    2,255,1,233,1,0,1,28,3,255,1,238,1,9,9,0,1,1,1,217,2,255,1,184,
+    1,0,1,28,4,255,1,137,9,0,1,109,3,255,1,102,1,0,1,28,5,255,1,191,
+    1,96,1,45,1,17,1,5,1,8,1,26,1,75,1,168,3,255,1,236,1,17,1,0,
+    1,28,3,255,1,176,12,255,1,254,1,92,2,0,1,28,3,255,1,25,1,157,1,253,
+    9,255,1,236,1,88,3,0,1,28,3,255,1,35,1,0,1,46,1,131,1,196,1,227,
+    1,245,1,250,1,235,1,214,1,164,1,100,1,10,4,0,4,0,1,47,1,131,1,183,
+    1,222,1,237,1,251,1,248,1,239,1,222,1,189,1,147,1,78,1,6,3,0,2,0,
+    1,22,1,184,12,255,1,222,1,62,2,0,1,0,1,19,1,223,14,255,1,244,1,36,
+    1,0,1,0,1,145,3,255,1,209,1,99,1,40,1,14,1,2,1,7,1,18,1,42,
+    1,87,1,177,3,255,1,158,1,0,1,7,1,241,2,255,1,195,1,7,9,0,1,155,
+    2,255,1,231,1,0,1,64,3,255,1,71,10,0,1,55,3,255,1,21,1,115,2,255,
+    1,251,1,10,10,0,1,27,3,255,1,39,1,150,2,255,1,222,16,0,1,174,2,255,
+    1,196,16,0,1,188,2,255,1,182,16,0,1,194,2,255,1,176,16,0,1,194,2,255,
+    1,174,16,0,1,188,2,255,1,182,16,0,1,173,2,255,1,194,16,0,1,151,2,255,
+    1,223,12,0,1,190,2,255,1,146,1,118,2,255,1,251,1,11,11,0,1,205,2,255,
+    1,143,1,70,3,255,1,78,10,0,1,3,1,242,2,255,1,118,1,11,1,248,2,255,
+    1,205,1,13,9,0,1,82,3,255,1,53,1,0,1,163,3,255,1,224,1,123,1,62,
+    1,25,1,10,1,2,1,7,1,23,1,56,1,125,1,240,2,255,1,198,1,1,1,0,
+    1,32,1,239,14,255,1,231,1,39,1,0,2,0,1,46,1,206,12,255,1,181,1,33,
+    2,0,4,0,1,62,1,136,1,188,1,222,1,243,1,253,1,251,1,240,1,221,1,181,
+    1,128,1,44,4,0,16,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,
+    1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,
+    1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,
+    1,172,2,255,1,156,16,0,1,172,2,255,1,156,4,0,1,64,1,145,1,203,1,230,
+    1,247,1,251,1,240,1,215,1,172,1,105,1,15,1,0,1,172,2,255,1,156,2,0,
+    1,22,1,192,10,255,1,238,1,75,1,172,2,255,1,156,1,0,1,10,1,217,12,255,
+    1,247,1,206,2,255,1,156,1,0,1,129,3,255,1,234,1,126,1,56,1,19,1,4,
+    1,11,1,29,1,74,1,154,1,248,4,255,1,156,1,1,1,228,2,255,1,228,1,28,
+    8,0,1,51,1,243,3,255,1,156,1,52,3,255,1,105,10,0,1,122,3,255,1,156,
+    1,99,3,255,1,27,10,0,1,30,3,255,1,156,1,138,2,255,1,237,12,0,1,234,
+    2,255,1,156,1,160,2,255,1,207,12,0,1,199,2,255,1,156,1,171,2,255,1,194,
+    12,0,1,186,2,255,1,156,1,181,2,255,1,186,12,0,1,178,2,255,1,156,1,181,
+    2,255,1,190,12,0,1,185,2,255,1,156,1,173,2,255,1,198,12,0,1,193,2,255,
+    1,156,1,156,2,255,1,217,12,0,1,215,2,255,1,156,1,131,2,255,1,246,12,0,
+    1,244,2,255,1,156,1,94,3,255,1,41,10,0,1,41,3,255,1,156,1,42,3,255,
+    1,120,10,0,1,119,3,255,1,156,1,0,1,225,2,255,1,235,1,36,8,0,1,39,
+    1,235,3,255,1,156,1,0,1,125,3,255,1,238,1,132,1,59,1,19,1,4,1,9,
+    1,24,1,68,1,141,1,241,4,255,1,156,1,0,1,11,1,211,12,255,1,247,1,180,
+    2,255,1,156,2,0,1,18,1,184,10,255,1,230,1,66,1,149,2,255,1,156,4,0,
+    1,56,1,140,1,197,1,229,1,245,1,253,1,243,1,217,1,171,1,99,1,10,1,0,
+    1,164,2,255,1,156,4,0,1,57,1,137,1,186,1,224,1,238,2,251,1,243,1,224,
+    1,195,1,150,1,85,1,9,3,0,2,0,1,35,1,202,12,255,1,235,1,91,2,0,
+    1,0,1,31,1,236,15,255,1,78,1,0,1,0,1,163,3,255,1,195,1,97,1,47,
+    1,16,1,6,1,4,1,13,1,35,1,72,1,148,1,248,2,255,1,216,1,0,1,13,
+    1,248,2,255,1,169,1,1,9,0,1,83,3,255,1,50,1,73,3,255,1,46,11,0,
+    1,221,2,255,1,111,1,122,2,255,1,241,12,0,1,168,2,255,1,153,1,154,2,255,
+    1,208,12,0,1,148,2,255,1,181,1,176,2,255,1,197,12,0,1,138,2,255,1,199,
+    1,190,18,255,1,207,1,194,18,255,1,211,1,193,18,255,1,212,1,187,2,255,1,183,
+    16,0,1,173,2,255,1,192,16,0,1,150,2,255,1,212,16,0,1,117,2,255,1,245,
+    1,2,11,0,1,136,2,255,1,213,1,70,3,255,1,53,11,0,1,155,2,255,1,200,
+    1,12,1,248,2,255,1,174,1,2,9,0,1,8,1,225,2,255,1,169,1,0,1,167,
+    3,255,1,198,1,100,1,48,1,17,1,6,1,1,1,6,1,20,1,44,1,91,1,198,
+    3,255,1,94,1,0,1,36,1,242,15,255,1,207,1,4,2,0,1,50,1,210,13,255,
+    1,183,1,20,1,0,3,0,1,1,1,64,1,137,1,187,1,221,1,242,1,252,1,253,
+    1,245,1,235,1,210,1,177,1,122,1,47,3,0,11,0,1,9,1,25,6,0,1,33,
+    1,138,1,203,1,237,1,253,1,255,1,228,5,0,1,95,1,247,5,255,1,228,4,0,
+    1,60,1,252,4,255,1,254,1,232,1,171,4,0,1,187,2,255,1,247,1,125,1,36,
+    1,5,2,0,3,0,1,11,1,251,2,255,1,118,5,0,3,0,1,45,3,255,1,36,
+    5,0,3,0,1,61,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,
+    1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,1,172,11,255,1,228,
+    1,172,11,255,1,228,1,172,11,255,1,228,3,0,1,64,3,255,1,8,5,0,3,0,
+    1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,
+    1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,
+    3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,
+    3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,
+    5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,
+    1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,
+    1,8,5,0,3,0,1,64,3,255,1,8,5,0,3,0,1,64,3,255,1,8,5,0,
+    3,0,1,64,3,255,1,8,5,0,4,0,1,57,1,139,1,196,1,228,1,244,1,249,
+    1,231,1,211,1,156,1,84,1,4,1,0,1,158,2,255,1,164,2,0,1,21,1,187,
+    10,255,1,210,1,51,1,144,2,255,1,164,1,0,1,14,1,218,12,255,1,235,1,164,
+    2,255,1,164,1,0,1,136,3,255,1,225,1,118,1,55,1,18,1,5,1,9,1,24,
+    1,64,1,133,1,237,4,255,1,164,1,3,1,234,2,255,1,214,1,17,8,0,1,30,
+    1,231,3,255,1,164,1,54,3,255,1,90,10,0,1,107,3,255,1,164,1,105,3,255,
+    1,20,10,0,1,27,3,255,1,164,1,142,2,255,1,233,12,0,1,239,2,255,1,164,
+    1,167,2,255,1,204,12,0,1,209,2,255,1,164,1,182,2,255,1,191,12,0,1,198,
+    2,255,1,164,1,189,2,255,1,183,12,0,1,190,2,255,1,164,1,188,2,255,1,184,
+    12,0,1,197,2,255,1,164,1,178,2,255,1,191,12,0,1,205,2,255,1,164,1,167,
+    2,255,1,205,12,0,1,227,2,255,1,164,1,143,2,255,1,234,11,0,1,5,1,253,
+    2,255,1,164,1,105,3,255,1,22,10,0,1,58,3,255,1,164,1,58,3,255,1,93,
+    10,0,1,141,3,255,1,164,1,3,1,235,2,255,1,216,1,18,8,0,1,55,1,246,
+    3,255,1,164,1,0,1,140,3,255,1,226,1,118,1,54,1,18,1,4,1,8,1,25,
+    1,71,1,150,1,247,4,255,1,164,1,0,1,15,1,226,12,255,1,248,1,203,2,255,
+    1,164,2,0,1,30,1,203,10,255,1,237,1,76,1,164,2,255,1,164,4,0,1,72,
+    1,150,1,206,1,233,1,248,1,252,1,241,1,216,1,172,1,104,1,14,1,0,1,164,
+    2,255,1,164,16,0,1,164,2,255,1,164,16,0,1,164,2,255,1,162,16,0,1,172,
+    2,255,1,150,1,0,1,217,2,255,1,78,11,0,1,196,2,255,1,134,1,0,1,200,
+    2,255,1,108,10,0,1,12,1,245,2,255,1,93,1,0,1,159,2,255,1,194,1,1,
+    9,0,1,136,3,255,1,35,1,0,1,91,3,255,1,180,1,80,1,35,1,12,1,3,
+    1,4,1,14,1,41,1,90,1,181,3,255,1,189,1,0,1,0,1,5,1,219,14,255,
+    1,244,1,47,1,0,2,0,1,38,1,212,12,255,1,212,1,57,2,0,3,0,1,4,
+    1,78,1,152,1,196,1,230,1,244,1,253,1,248,1,238,1,221,1,184,1,139,1,63,
+    1,2,3,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,1,0,1,63,1,150,
+    1,203,1,234,1,249,1,250,1,236,1,209,1,160,1,80,1,5,3,0,1,28,3,255,
+    1,54,1,178,10,255,1,217,1,57,2,0,1,28,3,255,1,199,12,255,1,245,1,55,
+    1,0,1,28,5,255,1,196,1,103,1,52,1,20,1,8,1,5,1,26,1,81,1,190,
+    3,255,1,209,1,2,1,28,4,255,1,125,9,0,1,151,3,255,1,58,1,28,3,255,
+    1,212,1,1,9,0,1,12,1,243,2,255,1,119,1,28,3,255,1,127,11,0,1,191,
+    2,255,1,144,1,28,3,255,1,80,11,0,1,173,2,255,1,155,1,28,3,255,1,57,
+    11,0,1,172,2,255,1,156,1,28,3,255,1,46,11,0,1,172,2,255,1,156,1,28,
+    3,255,1,44,11,0,1,172,2,255,1,156,1,28,3,255,1,44,11,0,1,172,2,255,
+    1,156,1,28,3,255,1,44,11,0,1,172,2,255,1,156,1,28,3,255,1,44,11,0,
+    1,172,2,255,1,156,1,28,3,255,1,44,11,0,1,172,2,255,1,156,1,28,3,255,
+    1,44,11,0,1,172,2,255,1,156,1,28,3,255,1,44,11,0,1,172,2,255,1,156,
+    1,28,3,255,1,44,11,0,1,172,2,255,1,156,1,28,3,255,1,44,11,0,1,172,
+    2,255,1,156,1,28,3,255,1,44,11,0,1,172,2,255,1,156,1,28,3,255,1,44,
+    11,0,1,172,2,255,1,156,1,28,3,255,1,44,11,0,1,172,2,255,1,156,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,5,0,
+    5,0,5,0,5,0,5,0,5,0,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,3,0,
+    1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,
+    1,84,2,255,1,244,7,0,7,0,7,0,7,0,7,0,7,0,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,
+    1,244,3,0,1,84,2,255,1,244,3,0,1,84,2,255,1,244,3,0,1,87,2,255,
+    1,244,3,0,1,99,2,255,1,238,3,0,1,133,2,255,1,221,1,0,1,3,1,33,
+    1,218,2,255,1,177,1,43,1,244,4,255,1,95,1,60,4,255,1,196,1,3,1,46,
+    1,224,1,249,1,222,1,137,1,12,1,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,1,44,15,0,1,28,3,255,
+    1,44,7,0,1,11,1,204,2,255,1,250,1,72,2,0,1,28,3,255,1,44,6,0,
+    1,4,1,182,2,255,1,254,1,91,3,0,1,28,3,255,1,44,6,0,1,154,3,255,
+    1,111,4,0,1,28,3,255,1,44,5,0,1,125,3,255,1,134,5,0,1,28,3,255,
+    1,44,4,0,1,94,3,255,1,156,6,0,1,28,3,255,1,44,3,0,1,68,1,250,
+    2,255,1,176,1,3,6,0,1,28,3,255,1,44,2,0,1,47,1,241,2,255,1,193,
+    1,8,7,0,1,28,3,255,1,44,1,0,1,29,1,228,2,255,1,208,1,15,8,0,
+    1,28,3,255,1,44,1,15,1,211,2,255,1,221,1,24,9,0,1,28,7,255,1,233,
+    1,36,10,0,1,28,7,255,1,92,11,0,1,28,7,255,1,235,1,44,10,0,1,28,
+    3,255,1,44,1,34,1,228,2,255,1,233,1,42,9,0,1,28,3,255,1,44,1,0,
+    1,40,1,234,2,255,1,232,1,40,8,0,1,28,3,255,1,44,2,0,1,48,1,239,
+    2,255,1,230,1,38,7,0,1,28,3,255,1,44,3,0,1,56,1,243,2,255,1,229,
+    1,36,6,0,1,28,3,255,1,44,4,0,1,65,1,247,2,255,1,227,1,35,5,0,
+    1,28,3,255,1,44,5,0,1,74,1,250,2,255,1,225,1,33,4,0,1,28,3,255,
+    1,44,6,0,1,84,1,252,2,255,1,224,1,31,3,0,1,28,3,255,1,44,7,0,
+    1,94,1,254,2,255,1,222,1,29,2,0,1,28,3,255,1,44,8,0,1,106,3,255,
+    1,220,1,28,1,0,1,28,3,255,1,44,9,0,1,118,3,255,1,218,1,26,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,3,255,1,44,1,28,
+    3,255,1,40,1,0,1,6,1,82,1,161,1,212,1,234,1,251,1,244,1,219,1,171,
+    1,94,1,7,4,0,1,36,1,116,1,188,1,219,1,240,1,249,1,233,1,199,1,140,
+    1,41,4,0,1,28,3,255,1,34,1,53,1,212,9,255,1,217,1,40,1,0,1,11,
+    1,140,1,251,8,255,1,254,1,147,1,6,2,0,1,28,3,255,1,72,1,244,11,255,
+    1,223,1,16,1,187,12,255,1,159,2,0,1,28,3,255,1,233,1,255,1,247,1,154,
+    1,72,1,24,1,6,1,8,1,35,1,97,1,216,3,255,1,220,2,255,1,182,1,92,
+    1,43,1,15,1,4,1,8,1,29,1,79,1,189,3,255,1,65,1,0,1,28,4,255,
+    1,224,1,44,7,0,1,12,1,208,4,255,1,104,8,0,1,2,1,195,2,255,1,171,
+    1,0,1,28,3,255,1,253,1,48,9,0,1,91,3,255,1,195,10,0,1,93,2,255,
+    1,234,1,0,1,28,3,255,1,172,10,0,1,51,3,255,1,110,10,0,1,52,3,255,
+    1,12,1,28,3,255,1,98,10,0,1,38,3,255,1,65,10,0,1,40,3,255,1,28,
+    1,28,3,255,1,60,10,0,1,36,3,255,1,45,10,0,1,40,3,255,1,32,1,28,
+    3,255,1,46,10,0,1,36,3,255,1,36,10,0,1,40,3,255,1,32,1,28,3,255,
+    1,44,10,0,1,36,3,255,1,36,10,0,1,40,3,255,1,32,1,28,3,255,1,44,
+    10,0,1,36,3,255,1,36,10,0,1,40,3,255,1,32,1,28,3,255,1,44,10,0,
+    1,36,3,255,1,36,10,0,1,40,3,255,1,32,1,28,3,255,1,44,10,0,1,36,
+    3,255,1,36,10,0,1,40,3,255,1,32,1,28,3,255,1,44,10,0,1,36,3,255,
+    1,36,10,0,1,40,3,255,1,32,1,28,3,255,1,44,10,0,1,36,3,255,1,36,
+    10,0,1,40,3,255,1,32,1,28,3,255,1,44,10,0,1,36,3,255,1,36,10,0,
+    1,40,3,255,1,32,1,28,3,255,1,44,10,0,1,36,3,255,1,36,10,0,1,40,
+    3,255,1,32,1,28,3,255,1,44,10,0,1,36,3,255,1,36,10,0,1,40,3,255,
+    1,32,1,28,3,255,1,44,10,0,1,36,3,255,1,36,10,0,1,40,3,255,1,32,
+    1,28,3,255,1,44,10,0,1,36,3,255,1,36,10,0,1,40,3,255,1,32,1,28,
+    3,255,1,44,10,0,1,36,3,255,1,36,10,0,1,40,3,255,1,32,1,28,3,255,
+    1,7,1,0,1,39,1,129,1,189,1,226,1,246,1,253,1,244,1,230,1,196,1,150,
+    1,67,1,1,2,0,1,28,2,255,1,254,1,5,1,148,1,253,10,255,1,187,1,15,
+    1,0,1,28,2,255,1,247,1,150,13,255,1,166,1,0,1,28,5,255,1,241,1,147,
+    1,71,1,27,1,9,1,4,1,16,1,49,1,116,1,233,2,255,1,253,1,30,1,28,
+    4,255,1,203,1,28,8,0,1,46,1,253,2,255,1,98,1,28,3,255,1,239,1,21,
+    10,0,1,195,2,255,1,143,1,28,3,255,1,137,11,0,1,158,2,255,1,163,1,28,
+    3,255,1,73,11,0,1,148,2,255,1,176,1,28,3,255,1,49,11,0,1,148,2,255,
+    1,180,1,28,3,255,1,44,11,0,1,148,2,255,1,180,1,28,3,255,1,44,11,0,
+    1,148,2,255,1,180,1,28,3,255,1,44,11,0,1,148,2,255,1,180,1,28,3,255,
+    1,44,11,0,1,148,2,255,1,180,1,28,3,255,1,44,11,0,1,148,2,255,1,180,
+    1,28,3,255,1,44,11,0,1,148,2,255,1,180,1,28,3,255,1,44,11,0,1,148,
+    2,255,1,180,1,28,3,255,1,44,11,0,1,148,2,255,1,180,1,28,3,255,1,44,
+    11,0,1,148,2,255,1,180,1,28,3,255,1,44,11,0,1,148,2,255,1,180,1,28,
+    3,255,1,44,11,0,1,148,2,255,1,180,1,28,3,255,1,44,11,0,1,148,2,255,
+    1,180,1,28,3,255,1,44,11,0,1,148,2,255,1,180,3,0,1,6,1,81,1,148,
+    1,194,1,225,1,243,1,252,1,253,1,246,1,231,1,204,1,164,1,104,1,22,4,0,
+    2,0,1,76,1,229,12,255,1,248,1,131,1,2,2,0,1,0,1,58,1,252,15,255,
+    1,130,2,0,1,0,1,190,3,255,1,194,1,97,1,48,1,18,1,7,1,4,1,15,
+    1,36,1,78,1,158,1,252,2,255,1,247,1,19,1,0,1,22,1,254,2,255,1,164,
+    1,1,9,0,1,89,3,255,1,98,1,0,1,80,3,255,1,51,10,0,1,1,1,229,
+    2,255,1,159,1,0,1,123,2,255,1,248,1,3,11,0,1,174,2,255,1,202,1,0,
+    1,153,2,255,1,218,12,0,1,140,2,255,1,231,1,0,1,173,2,255,1,197,12,0,
+    1,119,2,255,1,251,1,0,1,185,2,255,1,186,12,0,1,107,3,255,1,7,1,190,
+    2,255,1,181,12,0,1,102,3,255,1,13,1,190,2,255,1,181,12,0,1,102,3,255,
+    1,13,1,185,2,255,1,186,12,0,1,107,3,255,1,7,1,173,2,255,1,197,12,0,
+    1,119,2,255,1,251,1,0,1,153,2,255,1,218,12,0,1,140,2,255,1,231,1,0,
+    1,123,2,255,1,248,1,3,11,0,1,173,2,255,1,202,1,0,1,81,3,255,1,51,
+    10,0,1,1,1,228,2,255,1,159,1,0,1,23,1,254,2,255,1,161,10,0,1,86,
+    3,255,1,99,1,0,1,0,1,191,3,255,1,191,1,95,1,46,1,16,1,6,1,3,
+    1,13,1,34,1,76,1,155,1,252,2,255,1,248,1,20,1,0,1,0,1,60,1,253,
+    15,255,1,133,2,0,2,0,1,79,1,231,12,255,1,249,1,135,1,2,2,0,3,0,
+    1,7,1,83,1,150,1,196,1,226,1,244,1,253,1,254,1,248,1,232,1,207,1,166,
+    1,106,1,24,4,0,1,28,3,255,1,35,1,0,1,35,1,119,1,184,1,221,1,238,
+    1,251,1,237,1,219,1,171,1,107,1,13,4,0,1,28,3,255,1,23,1,140,1,250,
+    9,255,1,237,1,89,3,0,1,28,3,255,1,158,12,255,1,254,1,89,2,0,1,28,
+    5,255,1,188,1,91,1,38,1,15,1,3,1,14,1,36,1,86,1,182,3,255,1,235,
+    1,10,1,0,1,28,4,255,1,133,9,0,1,130,3,255,1,92,1,0,1,28,3,255,
+    1,232,1,6,9,0,1,7,1,234,2,255,1,164,1,0,1,28,3,255,1,162,11,0,
+    1,168,2,255,1,216,1,0,1,28,3,255,1,115,11,0,1,123,2,255,1,251,1,2,
+    1,28,3,255,1,85,11,0,1,94,3,255,1,23,1,28,3,255,1,69,11,0,1,79,
+    3,255,1,39,1,28,3,255,1,61,11,0,1,71,3,255,1,47,1,28,3,255,1,58,
+    11,0,1,67,3,255,1,48,1,28,3,255,1,67,11,0,1,75,3,255,1,38,1,28,
+    3,255,1,83,11,0,1,87,3,255,1,27,1,28,3,255,1,116,11,0,1,118,2,255,
+    1,253,1,7,1,28,3,255,1,168,11,0,1,163,2,255,1,221,1,0,1,28,3,255,
+    1,239,1,13,9,0,1,6,1,232,2,255,1,174,1,0,1,28,4,255,1,158,1,2,
+    8,0,1,131,3,255,1,96,1,0,1,28,5,255,1,205,1,102,1,45,1,16,1,3,
+    1,11,1,32,1,84,1,181,3,255,1,236,1,15,1,0,1,28,3,255,1,199,13,255,
+    1,95,2,0,1,28,3,255,1,47,1,147,1,251,9,255,1,242,1,98,3,0,1,28,
+    3,255,1,44,1,0,1,34,1,122,1,184,1,222,1,239,1,252,1,241,1,223,1,177,
+    1,113,1,17,4,0,1,28,3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,
+    3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,
+    3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,3,255,1,44,16,0,1,28,
+    3,255,1,44,16,0,1,28,3,255,1,44,16,0,4,0,1,57,1,140,1,198,1,228,
+    1,245,1,248,1,230,1,208,1,153,1,84,1,3,1,0,1,164,2,255,1,156,2,0,
+    1,18,1,183,10,255,1,214,1,57,1,148,2,255,1,156,1,0,1,7,1,210,12,255,
+    1,242,1,184,2,255,1,156,1,0,1,122,3,255,1,230,1,119,1,51,1,18,1,4,
+    1,12,1,28,1,72,1,144,1,242,4,255,1,156,1,0,1,225,2,255,1,224,1,24,
+    8,0,1,41,1,238,3,255,1,156,1,49,3,255,1,103,10,0,1,128,3,255,1,156,
+    1,99,3,255,1,30,10,0,1,53,3,255,1,156,1,138,2,255,1,239,11,0,1,5,
+    1,254,2,255,1,156,1,166,2,255,1,210,12,0,1,231,2,255,1,156,1,177,2,255,
+    1,193,12,0,1,212,2,255,1,156,1,187,2,255,1,185,12,0,1,204,2,255,1,156,
+    1,187,2,255,1,182,12,0,1,198,2,255,1,156,1,176,2,255,1,189,12,0,1,207,
+    2,255,1,156,1,165,2,255,1,201,12,0,1,219,2,255,1,156,1,137,2,255,1,231,
+    11,0,1,3,1,249,2,255,1,156,1,99,2,255,1,254,1,19,10,0,1,47,3,255,
+    1,156,1,48,3,255,1,91,10,0,1,134,3,255,1,156,1,0,1,226,2,255,1,217,
+    1,19,8,0,1,53,1,246,3,255,1,156,1,0,1,124,3,255,1,226,1,117,1,52,
+    1,17,1,4,1,9,1,27,1,72,1,152,1,247,4,255,1,156,1,0,1,9,1,214,
+    12,255,1,244,1,206,2,255,1,156,2,0,1,21,1,190,10,255,1,227,1,60,1,172,
+    2,255,1,156,4,0,1,64,1,147,1,205,1,232,1,249,1,252,1,239,1,211,1,165,
+    1,92,1,8,1,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,
+    2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,
+    2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,
+    2,255,1,156,16,0,1,172,2,255,1,156,16,0,1,172,2,255,1,156,1,200,2,255,
+    1,110,1,0,1,52,1,142,1,206,1,233,1,250,1,242,1,211,1,146,1,39,2,0,
+    1,200,2,255,1,83,1,162,8,255,1,248,1,90,1,0,1,200,2,255,1,218,10,255,
+    1,249,1,34,1,200,4,255,1,221,1,104,1,36,1,8,1,14,1,45,1,142,3,255,
+    1,136,1,200,3,255,1,197,1,13,6,0,1,148,2,255,1,191,1,200,2,255,1,252,
+    1,35,7,0,1,79,2,255,1,211,1,200,2,255,1,193,8,0,1,85,2,255,1,213,
+    1,200,2,255,1,146,12,0,1,200,2,255,1,130,12,0,1,200,2,255,1,128,12,0,
+    1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,
+    1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,
+    1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,
+    1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,1,200,2,255,1,128,12,0,
+    3,0,1,26,1,110,1,166,1,201,1,228,1,241,1,249,1,253,1,245,1,233,1,206,
+    1,169,1,112,1,30,3,0,2,0,1,113,1,250,12,255,1,253,1,157,1,10,1,0,
+    1,0,1,59,16,255,1,171,1,0,1,0,1,160,3,255,1,160,1,66,1,29,1,10,
+    1,4,1,1,1,4,1,12,1,26,1,57,1,173,3,255,1,29,1,0,1,214,2,255,
+    1,204,10,0,1,26,3,255,1,61,1,0,1,233,2,255,1,144,15,0,1,0,1,226,
+    2,255,1,143,15,0,1,0,1,199,2,255,1,185,15,0,1,0,1,126,2,255,1,254,
+    1,71,14,0,1,0,1,19,1,231,2,255,1,253,1,170,1,115,1,91,1,79,1,67,
+    1,55,1,43,1,31,1,8,5,0,2,0,1,39,1,201,11,255,1,223,1,150,1,36,
+    2,0,4,0,1,45,1,106,1,149,1,180,1,203,1,220,1,232,1,239,1,243,1,251,
+    3,255,1,246,1,83,1,0,13,0,1,3,1,42,1,179,2,255,1,246,1,33,15,0,
+    1,9,1,227,2,255,1,139,16,0,1,164,2,255,1,200,1,34,3,255,1,73,11,0,
+    1,142,2,255,1,224,1,28,3,255,1,90,11,0,1,173,2,255,1,218,1,7,1,253,
+    2,255,1,165,10,0,1,29,1,244,2,255,1,191,1,0,1,196,3,255,1,160,1,70,
+    1,30,1,9,1,2,1,3,1,10,1,29,1,60,1,118,1,228,3,255,1,124,1,0,
+    1,74,16,255,1,236,1,18,2,0,1,100,1,242,13,255,1,219,1,49,1,0,3,0,
+    1,14,1,94,1,154,1,194,1,222,1,241,1,248,1,254,1,248,1,239,1,219,1,189,
+    1,142,1,75,1,3,2,0,3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,
+    1,36,9,0,3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,9,0,
+    3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,9,0,1,60,14,255,
+    1,196,1,0,1,60,14,255,1,196,1,0,1,60,14,255,1,196,1,0,3,0,1,36,
+    3,255,1,36,9,0,3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,
+    9,0,3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,9,0,3,0,
+    1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,
+    1,36,9,0,3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,9,0,
+    3,0,1,36,3,255,1,36,9,0,3,0,1,36,3,255,1,36,5,0,1,117,2,255,
+    1,157,3,0,1,36,3,255,1,36,5,0,1,124,2,255,1,161,3,0,1,35,3,255,
+    1,55,5,0,1,137,2,255,1,148,3,0,1,21,3,255,1,124,5,0,1,194,2,255,
+    1,114,4,0,1,229,2,255,1,246,1,110,1,28,1,8,1,39,1,151,3,255,1,47,
+    4,0,1,125,10,255,1,183,1,0,4,0,1,4,1,168,8,255,1,208,1,23,1,0,
+    6,0,1,73,1,166,1,219,1,245,1,252,1,236,1,191,1,106,1,8,2,0,1,28,
+    3,255,1,44,10,0,1,28,3,255,1,44,1,28,3,255,1,44,10,0,1,28,3,255,
+    1,44,1,28,3,255,1,44,10,0,1,28,3,255,1,44,1,28,3,255,1,44,10,0,
+    1,28,3,255,1,44,1,28,3,255,1,44,10,0,1,28,3,255,1,44,1,28,3,255,
+    1,44,10,0,1,28,3,255,1,44,1,28,3,255,1,44,10,0,1,28,3,255,1,44,
+    1,28,3,255,1,44,10,0,1,28,3,255,1,44,1,28,3,255,1,44,10,0,1,28,
+    3,255,1,44,1,28,3,255,1,44,10,0,1,28,3,255,1,44,1,28,3,255,1,44,
+    10,0,1,28,3,255,1,44,1,28,3,255,1,44,10,0,1,28,3,255,1,44,1,28,
+    3,255,1,44,10,0,1,29,3,255,1,44,1,28,3,255,1,44,10,0,1,40,3,255,
+    1,44,1,26,3,255,1,44,10,0,1,62,3,255,1,44,1,13,3,255,1,55,10,0,
+    1,113,3,255,1,44,1,0,1,241,2,255,1,93,10,0,1,204,3,255,1,44,1,0,
+    1,181,2,255,1,188,9,0,1,123,4,255,1,44,1,0,1,80,3,255,1,175,1,71,
+    1,25,1,6,1,4,1,16,1,46,1,99,1,194,5,255,1,44,1,0,1,1,1,177,
+    12,255,1,168,1,234,2,255,1,44,2,0,1,10,1,162,9,255,1,253,1,154,1,9,
+    1,251,2,255,1,44,4,0,1,52,1,147,1,205,1,237,1,251,1,242,1,224,1,192,
+    1,127,1,44,1,0,1,18,3,255,1,44,1,11,1,245,2,255,1,97,11,0,1,85,
+    3,255,1,79,1,0,1,170,2,255,1,182,11,0,1,165,2,255,1,241,1,7,1,0,
+    1,84,2,255,1,250,1,16,9,0,1,5,1,240,2,255,1,161,1,0,1,0,1,9,
+    1,243,2,255,1,95,9,0,1,71,3,255,1,74,1,0,2,0,1,167,2,255,1,180,
+    9,0,1,152,2,255,1,237,1,5,1,0,2,0,1,80,2,255,1,249,1,15,7,0,
+    1,1,1,231,2,255,1,155,2,0,2,0,1,7,1,241,2,255,1,93,7,0,1,58,
+    3,255,1,68,2,0,3,0,1,163,2,255,1,177,7,0,1,139,2,255,1,233,1,3,
+    2,0,3,0,1,77,2,255,1,248,1,13,6,0,1,219,2,255,1,149,3,0,3,0,
+    1,6,1,239,2,255,1,90,5,0,1,45,3,255,1,62,3,0,4,0,1,160,2,255,
+    1,175,5,0,1,125,2,255,1,229,1,2,3,0,4,0,1,73,2,255,1,247,1,12,
+    4,0,1,206,2,255,1,143,4,0,4,0,1,5,1,237,2,255,1,88,3,0,1,32,
+    3,255,1,56,4,0,5,0,1,156,2,255,1,174,3,0,1,115,2,255,1,224,1,1,
+    4,0,5,0,1,69,2,255,1,247,1,12,2,0,1,198,2,255,1,138,5,0,5,0,
+    1,3,1,235,2,255,1,88,1,0,1,26,1,254,2,255,1,50,5,0,6,0,1,152,
+    2,255,1,169,1,0,1,103,2,255,1,219,6,0,6,0,1,66,2,255,1,241,1,6,
+    1,178,2,255,1,132,6,0,6,0,1,2,1,232,2,255,1,83,1,246,2,255,1,45,
+    6,0,7,0,1,149,2,255,1,225,2,255,1,214,7,0,7,0,1,62,5,255,1,126,
+    7,0,7,0,1,2,1,229,4,255,1,39,7,0,1,177,2,255,1,188,9,0,1,105,
+    4,255,1,159,9,0,1,154,2,255,1,230,1,0,1,106,2,255,1,247,1,8,8,0,
+    1,169,4,255,1,223,9,0,1,220,2,255,1,157,1,0,1,36,3,255,1,66,8,0,
+    1,233,1,255,1,247,1,224,2,255,1,31,7,0,1,29,3,255,1,84,1,0,1,0,
+    1,221,2,255,1,133,7,0,1,42,2,255,1,193,1,158,2,255,1,95,7,0,1,96,
+    2,255,1,251,1,16,1,0,1,0,1,151,2,255,1,199,7,0,1,107,2,255,1,132,
+    1,98,2,255,1,159,7,0,1,162,2,255,1,194,2,0,1,0,1,80,2,255,1,252,
+    1,14,6,0,1,171,2,255,1,69,1,40,2,255,1,223,7,0,1,227,2,255,1,121,
+    2,0,1,0,1,14,1,251,2,255,1,77,5,0,1,1,1,234,1,255,1,251,1,12,
+    1,0,1,234,2,255,1,30,5,0,1,38,3,255,1,48,2,0,2,0,1,195,2,255,
+    1,143,5,0,1,45,2,255,1,201,2,0,1,172,2,255,1,94,5,0,1,104,2,255,
+    1,230,1,1,2,0,2,0,1,125,2,255,1,210,5,0,1,109,2,255,1,139,2,0,
+    1,109,2,255,1,158,5,0,1,170,2,255,1,158,3,0,2,0,1,54,2,255,1,254,
+    1,22,4,0,1,174,2,255,1,77,2,0,1,46,2,255,1,222,4,0,1,1,1,234,
+    2,255,1,85,3,0,2,0,1,2,1,237,2,255,1,88,3,0,1,1,1,236,1,255,
+    1,253,1,16,2,0,1,1,1,237,2,255,1,30,3,0,1,46,2,255,1,251,1,16,
+    3,0,3,0,1,169,2,255,1,154,3,0,1,47,2,255,1,206,4,0,1,176,2,255,
+    1,94,3,0,1,112,2,255,1,194,4,0,3,0,1,98,2,255,1,221,3,0,1,111,
+    2,255,1,143,4,0,1,113,2,255,1,157,3,0,1,177,2,255,1,121,4,0,3,0,
+    1,28,3,255,1,31,2,0,1,174,2,255,1,79,4,0,1,50,2,255,1,220,2,0,
+    1,3,1,240,2,255,1,48,4,0,4,0,1,213,2,255,1,97,1,0,1,1,1,235,
+    1,255,1,254,1,18,4,0,1,2,1,240,2,255,1,27,1,0,1,54,2,255,1,230,
+    1,1,4,0,4,0,1,143,2,255,1,163,1,0,1,44,2,255,1,208,6,0,1,181,
+    2,255,1,91,1,0,1,119,2,255,1,158,5,0,4,0,1,72,2,255,1,226,1,0,
+    1,108,2,255,1,145,6,0,1,118,2,255,1,152,1,0,1,184,2,255,1,85,5,0,
+    4,0,1,9,1,248,2,255,1,33,1,170,2,255,1,81,6,0,1,55,2,255,1,211,
+    1,3,1,242,1,255,1,252,1,16,5,0,5,0,1,187,2,255,1,96,1,230,1,255,
+    1,254,1,19,6,0,1,4,1,243,1,255,1,254,1,74,2,255,1,195,6,0,5,0,
+    1,117,2,255,1,196,2,255,1,210,8,0,1,185,2,255,1,200,2,255,1,122,6,0,
+    5,0,1,46,5,255,1,147,8,0,1,122,5,255,1,49,6,0,6,0,1,230,4,255,
+    1,83,8,0,1,59,4,255,1,231,1,1,6,0,1,0,1,18,1,229,2,255,1,227,
+    1,13,8,0,1,141,3,255,1,85,1,0,2,0,1,71,1,254,2,255,1,146,7,0,
+    1,49,1,252,2,255,1,162,2,0,3,0,1,148,2,255,1,253,1,54,5,0,1,3,
+    1,204,2,255,1,224,1,14,2,0,3,0,1,10,1,216,2,255,1,209,1,4,4,0,
+    1,113,2,255,1,253,1,61,3,0,4,0,1,53,1,251,2,255,1,120,3,0,1,30,
+    1,243,2,255,1,135,4,0,5,0,1,128,2,255,1,246,1,35,2,0,1,179,2,255,
+    1,206,1,5,4,0,5,0,1,4,1,202,2,255,1,187,1,0,1,85,2,255,1,246,
+    1,41,5,0,6,0,1,39,1,245,2,255,1,109,1,230,2,255,1,109,6,0,7,0,
+    1,107,5,255,1,184,1,1,6,0,7,0,1,1,1,184,3,255,1,236,1,25,7,0,
+    8,0,1,53,3,255,1,156,8,0,7,0,1,1,1,187,3,255,1,252,1,58,7,0,
+    7,0,1,115,5,255,1,221,1,12,6,0,6,0,1,47,1,248,2,255,1,137,1,239,
+    2,255,1,156,6,0,5,0,1,8,1,212,2,255,1,195,1,2,1,94,3,255,1,79,
+    5,0,5,0,1,146,2,255,1,245,1,36,2,0,1,179,2,255,1,234,1,23,4,0,
+    4,0,1,72,1,254,2,255,1,110,3,0,1,25,1,238,2,255,1,179,4,0,3,0,
+    1,21,1,231,2,255,1,193,1,1,4,0,1,93,3,255,1,103,3,0,3,0,1,177,
+    2,255,1,244,1,34,6,0,1,178,2,255,1,244,1,37,2,0,2,0,1,103,3,255,
+    1,108,7,0,1,25,1,238,2,255,1,200,1,4,1,0,1,0,1,38,1,245,2,255,
+    1,191,1,1,8,0,1,92,3,255,1,127,1,0,1,5,1,204,2,255,1,244,1,33,
+    10,0,1,177,2,255,1,251,1,54,1,10,1,242,2,255,1,128,11,0,1,210,2,255,
+    1,168,1,0,1,158,2,255,1,218,10,0,1,20,1,254,2,255,1,99,1,0,1,64,
+    3,255,1,53,9,0,1,86,3,255,1,30,1,0,1,1,1,223,2,255,1,143,9,0,
+    1,152,2,255,1,216,1,0,2,0,1,131,2,255,1,230,1,2,8,0,1,218,2,255,
+    1,146,1,0,2,0,1,37,3,255,1,68,7,0,1,27,3,255,1,77,1,0,3,0,
+    1,198,2,255,1,158,7,0,1,94,2,255,1,250,1,12,1,0,3,0,1,103,2,255,
+    1,240,1,7,6,0,1,161,2,255,1,194,2,0,3,0,1,16,1,248,2,255,1,82,
+    6,0,1,226,2,255,1,124,2,0,4,0,1,170,2,255,1,173,5,0,1,36,3,255,
+    1,55,2,0,4,0,1,76,2,255,1,248,1,15,4,0,1,103,2,255,1,238,1,3,
+    2,0,4,0,1,4,1,232,2,255,1,98,4,0,1,169,2,255,1,172,3,0,5,0,
+    1,142,2,255,1,189,3,0,1,1,1,234,2,255,1,102,3,0,5,0,1,48,2,255,
+    1,253,1,27,2,0,1,46,3,255,1,33,3,0,6,0,1,209,2,255,1,115,2,0,
+    1,112,2,255,1,219,4,0,6,0,1,115,2,255,1,204,2,0,1,175,2,255,1,150,
+    4,0,6,0,1,24,1,252,2,255,1,35,1,1,1,235,2,255,1,80,4,0,7,0,
+    1,182,2,255,1,124,1,43,2,255,1,251,1,15,4,0,7,0,1,87,2,255,1,214,
+    1,108,2,255,1,197,5,0,7,0,1,8,1,240,2,255,1,216,2,255,1,128,5,0,
+    8,0,1,154,5,255,1,58,5,0,8,0,1,59,4,255,1,240,1,4,5,0,9,0,
+    1,2,1,239,2,255,1,175,6,0,9,0,1,58,3,255,1,104,6,0,9,0,1,136,
+    3,255,1,28,6,0,9,0,1,220,2,255,1,204,7,0,8,0,1,70,3,255,1,110,
+    7,0,7,0,1,9,1,211,2,255,1,245,1,19,7,0,5,0,1,2,1,45,1,191,
+    3,255,1,139,8,0,4,0,1,135,1,249,4,255,1,226,1,16,8,0,4,0,1,188,
+    4,255,1,232,1,48,9,0,4,0,1,188,1,255,1,243,1,208,1,130,1,18,10,0,
+    1,0,1,216,15,255,1,80,1,0,1,216,15,255,1,80,1,0,1,216,15,255,1,80,
+    12,0,1,26,1,227,2,255,1,251,1,49,11,0,1,11,1,205,3,255,1,102,1,0,
+    10,0,1,2,1,178,3,255,1,138,2,0,10,0,1,145,3,255,1,173,1,1,2,0,
+    9,0,1,108,3,255,1,201,1,9,3,0,8,0,1,75,1,252,2,255,1,224,1,23,
+    4,0,7,0,1,48,1,243,2,255,1,240,1,43,5,0,6,0,1,27,1,228,2,255,
+    1,251,1,68,6,0,5,0,1,11,1,206,3,255,1,100,7,0,4,0,1,3,1,179,
+    3,255,1,136,8,0,4,0,1,146,3,255,1,170,1,1,8,0,3,0,1,110,3,255,
+    1,200,1,8,9,0,2,0,1,76,1,252,2,255,1,222,1,22,10,0,1,0,1,49,
+    1,244,2,255,1,239,1,41,11,0,1,27,1,229,2,255,1,250,1,66,12,0,1,205,
+    3,255,1,98,13,0,1,248,16,255,1,80,1,248,16,255,1,80,1,248,16,255,1,80,
+    5,0,1,76,1,185,1,236,1,254,1,255,1,96,4,0,1,129,5,255,1,96,3,0,
+    1,58,4,255,1,249,1,204,1,70,3,0,1,171,3,255,1,155,1,17,2,0,2,0,
+    1,1,1,242,2,255,1,187,4,0,2,0,1,31,3,255,1,77,4,0,2,0,1,52,
+    3,255,1,26,4,0,2,0,1,62,3,255,1,10,4,0,2,0,1,64,3,255,1,8,
+    4,0,2,0,1,64,3,255,1,8,4,0,2,0,1,64,3,255,1,8,4,0,2,0,
+    1,64,3,255,1,8,4,0,2,0,1,64,3,255,1,8,4,0,2,0,1,64,3,255,
+    1,8,4,0,2,0,1,64,3,255,1,8,4,0,2,0,1,69,3,255,1,5,4,0,
+    2,0,1,95,2,255,1,238,5,0,2,0,1,165,2,255,1,199,5,0,1,0,1,61,
+    1,249,2,255,1,110,5,0,1,136,1,244,2,255,1,203,1,7,5,0,1,252,2,255,
+    1,170,1,21,6,0,1,252,2,255,1,183,1,26,6,0,1,130,1,242,2,255,1,209,
+    1,9,5,0,1,0,1,57,1,248,2,255,1,114,5,0,2,0,1,161,2,255,1,202,
+    5,0,2,0,1,95,2,255,1,239,5,0,2,0,1,68,3,255,1,5,4,0,2,0,
+    1,64,3,255,1,8,4,0,2,0,1,64,3,255,1,8,4,0,2,0,1,64,3,255,
+    1,8,4,0,2,0,1,64,3,255,1,8,4,0,2,0,1,64,3,255,1,8,4,0,
+    2,0,1,64,3,255,1,8,4,0,2,0,1,64,3,255,1,8,4,0,2,0,1,61,
+    3,255,1,10,4,0,2,0,1,51,3,255,1,28,4,0,2,0,1,28,3,255,1,79,
+    4,0,3,0,1,239,2,255,1,186,4,0,3,0,1,166,3,255,1,153,1,17,2,0,
+    3,0,1,54,1,254,3,255,1,251,1,214,1,76,4,0,1,124,5,255,1,96,5,0,
+    1,74,1,185,1,237,1,254,1,255,1,96,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,3,255,1,72,
+    3,255,1,72,1,252,1,255,1,246,1,214,1,132,1,13,5,0,1,252,4,255,1,216,
+    1,22,4,0,1,252,5,255,1,169,4,0,1,4,1,35,1,125,1,250,2,255,1,254,
+    1,28,3,0,3,0,1,94,3,255,1,101,3,0,3,0,1,1,1,224,2,255,1,146,
+    3,0,4,0,1,168,2,255,1,169,3,0,4,0,1,147,2,255,1,181,3,0,4,0,
+    1,144,2,255,1,184,3,0,4,0,1,144,2,255,1,184,3,0,4,0,1,144,2,255,
+    1,184,3,0,4,0,1,144,2,255,1,184,3,0,4,0,1,144,2,255,1,184,3,0,
+    4,0,1,144,2,255,1,184,3,0,4,0,1,144,2,255,1,184,3,0,4,0,1,141,
+    2,255,1,187,3,0,4,0,1,120,2,255,1,211,3,0,4,0,1,83,2,255,1,251,
+    1,24,2,0,4,0,1,9,1,242,2,255,1,157,2,0,5,0,1,101,3,255,1,179,
+    1,34,6,0,1,102,1,242,2,255,1,96,6,0,1,91,1,237,2,255,1,96,5,0,
+    1,90,3,255,1,197,1,40,4,0,1,7,1,238,2,255,1,172,1,2,1,0,4,0,
+    1,79,2,255,1,253,1,30,2,0,4,0,1,119,2,255,1,213,3,0,4,0,1,141,
+    2,255,1,189,3,0,4,0,1,144,2,255,1,184,3,0,4,0,1,144,2,255,1,184,
+    3,0,4,0,1,144,2,255,1,184,3,0,4,0,1,144,2,255,1,184,3,0,4,0,
+    1,144,2,255,1,184,3,0,4,0,1,144,2,255,1,184,3,0,4,0,1,144,2,255,
+    1,184,3,0,4,0,1,146,2,255,1,182,3,0,4,0,1,163,2,255,1,171,3,0,
+    4,0,1,214,2,255,1,150,3,0,3,0,1,69,3,255,1,107,3,0,2,0,1,74,
+    1,235,3,255,1,34,3,0,1,186,1,227,4,255,1,177,4,0,1,252,4,255,1,221,
+    1,26,4,0,1,252,1,255,1,247,1,216,1,135,1,16,5,0,3,0,1,15,1,133,
+    1,220,1,248,1,219,1,146,1,44,10,0,1,43,1,142,1,15,1,0,2,0,1,39,
+    1,222,6,255,1,179,1,45,7,0,1,1,1,194,1,255,1,214,1,1,1,0,1,22,
+    1,227,8,255,1,253,1,160,1,28,5,0,1,142,2,255,1,117,1,0,1,0,1,182,
+    2,255,1,168,1,36,1,8,1,60,1,160,1,252,3,255,1,249,1,156,1,60,1,10,
+    1,44,1,169,2,255,1,211,1,5,1,0,1,82,2,255,1,156,5,0,1,39,1,177,
+    9,255,1,240,1,40,2,0,1,206,1,255,1,215,1,7,7,0,1,64,1,203,6,255,
+    1,231,1,53,3,0,1,45,1,206,1,75,10,0,1,73,1,170,1,232,1,250,1,219,
+    1,137,1,19,4,0,1,0,1,4,22,0,
+};
+
+constexpr BakedFont BAKED_FONT_48 =
+{
+    48, 49,
+    {
+        {0, 39, 0, 0, 12, 12, 0},
+        {3, 7, 5, 32, 12, 12, 0},
+        {2, 7, 11, 13, 15, 15, 190},
+        {2, 7, 26, 32, 29, 29, 372},
+        {1, 4, 28, 39, 29, 29, 934},
+        {0, 7, 37, 32, 38, 38, 1790},
+        {2, 7, 32, 32, 34, 34, 2704},
+        {2, 7, 4, 13, 8, 8, 3440},
+        {2, 6, 9, 43, 13, 13, 3520},
+        {2, 6, 9, 43, 13, 13, 3900},
+        {6, 7, 18, 17, 29, 29, 4276},
+        {3, 12, 23, 22, 29, 29, 4592},
+        {2, 35, 5, 9, 10, 10, 4800},
+        {0, 26, 10, 3, 10, 10, 4876},
+        {2, 35, 5, 4, 9, 9, 4894},
+        {0, 7, 32, 42, 35, 31, 4918},
+        {2, 7, 26, 32, 29, 29, 5430},
+        {4, 7, 15, 32, 29, 29, 6028},
+        {2, 7, 24, 32, 29, 29, 6382},
+        {2, 7, 25, 32, 29, 29, 6844},
+        {1, 7, 27, 32, 29, 29, 7428},
+        {3, 7, 24, 32, 29, 29, 7936},
+        {2, 7, 25, 32, 29, 29, 8400},
+        {2, 7, 24, 32, 29, 29, 9020},
+        {2, 7, 25, 32, 29, 29, 9370},
+        {2, 7, 25, 32, 29, 29, 10058},
+        {2, 17, 5, 22, 9, 9, 10670},
+        {1, 17, 5, 27, 9, 9, 10746},
+        {0, 11, 21, 24, 21, 21, 10874},
+        {3, 17, 23, 12, 29, 29, 11194},
+        {0, 11, 21, 24, 21, 21, 11242},
+        {2, 7, 21, 32, 25, 25, 11558},
+        {1, 11, 28, 28, 30, 30, 11952},
+        {0, 7, 29, 32, 29, 29, 12832},
+        {3, 7, 25, 32, 30, 30, 13404},
+        {1, 7, 27, 32, 29, 29, 13920},
+        {3, 7, 27, 32, 31, 31, 14452},
+        {1, 7, 22, 32, 24, 24, 14952},
+        {3, 7, 20, 32, 23, 23, 15196},
+        {1, 7, 28, 32, 30, 30, 15440},
+        {3, 7, 26, 32, 32, 32, 16010},
+        {3, 7, 4, 32, 10, 10, 16434},
+        {1, 7, 21, 32, 24, 24, 16626},
+        {3, 7, 27, 32, 30, 29, 17002},
+        {3, 7, 21, 32, 24, 23, 17592},
+        {3, 7, 36, 32, 41, 41, 17842},
+        {3, 7, 28, 32, 33, 33, 18766},
+        {1, 7, 28, 32, 29, 29, 19462},
+        {3, 7, 25, 32, 28, 28, 20080},
+        {1, 7, 30, 32, 31, 31, 20494},
+        {3, 7, 25, 32, 30, 30, 21228},
+        {1, 7, 25, 32, 27, 27, 21708},
+        {0, 7, 25, 32, 25, 25, 22294},
+        {3, 7, 26, 32, 31, 31, 22602},
+        {0, 7, 29, 32, 29, 27, 23116},
+        {0, 7, 48, 32, 48, 48, 23718},
+        {0, 7, 30, 32, 30, 28, 24804},
+        {0, 7, 29, 32, 29, 27, 25468},
+        {1, 7, 26, 32, 27, 27, 25968},
+        {2, 7, 9, 42, 13, 13, 26330},
+        {0, 7, 32, 42, 35, 31, 26658},
+        {2, 7, 9, 42, 13, 13, 27170},
+        {0, 7, 22, 14, 22, 21, 27498},
+        {0, 42, 24, 3, 24, 24, 27768},
+        {6, 7, 9, 8, 24, 24, 27774},
+        {2, 17, 20, 22, 24, 24, 27860},
+        {2, 7, 21, 32, 25, 25, 28284},
+        {2, 17, 20, 22, 23, 23, 28768},
+        {2, 7, 20, 32, 25, 25, 29118},
+        {2, 17, 20, 22, 24, 24, 29598},
+        {0, 6, 13, 33, 13, 13, 29942},
+        {2, 17, 20, 32, 25, 25, 30274},
+        {2, 7, 20, 32, 25, 25, 30844},
+        {2, 7, 5, 32, 9, 9, 31270},
+        {0, 7, 7, 41, 10, 9, 31438},
+        {2, 7, 20, 32, 22, 21, 31740},
+        {2, 7, 5, 32, 9, 9, 32206},
+        {2, 17, 35, 22, 40, 40, 32398},
+        {2, 17, 20, 22, 25, 25, 32972},
+        {2, 17, 21, 22, 24, 24, 33328},
+        {2, 17, 21, 32, 25, 25, 33750},
+        {2, 17, 20, 32, 24, 24, 34238},
+        {3, 17, 16, 22, 19, 19, 34724},
+        {1, 17, 20, 22, 23, 23, 34968},
+        {0, 11, 17, 28, 17, 16, 35360},
+        {2, 17, 20, 22, 24, 24, 35686},
+        {0, 17, 21, 22, 21, 19, 36036},
+        {0, 17, 33, 22, 33, 32, 36446},
+        {0, 17, 21, 22, 21, 19, 37166},
+        {0, 17, 20, 32, 20, 19, 37594},
+        {1, 17, 18, 22, 19, 19, 38112},
+        {4, 7, 11, 42, 18, 18, 38352},
+        {0, 7, 4, 40, 4, 3, 38796},
+        {4, 7, 11, 42, 18, 18, 38956},
+        {0, 4, 24, 8, 24, 23, 39402},
+    },
+    BAKED_RUNS_48
+};
+
+constexpr unsigned char BAKED_RUNS_24[] =
+{
+    1,30,1,255,1,212,1,26,1,255,1,207,1,22,1,255,1,202,1,17,1,255,1,197,
+    1,13,1,255,1,192,1,9,1,255,1,187,1,4,1,255,1,182,1,0,1,255,1,177,
+    1,0,1,252,1,172,1,0,1,247,1,167,1,0,1,243,1,162,1,0,1,238,1,158,
+    3,0,3,0,1,8,1,255,1,200,1,8,1,255,1,200,1,228,1,174,1,0,1,52,
+    1,255,1,98,1,218,1,164,1,0,1,42,1,255,1,88,1,209,1,154,1,0,1,32,
+    1,255,1,78,1,200,1,144,1,0,1,22,1,255,1,68,1,190,1,134,1,0,1,12,
+    1,255,1,58,1,181,1,124,1,0,1,2,1,255,1,48,4,0,1,125,1,199,3,0,
+    1,173,1,155,2,0,4,0,1,165,1,158,3,0,1,213,1,114,2,0,4,0,1,205,
+    1,117,2,0,1,4,1,249,1,73,2,0,4,0,1,243,1,76,2,0,1,39,1,255,
+    1,32,2,0,3,0,1,28,1,255,1,36,2,0,1,80,1,246,1,1,2,0,1,13,
+    1,254,10,255,1,135,3,0,1,115,1,208,3,0,1,163,1,161,3,0,3,0,1,152,
+    1,171,3,0,1,200,1,125,3,0,3,0,1,189,1,134,3,0,1,237,1,89,3,0,
+    3,0,1,226,1,98,2,0,1,17,1,255,1,53,3,0,1,206,10,255,1,207,1,0,
+    2,0,1,53,1,255,1,12,2,0,1,101,1,223,4,0,2,0,1,95,1,226,3,0,
+    1,143,1,182,4,0,2,0,1,136,1,185,3,0,1,184,1,141,4,0,2,0,1,178,
+    1,144,3,0,1,226,1,100,4,0,2,0,1,219,1,104,2,0,1,12,1,254,1,60,
+    4,0,6,0,1,76,1,255,1,16,6,0,1,0,1,1,1,96,1,180,1,223,1,245,
+    1,253,1,255,1,253,1,244,1,226,1,182,1,82,2,0,1,0,1,132,1,255,1,191,
+    1,120,1,98,1,140,1,255,1,106,1,102,1,128,1,219,1,255,1,72,1,0,1,3,
+    1,242,1,203,1,1,2,0,1,76,1,255,1,16,2,0,1,51,1,255,1,157,1,0,
+    1,34,1,255,1,144,3,0,1,76,1,255,1,16,2,0,1,14,1,255,1,180,1,0,
+    1,44,1,255,1,141,3,0,1,76,1,255,1,16,6,0,1,27,1,255,1,173,3,0,
+    1,76,1,255,1,16,6,0,1,0,1,228,1,246,1,59,2,0,1,76,1,255,1,16,
+    6,0,1,0,1,94,1,253,1,255,1,233,1,206,1,216,1,255,1,195,1,182,1,156,
+    1,108,1,25,2,0,2,0,1,35,1,108,1,147,1,166,1,197,1,255,1,189,1,194,
+    1,225,1,255,1,245,1,60,1,0,6,0,1,76,1,255,1,16,2,0,1,67,1,253,
+    1,196,1,0,6,0,1,76,1,255,1,16,3,0,1,195,1,251,1,3,1,87,1,255,
+    1,110,3,0,1,76,1,255,1,16,3,0,1,169,1,255,1,15,1,62,1,255,1,126,
+    3,0,1,76,1,255,1,16,3,0,1,195,1,254,1,4,1,11,1,246,1,192,3,0,
+    1,76,1,255,1,16,2,0,1,24,1,243,1,209,1,0,1,0,1,133,1,255,1,204,
+    1,146,1,128,1,160,1,255,1,53,1,11,1,55,1,198,1,255,1,89,1,0,1,0,
+    1,2,1,121,1,218,1,249,3,255,1,252,1,243,1,220,1,170,1,70,2,0,6,0,
+    1,76,1,255,1,16,6,0,6,0,1,76,1,255,1,16,6,0,1,4,1,149,1,228,
+    2,250,1,227,1,144,6,0,1,34,1,230,1,30,3,0,1,85,1,198,1,32,1,3,
+    1,5,1,34,1,222,1,47,4,0,1,1,1,193,1,99,4,0,1,132,1,118,4,0,
+    1,164,1,84,4,0,1,112,1,181,5,0,1,148,1,102,4,0,1,156,1,96,3,0,
+    1,38,1,228,1,25,5,0,1,148,1,103,4,0,1,156,1,95,2,0,1,2,1,198,
+    1,89,6,0,1,132,1,121,4,0,1,166,1,81,2,0,1,118,1,172,7,0,1,87,
+    1,198,1,37,1,7,1,4,1,56,1,239,1,42,1,0,1,42,1,225,1,20,7,0,
+    1,6,1,155,1,227,1,251,1,252,1,229,1,138,1,0,1,4,1,203,1,80,8,0,
+    8,0,1,125,1,162,1,0,1,3,1,146,1,227,2,250,1,228,1,147,1,0,7,0,
+    1,47,1,222,1,16,1,0,1,81,1,203,1,34,1,3,1,4,1,33,1,217,1,51,
+    6,0,1,5,1,207,1,72,2,0,1,128,1,126,4,0,1,156,1,88,6,0,1,131,
+    1,153,3,0,1,144,1,110,4,0,1,148,1,100,5,0,1,51,1,218,1,12,3,0,
+    1,144,1,111,4,0,1,148,1,99,4,0,1,7,1,210,1,64,4,0,1,128,1,129,
+    4,0,1,158,1,86,4,0,1,137,1,144,5,0,1,83,1,203,1,39,1,8,1,3,
+    1,52,1,235,1,47,3,0,1,56,1,214,1,9,5,0,1,5,1,153,1,227,1,250,
+    1,252,1,230,1,143,1,0,3,0,1,84,1,188,1,233,1,250,1,249,1,229,1,176,
+    1,58,5,0,2,0,1,74,7,255,1,246,1,33,4,0,2,0,1,168,1,255,1,119,
+    1,23,1,2,1,5,1,31,1,169,1,255,1,117,4,0,2,0,1,200,1,245,1,1,
+    4,0,1,65,1,255,1,148,4,0,2,0,1,192,1,249,1,9,4,0,1,49,1,255,
+    1,153,4,0,2,0,1,110,1,255,1,145,1,1,10,0,2,0,1,4,1,191,1,255,
+    1,173,1,11,9,0,1,0,1,87,1,209,1,255,1,241,1,255,1,208,1,31,8,0,
+    1,56,1,255,1,190,1,49,1,1,1,117,1,253,1,234,1,60,7,0,1,130,1,255,
+    1,54,3,0,1,73,1,240,1,249,1,99,1,0,1,164,1,255,1,36,2,0,1,155,
+    1,255,1,26,4,0,1,38,1,216,1,255,1,144,1,167,1,255,1,36,2,0,1,154,
+    1,255,1,31,5,0,1,15,1,181,1,255,1,252,1,255,1,22,2,0,1,135,1,255,
+    1,68,6,0,1,2,1,137,1,255,1,254,1,40,2,0,1,83,1,255,1,198,1,63,
+    1,23,1,6,1,1,1,7,1,21,1,60,1,158,2,255,1,240,1,72,1,0,1,6,
+    1,216,9,255,1,234,1,78,1,222,1,252,1,101,1,0,1,20,1,126,1,190,1,224,
+    1,244,1,252,1,249,1,234,1,196,1,130,1,20,1,0,1,20,1,184,1,53,1,228,
+    1,174,1,218,1,164,1,209,1,154,1,200,1,144,1,190,1,134,1,181,1,124,4,0,
+    1,4,1,0,1,103,1,210,1,245,1,116,1,60,1,255,1,245,1,157,1,60,1,123,
+    1,255,1,103,2,0,1,151,1,255,1,55,2,0,1,170,1,255,1,36,2,0,1,182,
+    1,255,1,26,2,0,1,192,1,255,1,22,2,0,1,197,1,255,1,20,2,0,1,201,
+    1,255,1,20,2,0,1,203,1,255,1,20,2,0,1,204,1,255,1,20,2,0,1,203,
+    1,255,1,20,2,0,1,201,1,255,1,20,2,0,1,197,1,255,1,20,2,0,1,192,
+    1,255,1,22,2,0,1,182,1,255,1,26,2,0,1,170,1,255,1,36,2,0,1,151,
+    1,255,1,55,2,0,1,123,1,255,1,104,2,0,1,60,1,255,1,246,1,160,1,61,
+    1,0,1,103,1,211,1,247,1,116,1,4,4,0,1,202,1,238,1,184,1,46,1,0,
+    1,107,1,187,1,255,1,222,1,0,2,0,1,195,1,255,1,29,2,0,1,145,1,255,
+    1,58,2,0,1,126,1,255,1,77,2,0,1,116,1,255,1,89,2,0,1,111,1,255,
+    1,98,2,0,1,108,1,255,1,104,2,0,1,109,1,255,1,107,2,0,1,111,1,255,
+    1,110,2,0,1,112,1,255,1,111,2,0,1,112,1,255,1,110,2,0,1,112,1,255,
+    1,107,2,0,1,112,1,255,1,104,2,0,1,115,1,255,1,98,2,0,1,120,1,255,
+    1,89,2,0,1,130,1,255,1,77,2,0,1,150,1,255,1,58,2,0,1,200,1,255,
+    1,30,1,110,1,192,1,255,1,222,1,0,1,202,1,239,1,184,1,46,1,0,3,0,
+    1,56,1,248,4,0,3,0,1,56,1,248,4,0,1,94,1,76,1,4,1,56,1,248,
+    1,0,1,15,1,101,1,57,1,159,1,253,1,233,1,175,1,251,1,166,1,246,1,243,
+    1,100,1,0,1,30,1,129,1,237,1,255,1,212,1,101,1,12,1,0,2,0,1,44,
+    1,245,1,194,1,205,1,5,2,0,1,0,1,11,1,214,1,147,1,8,1,212,1,137,
+    2,0,1,0,1,117,1,204,1,6,1,0,1,48,1,242,1,26,1,0,1,0,1,2,
+    1,19,3,0,1,20,2,0,5,0,1,116,1,255,1,48,4,0,5,0,1,116,1,255,
+    1,48,4,0,5,0,1,116,1,255,1,48,4,0,5,0,1,116,1,255,1,48,4,0,
+    5,0,1,116,1,255,1,48,4,0,1,48,10,255,1,232,1,48,10,255,1,232,5,0,
+    1,116,1,255,1,48,4,0,5,0,1,116,1,255,1,48,4,0,5,0,1,116,1,255,
+    1,48,4,0,5,0,1,116,1,255,1,48,4,0,5,0,1,116,1,255,1,48,4,0,
+    1,124,1,255,1,80,1,124,1,255,1,80,1,0,1,197,1,68,1,116,1,196,1,9,
+    1,19,2,0,1,251,3,255,1,252,1,254,3,255,1,252,1,144,1,255,1,64,1,144,
+    1,255,1,64,13,0,1,6,1,211,1,121,13,0,1,134,1,203,1,3,12,0,1,52,
+    1,244,1,42,1,0,11,0,1,7,1,213,1,119,2,0,11,0,1,137,1,201,1,3,
+    2,0,10,0,1,55,1,244,1,41,3,0,9,0,1,8,1,215,1,117,4,0,9,0,
+    1,139,1,199,1,2,4,0,8,0,1,57,1,244,1,39,5,0,7,0,1,9,1,217,
+    1,115,6,0,7,0,1,142,1,197,1,2,6,0,6,0,1,59,1,244,1,38,7,0,
+    5,0,1,10,1,219,1,112,8,0,5,0,1,145,1,195,1,2,8,0,4,0,1,62,
+    1,243,1,36,9,0,3,0,1,11,1,221,1,110,10,0,3,0,1,148,1,193,1,1,
+    10,0,2,0,1,65,1,243,1,34,11,0,1,0,1,12,1,222,1,108,12,0,1,0,
+    1,151,1,191,1,1,12,0,1,67,1,243,1,33,13,0,1,0,1,48,1,152,1,205,
+    1,235,1,247,1,253,1,244,1,229,1,195,1,131,1,21,1,0,1,38,1,250,9,255,
+    1,217,1,2,1,126,1,255,1,188,1,67,1,24,1,8,1,2,1,10,1,34,1,88,
+    1,227,1,255,1,54,1,175,1,255,1,37,7,0,1,110,1,255,1,100,1,202,1,247,
+    1,1,7,0,1,64,1,255,1,126,1,219,1,226,8,0,1,44,1,255,1,144,1,226,
+    1,214,8,0,1,32,1,255,1,154,1,231,1,210,8,0,1,27,1,255,1,158,1,229,
+    1,209,8,0,1,27,1,255,1,157,1,224,1,214,8,0,1,32,1,255,1,153,1,213,
+    1,226,8,0,1,44,1,255,1,143,1,194,1,246,1,1,7,0,1,64,1,255,1,126,
+    1,165,1,255,1,37,7,0,1,110,1,255,1,97,1,117,1,255,1,187,1,66,1,23,
+    1,6,1,1,1,9,1,32,1,87,1,226,1,255,1,47,1,27,1,230,9,255,1,184,
+    1,0,1,0,1,23,1,126,1,192,1,231,1,246,1,253,1,243,1,222,1,178,1,98,
+    1,5,1,0,4,0,1,141,2,255,1,128,3,0,1,110,1,255,1,216,1,255,1,128,
+    2,0,1,82,1,253,1,182,1,84,1,255,1,128,1,0,1,58,1,247,1,206,1,12,
+    1,80,1,255,1,128,1,38,1,236,1,224,1,25,1,0,1,80,1,255,1,128,1,36,
+    1,208,1,42,2,0,1,80,1,255,1,128,1,0,1,1,3,0,1,80,1,255,1,128,
+    5,0,1,80,1,255,1,128,5,0,1,80,1,255,1,128,5,0,1,80,1,255,1,128,
+    5,0,1,80,1,255,1,128,5,0,1,80,1,255,1,128,5,0,1,80,1,255,1,128,
+    5,0,1,80,1,255,1,128,5,0,1,80,1,255,1,128,5,0,1,80,1,255,1,128,
+    1,0,1,31,1,141,1,202,1,233,1,248,1,253,1,243,1,216,1,160,1,47,1,0,
+    1,21,1,234,8,255,1,246,1,43,1,112,1,255,1,173,1,50,1,17,1,4,1,2,
+    1,11,1,48,1,170,1,255,1,149,1,155,1,255,1,38,6,0,1,14,1,252,1,200,
+    1,168,1,255,1,21,7,0,1,226,1,218,10,0,1,225,1,214,9,0,1,5,1,248,
+    1,186,8,0,1,6,1,121,1,255,1,116,2,0,1,6,1,54,1,99,1,132,1,164,
+    1,199,1,245,1,255,1,178,1,8,1,4,1,146,1,243,1,255,1,247,1,214,1,183,
+    1,152,1,107,1,40,2,0,1,98,1,255,1,195,1,51,1,3,7,0,1,161,1,255,
+    1,71,9,0,1,178,1,255,1,37,9,0,1,180,1,255,1,28,9,0,1,180,10,255,
+    1,212,1,180,10,255,1,212,1,0,1,31,1,148,1,209,1,238,1,250,1,252,1,243,
+    1,219,1,173,1,76,2,0,1,7,1,225,9,255,1,80,1,0,1,73,1,255,1,188,
+    1,47,1,14,1,4,1,2,1,11,1,36,1,131,1,255,1,179,1,0,1,111,1,255,
+    1,76,6,0,1,2,1,244,1,214,1,0,1,124,1,255,1,57,7,0,1,224,1,219,
+    1,0,9,0,1,1,1,240,1,198,1,0,6,0,1,3,1,13,1,37,1,128,1,255,
+    1,132,1,0,4,0,1,36,4,255,1,216,1,134,1,8,1,0,4,0,1,36,4,255,
+    1,239,1,176,1,42,1,0,7,0,1,3,1,20,1,82,1,243,1,217,1,0,10,0,
+    1,163,1,255,1,25,1,195,1,252,8,0,1,144,1,255,1,40,1,187,1,255,1,10,
+    7,0,1,171,1,255,1,28,1,150,1,255,1,135,1,35,1,13,1,3,1,1,1,5,
+    1,26,1,91,1,247,1,239,1,1,1,54,1,251,9,255,1,131,1,0,1,0,1,60,
+    1,163,1,212,1,239,1,250,1,254,1,246,1,225,1,183,1,99,1,2,1,0,7,0,
+    1,8,1,199,2,255,1,100,2,0,7,0,1,165,1,253,1,180,1,255,1,100,2,0,
+    6,0,1,125,1,255,1,115,1,104,1,255,1,100,2,0,5,0,1,84,1,254,1,155,
+    1,0,1,104,1,255,1,100,2,0,4,0,1,52,1,246,1,190,1,5,1,0,1,104,
+    1,255,1,100,2,0,3,0,1,27,1,229,1,217,1,17,2,0,1,104,1,255,1,100,
+    2,0,2,0,1,10,1,205,1,237,1,37,3,0,1,104,1,255,1,100,2,0,1,0,
+    1,1,1,173,1,250,1,65,4,0,1,104,1,255,1,100,2,0,1,0,1,133,1,255,
+    1,99,5,0,1,104,1,255,1,100,2,0,1,65,1,255,1,139,6,0,1,104,1,255,
+    1,100,2,0,1,92,12,255,1,200,1,92,12,255,1,200,9,0,1,104,1,255,1,100,
+    2,0,9,0,1,104,1,255,1,100,2,0,9,0,1,104,1,255,1,100,2,0,9,0,
+    1,104,1,255,1,100,2,0,1,36,10,255,1,160,1,0,1,36,10,255,1,160,1,0,
+    1,36,1,255,1,161,10,0,1,36,1,255,1,156,10,0,1,36,1,255,1,152,10,0,
+    1,36,1,255,1,147,1,84,1,186,1,233,1,250,1,247,1,226,1,178,1,79,2,0,
+    1,36,1,255,1,230,8,255,1,110,1,0,1,36,1,255,1,218,1,84,1,31,1,10,
+    1,2,1,9,1,35,1,109,1,250,1,233,1,2,10,0,1,168,1,255,1,38,10,0,
+    1,123,1,255,1,63,10,0,1,115,1,255,1,67,1,111,1,255,1,73,7,0,1,127,
+    1,255,1,56,1,98,1,255,1,107,7,0,1,168,1,255,1,26,1,53,1,255,1,219,
+    1,68,1,21,1,4,1,1,1,8,1,32,1,97,1,247,1,226,1,0,1,0,1,194,
+    9,255,1,112,1,0,1,0,1,13,1,120,1,193,1,230,1,247,1,253,1,246,1,224,
+    1,177,1,83,2,0,1,0,1,35,1,149,1,209,1,240,1,252,1,250,1,239,1,212,
+    1,159,1,52,2,0,1,25,1,238,8,255,1,250,1,51,1,0,1,120,1,255,1,187,
+    1,60,1,22,1,6,1,1,1,5,1,28,1,136,1,255,1,146,1,0,1,173,1,255,
+    1,43,6,0,1,19,1,255,1,173,1,0,1,196,1,255,1,17,10,0,1,205,1,255,
+    1,16,10,0,1,210,1,255,1,21,1,106,1,191,1,234,1,250,1,246,1,226,1,180,
+    1,82,2,0,1,214,1,255,1,189,8,255,1,98,1,0,1,213,1,255,1,166,1,52,
+    1,17,1,4,1,2,1,11,1,37,1,115,1,255,1,210,1,0,1,209,1,249,1,9,
+    7,0,1,203,1,253,1,6,1,204,1,230,8,0,1,167,1,255,1,22,1,194,1,242,
+    8,0,1,165,1,255,1,19,1,169,1,255,1,31,7,0,1,198,1,250,1,4,1,113,
+    1,255,1,183,1,58,1,19,1,4,1,1,1,9,1,34,1,108,1,254,1,202,1,0,
+    1,19,1,231,9,255,1,88,1,0,1,0,1,27,1,138,1,202,1,236,1,249,1,253,
+    1,244,1,219,1,170,1,73,2,0,1,216,10,255,1,208,1,216,10,255,1,208,9,0,
+    1,17,1,235,1,201,9,0,1,150,1,255,1,88,8,0,1,50,1,253,1,195,1,0,
+    7,0,1,1,1,199,1,253,1,49,1,0,7,0,1,99,1,255,1,153,2,0,6,0,
+    1,17,1,234,1,239,1,20,2,0,6,0,1,150,1,255,1,110,3,0,5,0,1,49,
+    1,253,1,213,1,4,3,0,4,0,1,1,1,198,1,255,1,68,4,0,4,0,1,98,
+    1,255,1,175,5,0,3,0,1,16,1,234,1,248,1,33,5,0,3,0,1,149,1,255,
+    1,132,6,0,2,0,1,49,1,252,1,228,1,11,6,0,1,0,1,1,1,198,1,255,
+    1,90,7,0,1,0,1,45,1,159,1,213,1,240,1,251,1,252,1,244,1,223,1,185,
+    1,106,1,1,1,0,1,22,1,241,9,255,1,117,1,0,1,101,1,255,1,174,1,42,
+    1,13,1,4,1,2,1,9,1,30,1,100,1,254,1,207,1,0,1,135,1,255,1,60,
+    7,0,1,208,1,240,1,0,1,141,1,255,1,42,7,0,1,192,1,248,1,0,1,120,
+    1,255,1,64,7,0,1,218,1,228,1,0,1,51,1,253,1,188,1,53,1,20,1,6,
+    1,1,1,4,1,26,1,112,1,255,1,153,1,0,1,0,1,67,1,187,6,255,1,230,
+    1,125,1,8,1,0,1,14,1,167,1,250,7,255,1,210,1,64,1,0,1,130,1,255,
+    1,160,1,45,1,15,1,4,1,2,1,12,1,36,1,107,1,251,1,230,1,1,1,183,
+    1,255,1,18,7,0,1,177,1,255,1,26,1,197,1,243,8,0,1,147,1,255,1,36,
+    1,187,1,248,8,0,1,157,1,255,1,23,1,149,1,255,1,40,6,0,1,3,1,213,
+    1,235,1,0,1,54,1,252,1,214,1,116,1,100,1,159,1,229,1,187,1,127,1,202,
+    1,255,1,132,1,0,1,0,1,63,1,164,1,212,1,239,1,250,1,254,1,247,1,226,
+    1,186,1,104,1,3,1,0,1,0,1,22,1,135,1,202,1,235,1,249,1,251,1,241,
+    1,212,1,160,1,58,2,0,1,10,1,222,8,255,1,254,1,75,1,0,1,89,1,255,
+    1,185,1,52,1,15,1,3,1,4,1,15,1,45,1,142,1,255,1,197,1,0,1,142,
+    1,255,1,50,6,0,1,1,1,229,1,249,1,5,1,164,1,255,1,17,7,0,1,188,
+    1,255,1,24,1,168,1,255,1,17,7,0,1,179,1,255,1,35,1,152,1,255,1,52,
+    7,0,1,207,1,255,1,38,1,105,1,255,1,185,1,50,1,12,1,1,1,3,1,13,
+    1,38,1,116,2,255,1,41,1,19,1,235,7,255,1,250,1,225,1,255,1,44,1,0,
+    1,37,1,157,1,217,1,245,1,253,1,243,1,218,1,162,1,53,1,172,1,255,1,46,
+    10,0,1,172,1,255,1,42,10,0,1,179,1,255,1,35,1,204,1,242,8,0,1,214,
+    1,255,1,17,1,184,1,255,1,113,1,27,1,8,1,1,1,2,1,11,1,37,1,118,
+    1,255,1,223,1,0,1,90,10,255,1,108,1,0,1,0,1,79,1,172,1,217,1,241,
+    1,251,1,253,1,244,1,220,1,174,1,83,2,0,1,144,1,255,1,64,1,144,1,255,
+    1,64,3,0,3,0,3,0,3,0,3,0,3,0,3,0,1,144,1,255,1,64,1,144,
+    1,255,1,64,1,20,1,255,1,184,1,20,1,255,1,184,3,0,3,0,3,0,3,0,
+    3,0,3,0,3,0,1,0,1,248,1,216,1,0,1,248,1,216,1,0,1,56,1,204,
+    1,27,1,189,1,99,1,15,1,4,1,0,9,0,1,32,1,43,7,0,1,44,1,163,
+    1,251,1,100,5,0,1,58,1,178,1,254,1,245,1,150,1,27,3,0,1,73,1,193,
+    1,255,1,232,1,124,1,19,2,0,1,3,1,88,1,208,1,255,1,212,1,99,1,7,
+    4,0,1,220,1,255,1,188,1,73,1,1,6,0,1,242,1,250,1,155,1,42,7,0,
+    1,16,1,120,1,230,1,254,1,182,1,67,5,0,2,0,1,6,1,98,1,213,1,255,
+    1,208,1,94,1,6,2,0,4,0,1,1,1,76,1,193,1,255,1,230,1,121,1,16,
+    7,0,1,54,1,171,1,253,1,100,9,0,1,35,1,44,1,48,10,255,1,232,1,48,
+    10,255,1,232,12,0,12,0,1,48,10,255,1,232,1,48,10,255,1,232,1,75,10,0,
+    1,255,1,209,1,89,1,3,7,0,1,105,1,218,1,255,1,221,1,103,1,7,5,0,
+    1,0,1,2,1,79,1,194,1,255,1,231,1,117,1,13,3,0,4,0,1,53,1,168,
+    1,251,1,239,1,132,1,21,1,0,6,0,1,30,1,141,1,241,1,246,1,71,6,0,
+    1,11,1,109,1,223,1,255,1,88,4,0,1,27,1,136,1,239,1,252,1,169,1,52,
+    1,0,2,0,1,50,1,164,1,250,1,244,1,146,1,33,3,0,1,77,1,191,1,255,
+    1,232,1,123,1,18,5,0,1,255,1,215,1,101,1,7,7,0,1,78,1,1,9,0,
+    1,0,1,61,1,171,1,221,1,245,1,253,1,245,1,215,1,145,1,19,1,0,1,40,
+    1,249,7,255,1,188,1,0,1,128,1,255,1,148,1,34,1,7,1,2,1,15,1,64,
+    1,230,1,255,1,24,1,166,1,255,1,17,5,0,1,142,1,255,1,58,1,179,1,250,
+    6,0,1,120,1,255,1,59,8,0,1,142,1,255,1,33,7,0,1,23,1,229,1,219,
+    1,0,5,0,1,48,1,144,1,238,1,250,1,72,1,0,4,0,1,165,1,255,1,239,
+    1,149,1,37,2,0,3,0,1,55,1,255,1,207,1,17,4,0,3,0,1,87,1,255,
+    1,111,5,0,11,0,11,0,11,0,3,0,1,120,1,255,1,88,5,0,3,0,1,120,
+    1,255,1,88,5,0,2,0,1,22,1,123,1,188,1,224,1,242,1,251,1,250,1,240,
+    1,212,1,165,1,71,2,0,1,0,1,23,1,224,1,134,1,62,1,29,1,10,1,3,
+    1,5,1,14,1,38,1,88,1,214,1,92,1,0,1,0,1,129,1,125,9,0,1,59,
+    1,206,1,0,1,0,1,195,1,50,1,0,1,19,1,172,1,240,1,250,1,218,1,137,
+    1,255,1,0,1,3,1,248,1,7,1,0,1,232,1,15,1,0,1,145,1,199,1,39,
+    1,8,1,51,1,215,1,255,2,0,1,229,1,28,1,0,1,248,2,0,1,207,1,98,
+    3,0,1,88,1,255,2,0,1,219,1,37,1,4,1,246,2,0,1,228,1,75,3,0,
+    1,55,1,255,2,0,1,219,1,34,1,2,1,248,2,0,1,227,1,75,3,0,1,61,
+    1,255,2,0,1,232,1,21,1,0,1,248,1,2,1,0,1,204,1,101,3,0,1,88,
+    1,255,1,4,1,11,1,247,1,3,1,0,1,226,1,26,1,0,1,141,1,202,1,38,
+    1,4,1,31,1,176,1,240,1,63,1,100,1,200,1,0,1,0,1,186,1,68,1,0,
+    1,18,1,173,1,242,1,248,1,206,1,70,1,101,1,237,1,232,1,66,1,0,1,0,
+    1,115,1,155,12,0,1,0,1,13,1,216,1,162,1,79,1,39,1,14,1,5,1,2,
+    1,15,1,57,1,174,1,88,2,0,2,0,1,11,1,108,1,179,1,217,1,240,1,250,
+    1,251,1,237,1,198,1,120,1,8,2,0,5,0,1,51,2,255,1,179,6,0,5,0,
+    1,145,1,255,1,238,1,251,1,23,5,0,4,0,1,4,1,233,1,239,1,107,1,255,
+    1,114,5,0,4,0,1,77,1,255,1,160,1,19,1,251,1,209,5,0,4,0,1,170,
+    1,255,1,74,1,0,1,184,1,255,1,49,4,0,3,0,1,15,1,247,1,239,1,6,
+    1,0,1,97,1,255,1,144,4,0,3,0,1,102,1,255,1,159,2,0,1,16,1,249,
+    1,234,1,5,3,0,3,0,1,196,1,255,1,73,3,0,1,179,1,255,1,79,3,0,
+    2,0,1,33,1,255,1,238,1,5,3,0,1,92,1,255,1,175,3,0,2,0,1,127,
+    1,255,1,158,4,0,1,13,1,247,1,250,1,20,2,0,2,0,1,219,1,255,1,72,
+    5,0,1,174,1,255,1,110,2,0,1,0,1,59,1,255,1,237,1,5,5,0,1,87,
+    1,255,1,205,2,0,1,0,1,152,11,255,1,45,1,0,1,7,1,238,1,249,1,21,
+    7,0,1,112,1,255,1,140,1,0,1,84,1,255,1,165,8,0,1,16,1,245,1,232,
+    1,4,1,177,1,255,1,60,9,0,1,157,1,255,1,76,1,120,7,255,1,246,1,222,
+    1,165,1,38,1,0,1,120,10,255,1,222,1,2,1,120,1,255,1,84,5,0,1,11,
+    1,54,1,215,1,255,1,50,1,120,1,255,1,84,7,0,1,112,1,255,1,81,1,120,
+    1,255,1,84,7,0,1,96,1,255,1,84,1,120,1,255,1,84,7,0,1,125,1,255,
+    1,52,1,120,1,255,1,84,4,0,1,2,1,18,1,71,1,230,1,203,1,0,1,120,
+    9,255,1,191,1,23,1,0,1,120,9,255,1,254,1,164,1,6,1,120,1,255,1,84,
+    4,0,1,3,1,12,1,38,1,137,1,255,1,113,1,120,1,255,1,84,7,0,1,4,
+    1,247,1,191,1,120,1,255,1,84,8,0,1,229,1,214,1,120,1,255,1,84,7,0,
+    1,4,1,250,1,202,1,120,1,255,1,84,5,0,1,5,1,33,1,147,1,255,1,155,
+    1,120,10,255,1,251,1,50,1,120,7,255,1,253,1,236,1,182,1,62,1,0,2,0,
+    1,16,1,114,1,180,1,216,1,239,1,248,1,253,1,242,1,212,1,149,1,29,1,0,
+    1,0,1,33,1,224,9,255,1,225,1,10,1,0,1,177,1,255,1,190,1,75,1,33,
+    1,13,1,5,1,2,1,13,1,54,1,201,1,255,1,87,1,0,1,243,1,251,1,20,
+    7,0,1,80,1,255,1,133,1,8,1,255,1,216,8,0,1,53,1,255,1,149,1,19,
+    1,255,1,199,11,0,1,24,1,255,1,196,11,0,1,27,1,255,1,199,11,0,1,24,
+    1,255,1,205,11,0,1,17,1,255,1,214,11,0,1,6,1,255,1,229,11,0,1,0,
+    1,235,1,251,1,3,8,0,1,250,1,206,1,0,1,197,1,255,1,46,7,0,1,11,
+    1,255,1,195,1,0,1,132,1,255,1,209,1,81,1,28,1,7,1,1,1,4,1,16,
+    1,44,1,152,1,255,1,159,1,0,1,25,1,232,10,255,1,72,2,0,1,26,1,133,
+    1,198,1,235,1,249,1,254,1,249,1,236,1,213,1,171,1,81,1,0,1,120,7,255,
+    1,247,1,226,1,174,1,74,2,0,1,120,11,255,1,126,1,0,1,120,1,255,1,84,
+    5,0,1,9,1,36,1,113,1,246,1,251,1,29,1,120,1,255,1,84,8,0,1,119,
+    1,255,1,107,1,120,1,255,1,84,8,0,1,47,1,255,1,153,1,120,1,255,1,84,
+    8,0,1,12,1,255,1,183,1,120,1,255,1,84,9,0,1,248,1,195,1,120,1,255,
+    1,84,9,0,1,241,1,201,1,120,1,255,1,84,9,0,1,239,1,194,1,120,1,255,
+    1,84,9,0,1,247,1,186,1,120,1,255,1,84,8,0,1,12,1,255,1,163,1,120,
+    1,255,1,84,8,0,1,52,1,255,1,135,1,120,1,255,1,84,8,0,1,136,1,255,
+    1,84,1,120,1,255,1,84,4,0,1,1,1,12,1,47,1,135,1,252,1,245,1,17,
+    1,120,11,255,1,119,1,0,1,120,7,255,1,252,1,234,1,185,1,82,2,0,1,32,
+    10,255,1,40,1,32,10,255,1,40,1,32,1,255,1,176,9,0,1,32,1,255,1,176,
+    9,0,1,32,1,255,1,176,9,0,1,32,1,255,1,176,9,0,1,32,1,255,1,176,
+    9,0,1,32,9,255,1,208,1,0,1,32,9,255,1,208,1,0,1,32,1,255,1,176,
+    9,0,1,32,1,255,1,176,9,0,1,32,1,255,1,176,9,0,1,32,1,255,1,176,
+    9,0,1,32,1,255,1,176,9,0,1,32,10,255,1,40,1,32,10,255,1,40,1,120,
+    9,255,1,84,1,120,9,255,1,84,1,120,1,255,1,84,8,0,1,120,1,255,1,84,
+    8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,
+    8,0,1,120,9,255,1,32,1,120,9,255,1,32,1,120,1,255,1,84,8,0,1,120,
+    1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,
+    1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,2,0,
+    1,19,1,121,1,188,1,225,1,244,1,253,1,249,1,240,1,217,1,176,1,97,1,1,
+    1,0,1,0,1,31,1,232,10,255,1,124,1,0,1,0,1,157,1,255,1,168,1,60,
+    1,22,1,7,1,1,1,5,1,18,1,44,1,127,1,255,1,226,1,0,1,0,1,229,
+    1,234,1,4,8,0,1,211,1,255,1,10,1,10,1,255,1,183,9,0,1,179,1,255,
+    1,22,1,24,1,255,1,164,12,0,1,30,1,255,1,158,12,0,1,31,1,255,1,156,
+    12,0,1,30,1,255,1,156,4,0,1,196,6,255,1,29,1,26,1,255,1,156,4,0,
+    1,196,6,255,1,34,1,18,1,255,1,161,9,0,1,160,1,255,1,28,1,5,1,253,
+    1,182,9,0,1,161,1,255,1,18,1,0,1,221,1,236,1,6,8,0,1,199,1,245,
+    1,0,1,0,1,156,1,255,1,175,1,69,1,30,1,10,1,3,1,2,1,10,1,37,
+    1,114,1,254,1,197,1,0,1,0,1,39,1,243,10,255,1,99,1,0,2,0,1,32,
+    1,135,1,196,1,231,1,246,1,253,1,249,1,238,1,212,1,168,1,82,2,0,1,120,
+    1,255,1,84,8,0,1,80,1,255,1,124,1,120,1,255,1,84,8,0,1,80,1,255,
+    1,124,1,120,1,255,1,84,8,0,1,80,1,255,1,124,1,120,1,255,1,84,8,0,
+    1,80,1,255,1,124,1,120,1,255,1,84,8,0,1,80,1,255,1,124,1,120,1,255,
+    1,84,8,0,1,80,1,255,1,124,1,120,1,255,1,84,8,0,1,80,1,255,1,124,
+    1,120,12,255,1,124,1,120,12,255,1,124,1,120,1,255,1,84,8,0,1,80,1,255,
+    1,124,1,120,1,255,1,84,8,0,1,80,1,255,1,124,1,120,1,255,1,84,8,0,
+    1,80,1,255,1,124,1,120,1,255,1,84,8,0,1,80,1,255,1,124,1,120,1,255,
+    1,84,8,0,1,80,1,255,1,124,1,120,1,255,1,84,8,0,1,80,1,255,1,124,
+    1,120,1,255,1,84,8,0,1,80,1,255,1,124,1,120,1,255,1,84,1,120,1,255,
+    1,84,1,120,1,255,1,84,1,120,1,255,1,84,1,120,1,255,1,84,1,120,1,255,
+    1,84,1,120,1,255,1,84,1,120,1,255,1,84,1,120,1,255,1,84,1,120,1,255,
+    1,84,1,120,1,255,1,84,1,120,1,255,1,84,1,120,1,255,1,84,1,120,1,255,
+    1,84,1,120,1,255,1,84,1,120,1,255,1,84,8,0,1,72,1,255,1,136,8,0,
+    1,72,1,255,1,136,8,0,1,72,1,255,1,136,8,0,1,72,1,255,1,136,8,0,
+    1,72,1,255,1,136,8,0,1,72,1,255,1,136,8,0,1,72,1,255,1,136,8,0,
+    1,72,1,255,1,136,8,0,1,72,1,255,1,136,8,0,1,72,1,255,1,136,1,91,
+    1,255,1,108,5,0,1,72,1,255,1,136,1,95,1,255,1,108,5,0,1,79,1,255,
+    1,130,1,86,1,255,1,126,5,0,1,112,1,255,1,112,1,49,1,255,1,216,1,50,
+    1,10,1,1,1,11,1,58,1,218,1,255,1,64,1,0,1,201,7,255,1,209,1,2,
+    1,0,1,19,1,139,1,210,1,243,1,253,1,245,1,214,1,144,1,20,1,0,1,120,
+    1,255,1,84,6,0,1,30,1,226,1,254,1,91,1,0,1,120,1,255,1,84,5,0,
+    1,22,1,217,1,255,1,110,2,0,1,120,1,255,1,84,4,0,1,16,1,207,1,255,
+    1,131,3,0,1,120,1,255,1,84,3,0,1,10,1,197,1,255,1,151,4,0,1,120,
+    1,255,1,84,2,0,1,6,1,185,1,255,1,170,1,2,4,0,1,120,1,255,1,84,
+    1,0,1,3,1,172,1,255,1,186,1,6,5,0,1,120,1,255,1,84,1,1,1,158,
+    1,255,1,201,1,12,6,0,1,120,4,255,1,215,1,19,7,0,1,120,4,255,1,230,
+    1,40,7,0,1,120,1,255,1,84,1,1,1,145,1,255,1,232,1,43,6,0,1,120,
+    1,255,1,84,2,0,1,135,1,255,1,234,1,46,5,0,1,120,1,255,1,84,3,0,
+    1,124,1,255,1,236,1,49,4,0,1,120,1,255,1,84,4,0,1,113,1,255,1,238,
+    1,51,3,0,1,120,1,255,1,84,5,0,1,103,1,254,1,240,1,55,2,0,1,120,
+    1,255,1,84,6,0,1,93,1,252,1,241,1,58,1,0,1,120,1,255,1,84,7,0,
+    1,84,1,250,1,243,1,61,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,
+    1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,
+    1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,
+    1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,
+    1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,1,120,1,255,1,84,8,0,
+    1,120,9,255,1,144,1,120,9,255,1,144,1,120,2,255,1,218,1,1,9,0,1,76,
+    3,255,1,20,1,120,1,255,1,238,1,255,1,68,9,0,1,180,1,255,1,228,1,255,
+    1,20,1,120,1,255,1,151,1,255,1,172,8,0,1,30,1,253,1,208,1,184,1,255,
+    1,20,1,120,1,255,1,85,1,218,1,251,1,25,7,0,1,132,1,255,1,105,1,184,
+    1,255,1,20,1,120,1,255,1,84,1,112,1,255,1,125,6,0,1,4,1,230,1,242,
+    1,12,1,184,1,255,1,20,1,120,1,255,1,84,1,15,1,244,1,226,1,3,5,0,
+    1,84,1,255,1,148,1,0,1,184,1,255,1,20,1,120,1,255,1,84,1,0,1,152,
+    1,255,1,78,5,0,1,188,1,255,1,42,1,0,1,184,1,255,1,20,1,120,1,255,
+    1,84,1,0,1,44,1,255,1,183,4,0,1,36,1,254,1,191,2,0,1,184,1,255,
+    1,20,1,120,1,255,1,84,2,0,1,193,1,253,1,33,3,0,1,140,1,255,1,85,
+    2,0,1,184,1,255,1,20,1,120,1,255,1,84,2,0,1,85,1,255,1,136,2,0,
+    1,7,1,236,1,230,1,4,2,0,1,184,1,255,1,20,1,120,1,255,1,84,2,0,
+    1,4,1,228,1,234,1,6,1,0,1,91,1,255,1,128,3,0,1,184,1,255,1,20,
+    1,120,1,255,1,84,3,0,1,125,1,255,1,88,1,0,1,199,1,251,1,26,3,0,
+    1,184,1,255,1,20,1,120,1,255,1,84,3,0,1,23,1,249,1,194,1,47,1,255,
+    1,172,4,0,1,184,1,255,1,20,1,120,1,255,1,84,4,0,1,166,1,255,1,192,
+    1,255,1,65,4,0,1,184,1,255,1,20,1,120,1,255,1,84,4,0,1,58,2,255,
+    1,214,5,0,1,184,1,255,1,20,1,120,1,255,1,84,5,0,1,205,1,255,1,109,
+    5,0,1,184,1,255,1,20,1,120,2,255,1,199,1,1,7,0,1,156,1,255,1,48,
+    1,120,1,255,1,239,1,255,1,99,7,0,1,156,1,255,1,48,1,120,1,255,1,120,
+    1,249,1,235,1,18,6,0,1,156,1,255,1,48,1,120,1,255,1,84,1,137,1,255,
+    1,153,6,0,1,156,1,255,1,48,1,120,1,255,1,84,1,13,1,231,1,253,1,54,
+    5,0,1,156,1,255,1,48,1,120,1,255,1,84,1,0,1,93,1,255,1,204,1,2,
+    4,0,1,156,1,255,1,48,1,120,1,255,1,84,2,0,1,189,1,255,1,106,4,0,
+    1,156,1,255,1,48,1,120,1,255,1,84,2,0,1,37,1,247,1,239,1,22,3,0,
+    1,156,1,255,1,48,1,120,1,255,1,84,3,0,1,124,1,255,1,160,3,0,1,156,
+    1,255,1,48,1,120,1,255,1,84,3,0,1,6,1,214,1,254,1,60,2,0,1,156,
+    1,255,1,48,1,120,1,255,1,84,4,0,1,60,1,254,1,211,1,4,1,0,1,156,
+    1,255,1,48,1,120,1,255,1,84,5,0,1,155,1,255,1,117,1,0,1,156,1,255,
+    1,48,1,120,1,255,1,84,5,0,1,17,1,232,1,244,1,31,1,156,1,255,1,48,
+    1,120,1,255,1,84,6,0,1,90,1,255,1,179,1,156,1,255,1,48,1,120,1,255,
+    1,84,7,0,1,184,1,255,1,224,1,255,1,48,1,120,1,255,1,84,7,0,1,34,
+    1,246,2,255,1,48,2,0,1,35,1,135,1,196,1,231,1,246,1,253,1,244,1,229,
+    1,194,1,134,1,33,2,0,1,0,1,73,1,248,9,255,1,243,1,43,1,0,1,4,
+    1,225,1,247,1,116,1,47,1,18,1,7,1,2,1,8,1,28,1,68,1,176,1,255,
+    1,158,1,0,1,53,1,255,1,163,8,0,1,3,1,224,1,222,1,0,1,91,1,255,
+    1,114,9,0,1,163,1,253,1,4,1,106,1,255,1,92,9,0,1,143,1,255,1,27,
+    1,113,1,255,1,78,9,0,1,140,1,255,1,37,1,116,1,255,1,74,9,0,1,140,
+    1,255,1,45,1,115,1,255,1,73,9,0,1,143,1,255,1,45,1,110,1,255,1,78,
+    9,0,1,148,1,255,1,38,1,98,1,255,1,91,9,0,1,160,1,255,1,25,1,76,
+    1,255,1,114,9,0,1,183,1,253,1,5,1,39,1,255,1,163,8,0,1,1,1,230,
+    1,223,1,0,1,2,1,234,1,247,1,115,1,46,1,17,1,5,1,1,1,7,1,24,
+    1,59,1,153,1,255,1,164,1,0,1,0,1,116,10,255,1,245,1,53,1,0,2,0,
+    1,69,1,159,1,207,1,237,1,248,1,253,1,245,1,230,1,196,1,138,1,38,2,0,
+    1,120,7,255,1,246,1,217,1,146,1,19,1,0,1,120,10,255,1,205,1,1,1,120,
+    1,255,1,84,5,0,1,7,1,47,1,202,1,255,1,58,1,120,1,255,1,84,7,0,
+    1,90,1,255,1,108,1,120,1,255,1,84,7,0,1,60,1,255,1,128,1,120,1,255,
+    1,84,7,0,1,57,1,255,1,130,1,120,1,255,1,84,7,0,1,94,1,255,1,112,
+    1,120,1,255,1,84,4,0,1,5,1,24,1,76,1,221,1,255,1,62,1,120,10,255,
+    1,206,1,2,1,120,7,255,1,245,1,215,1,144,1,19,1,0,1,120,1,255,1,84,
+    10,0,1,120,1,255,1,84,10,0,1,120,1,255,1,84,10,0,1,120,1,255,1,84,
+    10,0,1,120,1,255,1,84,10,0,1,120,1,255,1,84,10,0,2,0,1,56,1,151,
+    1,202,1,234,1,246,1,253,1,244,1,229,1,193,1,133,1,32,3,0,1,0,1,94,
+    1,254,9,255,1,242,1,41,2,0,1,0,1,224,1,247,1,116,1,48,1,19,1,7,
+    1,2,1,10,1,25,1,62,1,155,1,255,1,155,2,0,1,35,1,255,1,163,9,0,
+    1,228,1,220,2,0,1,72,1,255,1,114,9,0,1,184,1,252,1,3,1,0,1,96,
+    1,255,1,92,9,0,1,162,1,255,1,26,1,0,1,105,1,255,1,78,9,0,1,149,
+    1,255,1,37,1,0,1,111,1,255,1,74,9,0,1,141,1,255,1,44,1,0,1,109,
+    1,255,1,73,9,0,1,138,1,255,1,45,1,0,1,102,1,255,1,78,4,0,1,75,
+    1,121,1,4,2,0,1,137,1,255,1,42,1,0,1,88,1,255,1,91,4,0,1,138,
+    1,255,1,205,1,47,1,0,1,142,1,255,1,35,1,0,1,66,1,255,1,114,5,0,
+    1,70,1,223,1,251,1,131,1,167,1,255,1,22,1,0,1,32,1,255,1,163,6,0,
+    1,11,1,143,1,253,1,255,1,249,1,3,1,0,1,1,1,233,1,247,1,115,1,46,
+    1,17,1,5,1,1,1,5,1,17,1,42,1,154,1,255,1,254,1,148,1,12,1,0,
+    1,122,10,255,1,236,1,144,1,247,1,60,2,0,1,73,1,162,1,207,1,236,1,248,
+    1,253,1,243,1,226,1,184,1,119,1,22,1,0,1,22,1,0,1,120,7,255,1,250,
+    1,228,1,168,1,45,1,0,1,120,10,255,1,243,1,34,1,120,1,255,1,84,5,0,
+    1,4,1,34,1,162,1,255,1,138,1,120,1,255,1,84,7,0,1,18,1,255,1,190,
+    1,120,1,255,1,84,8,0,1,236,1,208,1,120,1,255,1,84,8,0,1,233,1,203,
+    1,120,1,255,1,84,7,0,1,22,1,254,1,176,1,120,1,255,1,84,5,0,1,12,
+    1,54,1,186,1,255,1,104,1,120,9,255,1,236,1,135,1,3,1,120,9,255,1,210,
+    1,101,1,0,1,120,1,255,1,84,5,0,1,7,1,64,1,227,1,255,1,61,1,120,
+    1,255,1,84,7,0,1,101,1,255,1,133,1,120,1,255,1,84,7,0,1,58,1,255,
+    1,155,1,120,1,255,1,84,7,0,1,52,1,255,1,156,1,120,1,255,1,84,7,0,
+    1,52,1,255,1,156,1,120,1,255,1,84,7,0,1,52,1,255,1,156,2,0,1,88,
+    1,176,1,220,1,244,1,253,1,249,1,237,1,210,1,154,1,41,1,0,1,0,1,120,
+    9,255,1,236,1,16,1,0,1,235,1,252,1,114,1,40,1,13,1,4,1,2,1,13,
+    1,49,1,202,1,255,1,88,1,27,1,255,1,177,7,0,1,95,1,255,1,120,1,40,
+    1,255,1,143,10,0,1,19,1,255,1,157,10,0,1,0,1,199,1,227,1,25,9,0,
+    1,0,1,44,1,231,1,253,1,221,1,192,1,175,1,159,1,140,1,109,1,60,1,3,
+    1,0,2,0,1,14,1,103,1,155,1,175,1,186,1,199,1,212,1,239,1,255,1,217,
+    1,24,9,0,1,1,1,103,1,255,1,131,10,0,1,3,1,252,1,181,1,69,1,255,
+    1,134,8,0,1,245,1,195,1,56,1,255,1,161,7,0,1,23,1,255,1,185,1,17,
+    1,254,1,242,1,82,1,25,1,6,1,1,1,4,1,18,1,50,1,168,1,255,1,144,
+    1,0,1,166,9,255,1,249,1,47,1,0,1,9,1,117,1,193,1,230,1,248,1,254,
+    1,249,1,236,1,209,1,159,1,56,1,0,1,236,11,255,1,68,1,236,11,255,1,68,
+    5,0,1,180,1,255,1,28,5,0,5,0,1,180,1,255,1,28,5,0,5,0,1,180,
+    1,255,1,28,5,0,5,0,1,180,1,255,1,28,5,0,5,0,1,180,1,255,1,28,
+    5,0,5,0,1,180,1,255,1,28,5,0,5,0,1,180,1,255,1,28,5,0,5,0,
+    1,180,1,255,1,28,5,0,5,0,1,180,1,255,1,28,5,0,5,0,1,180,1,255,
+    1,28,5,0,5,0,1,180,1,255,1,28,5,0,5,0,1,180,1,255,1,28,5,0,
+    5,0,1,180,1,255,1,28,5,0,5,0,1,180,1,255,1,28,5,0,1,120,1,255,
+    1,88,8,0,1,152,1,255,1,52,1,120,1,255,1,88,8,0,1,152,1,255,1,52,
+    1,120,1,255,1,88,8,0,1,152,1,255,1,52,1,120,1,255,1,88,8,0,1,152,
+    1,255,1,52,1,120,1,255,1,88,8,0,1,152,1,255,1,52,1,120,1,255,1,88,
+    8,0,1,152,1,255,1,52,1,120,1,255,1,88,8,0,1,152,1,255,1,52,1,120,
+    1,255,1,88,8,0,1,152,1,255,1,52,1,120,1,255,1,88,8,0,1,152,1,255,
+    1,52,1,120,1,255,1,88,8,0,1,152,1,255,1,52,1,120,1,255,1,88,8,0,
+    1,152,1,255,1,52,1,119,1,255,1,91,8,0,1,156,1,255,1,48,1,107,1,255,
+    1,122,8,0,1,188,1,255,1,30,1,61,1,255,1,230,1,78,1,27,1,7,1,1,
+    1,3,1,13,1,38,1,110,1,253,1,235,1,1,1,1,1,191,10,255,1,118,1,0,
+    1,0,1,9,1,111,1,184,1,224,1,245,1,253,1,251,1,241,1,216,1,170,1,84,
+    2,0,1,5,1,236,1,242,1,9,8,0,1,68,1,255,1,170,1,0,1,151,1,255,
+    1,86,8,0,1,156,1,255,1,79,1,0,1,59,1,255,1,176,7,0,1,5,2,238,
+    1,6,2,0,1,222,1,249,1,16,6,0,1,76,1,255,1,154,1,0,2,0,1,132,
+    1,255,1,100,6,0,1,164,1,255,1,64,1,0,2,0,1,39,1,255,1,189,5,0,
+    1,8,1,242,1,227,1,2,1,0,3,0,1,204,1,253,1,26,4,0,1,84,1,255,
+    1,139,2,0,3,0,1,112,1,255,1,113,4,0,1,172,1,255,1,48,2,0,3,0,
+    1,24,1,252,1,203,3,0,1,12,1,246,1,214,3,0,4,0,1,185,1,255,1,37,
+    2,0,1,92,1,255,1,123,3,0,4,0,1,93,1,255,1,127,2,0,1,180,1,255,
+    1,34,3,0,4,0,1,12,1,245,1,216,1,0,1,17,1,250,1,198,4,0,5,0,
+    1,166,1,255,1,50,1,98,1,255,1,108,4,0,5,0,1,74,1,255,1,138,1,184,
+    1,251,1,22,4,0,5,0,1,4,1,233,1,226,1,250,1,183,5,0,6,0,1,146,
+    2,255,1,93,5,0,1,209,1,250,1,15,7,0,1,142,2,255,1,104,7,0,1,31,
+    1,255,1,195,1,130,1,255,1,86,7,0,1,216,1,245,1,255,1,179,7,0,1,109,
+    1,255,1,114,1,51,1,255,1,162,6,0,1,35,1,255,1,174,1,211,1,245,1,8,
+    6,0,1,187,1,255,1,34,1,0,1,228,1,235,1,2,5,0,1,110,1,255,1,103,
+    1,139,1,255,1,72,5,0,1,14,1,250,1,208,1,0,1,0,1,150,1,255,1,58,
+    5,0,1,185,1,255,1,29,1,68,1,255,1,147,5,0,1,87,1,255,1,128,1,0,
+    1,0,1,71,1,255,1,134,4,0,1,11,1,248,1,208,1,0,1,6,1,243,1,221,
+    5,0,1,165,1,255,1,47,1,0,1,0,1,6,1,241,1,210,4,0,1,79,1,255,
+    1,131,2,0,1,174,1,255,1,40,3,0,1,4,1,238,1,222,2,0,2,0,1,170,
+    1,255,1,30,3,0,1,154,1,255,1,53,2,0,1,98,1,255,1,114,3,0,1,65,
+    1,255,1,141,2,0,2,0,1,91,1,255,1,106,3,0,1,227,1,231,1,1,2,0,
+    1,23,1,254,1,189,3,0,1,143,1,255,1,61,2,0,2,0,1,16,1,251,1,182,
+    2,0,1,47,1,255,1,155,4,0,1,202,1,250,1,13,2,0,1,220,1,233,1,2,
+    2,0,3,0,1,189,1,247,1,10,1,0,1,122,1,255,1,77,4,0,1,126,1,255,
+    1,82,1,0,1,43,1,255,1,155,3,0,3,0,1,111,1,255,1,78,1,0,1,197,
+    1,246,1,9,4,0,1,50,1,255,1,156,1,0,1,120,1,255,1,74,3,0,3,0,
+    1,32,1,255,1,156,1,22,1,253,1,178,6,0,1,229,1,231,1,1,1,201,1,242,
+    1,7,3,0,4,0,1,209,1,232,1,98,1,255,1,101,6,0,1,154,1,255,1,76,
+    1,254,1,169,4,0,4,0,1,130,1,255,1,219,1,254,1,25,6,0,1,78,1,255,
+    1,219,1,255,1,88,4,0,4,0,1,51,2,255,1,202,7,0,1,10,1,247,1,255,
+    1,249,1,14,4,0,1,0,1,83,1,255,1,209,1,5,6,0,1,1,1,196,1,255,
+    1,88,1,0,2,0,1,167,1,255,1,125,6,0,1,105,1,255,1,178,2,0,2,0,
+    1,19,1,232,1,249,1,43,4,0,1,27,2,241,1,27,2,0,3,0,1,81,1,255,
+    1,200,1,2,3,0,1,176,1,255,1,102,3,0,4,0,1,166,1,255,1,114,2,0,
+    1,83,1,255,1,191,1,1,3,0,4,0,1,18,1,231,1,245,1,34,1,15,1,230,
+    1,246,1,35,4,0,5,0,1,79,1,255,1,187,1,152,1,255,1,116,5,0,6,0,
+    1,167,2,255,1,205,1,3,5,0,5,0,1,6,1,206,1,254,1,247,1,232,1,19,
+    5,0,5,0,1,138,1,255,1,149,1,114,1,255,1,169,5,0,4,0,1,64,1,253,
+    1,217,1,10,1,2,1,194,1,255,1,86,4,0,3,0,1,16,1,226,1,252,1,55,
+    2,0,1,35,1,244,1,236,1,23,3,0,3,0,1,167,1,255,1,130,4,0,1,108,
+    1,255,1,176,3,0,2,0,1,92,1,255,1,204,1,5,4,0,1,1,1,189,1,255,
+    1,94,2,0,1,0,1,32,1,241,1,247,1,41,6,0,1,31,1,242,1,239,1,27,
+    1,0,1,2,1,195,1,255,1,112,8,0,1,102,1,255,1,184,1,0,1,3,1,205,
+    1,255,1,74,7,0,1,3,1,207,1,255,1,77,1,0,1,51,1,252,1,222,1,9,
+    6,0,1,111,1,255,1,169,1,0,2,0,1,144,1,255,1,132,5,0,1,25,1,241,
+    1,238,1,23,1,0,2,0,1,12,1,227,1,249,1,40,4,0,1,168,1,255,1,97,
+    2,0,3,0,1,79,1,255,1,190,3,0,1,69,1,255,1,188,3,0,4,0,1,175,
+    1,255,1,93,1,0,1,8,1,218,1,246,1,35,3,0,4,0,1,28,1,242,1,235,
+    1,20,1,134,1,255,1,117,4,0,5,0,1,111,1,255,1,189,1,250,1,205,1,3,
+    4,0,5,0,1,2,1,203,1,255,1,251,1,49,5,0,6,0,1,71,1,255,1,163,
+    6,0,6,0,1,56,1,255,1,148,6,0,6,0,1,56,1,255,1,148,6,0,6,0,
+    1,56,1,255,1,148,6,0,6,0,1,56,1,255,1,148,6,0,6,0,1,56,1,255,
+    1,148,6,0,6,0,1,56,1,255,1,148,6,0,1,36,11,255,1,212,1,0,1,36,
+    11,255,1,212,1,0,9,0,1,6,1,194,1,255,1,104,1,0,9,0,1,160,1,255,
+    1,144,2,0,8,0,1,120,1,255,1,182,1,3,2,0,7,0,1,81,1,254,1,212,
+    1,14,3,0,6,0,1,49,1,245,1,234,1,33,4,0,5,0,1,26,1,228,1,248,
+    1,59,5,0,4,0,1,9,1,203,1,255,1,93,6,0,3,0,1,1,1,171,1,255,
+    1,133,7,0,3,0,1,133,1,255,1,172,1,1,7,0,2,0,1,92,1,255,1,204,
+    1,10,8,0,1,0,1,59,1,248,1,229,1,26,9,0,1,32,1,234,1,245,1,51,
+    10,0,1,112,12,255,1,12,1,112,12,255,1,12,1,172,3,255,1,108,1,172,1,255,
+    1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,
+    1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,
+    1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,
+    1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,
+    1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,
+    1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,1,32,2,0,1,172,1,255,
+    1,119,1,100,1,42,1,172,3,255,1,108,1,67,1,242,1,33,13,0,1,0,1,151,
+    1,191,1,1,12,0,1,0,1,12,1,223,1,108,12,0,2,0,1,65,1,243,1,34,
+    11,0,3,0,1,148,1,193,1,1,10,0,3,0,1,11,1,221,1,110,10,0,4,0,
+    1,62,1,243,1,36,9,0,5,0,1,145,1,194,1,2,8,0,5,0,1,10,1,219,
+    1,112,8,0,6,0,1,60,1,243,1,37,7,0,7,0,1,142,1,197,1,2,6,0,
+    7,0,1,9,1,217,1,115,6,0,8,0,1,57,1,244,1,39,5,0,9,0,1,139,
+    1,198,1,2,4,0,9,0,1,8,1,215,1,117,4,0,10,0,1,55,1,244,1,40,
+    3,0,11,0,1,137,1,200,1,3,2,0,11,0,1,7,1,213,1,119,2,0,12,0,
+    1,53,1,244,1,42,1,0,13,0,1,134,1,202,1,3,13,0,1,6,1,211,1,122,
+    1,196,3,255,1,84,2,0,1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,
+    1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,
+    1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,
+    1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,
+    1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,
+    1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,1,124,1,255,1,84,2,0,
+    1,124,1,255,1,84,1,76,1,100,1,175,1,255,1,84,1,196,3,255,1,84,3,0,
+    1,22,1,239,1,255,1,189,4,0,3,0,1,163,1,253,1,179,1,255,1,90,3,0,
+    2,0,1,64,1,255,1,148,1,10,1,223,1,231,1,15,2,0,1,0,1,5,1,214,
+    1,230,1,14,1,0,1,73,1,255,1,147,2,0,1,0,1,121,1,255,1,85,3,0,
+    1,167,1,253,1,50,1,0,1,31,1,245,1,182,4,0,1,23,1,238,1,202,1,2,
+    1,178,1,246,1,33,5,0,1,101,1,255,1,105,12,255,12,255,1,25,1,140,1,6,
+    2,0,1,82,1,247,1,199,1,27,1,0,1,0,1,36,1,190,1,232,1,36,3,0,
+    1,87,1,5,1,0,1,100,1,201,1,239,1,252,1,249,1,230,1,184,1,75,1,0,
+    1,54,1,255,1,193,1,57,1,14,1,4,1,33,1,168,1,253,1,54,1,110,1,255,
+    1,51,4,0,1,37,1,255,1,135,7,0,1,6,1,255,1,160,1,5,1,125,1,209,
+    1,244,1,252,1,236,1,183,1,54,1,255,1,164,1,134,1,255,1,108,1,22,1,3,
+    1,8,1,43,1,154,1,255,1,164,2,218,5,0,1,17,1,254,1,164,1,239,1,199,
+    6,0,1,243,1,164,1,215,1,223,5,0,1,39,1,255,1,164,1,109,1,255,1,115,
+    1,21,1,3,1,21,1,78,1,213,1,251,1,164,1,0,1,97,1,201,1,244,1,251,
+    1,235,1,185,1,71,1,243,1,164,1,144,1,255,1,20,8,0,1,144,1,255,1,20,
+    8,0,1,144,1,255,1,20,8,0,1,144,1,255,1,20,8,0,1,144,1,255,1,20,
+    8,0,1,144,1,255,1,58,1,169,1,230,1,249,1,243,1,201,1,90,2,0,1,144,
+    1,255,1,218,1,88,1,18,1,4,1,31,1,151,1,255,1,89,1,0,1,144,1,255,
+    1,121,4,0,1,3,1,233,1,198,1,0,1,144,1,255,1,60,5,0,1,183,1,249,
+    1,2,1,144,1,255,1,37,5,0,1,161,1,255,1,23,1,144,1,255,1,34,5,0,
+    1,154,1,255,1,32,1,144,1,255,1,41,5,0,1,160,1,255,1,25,1,144,1,255,
+    1,64,5,0,1,181,1,251,1,5,1,144,1,255,1,117,4,0,1,3,1,232,1,201,
+    1,0,1,144,1,255,1,215,1,79,1,16,1,3,1,29,1,148,1,255,1,86,1,0,
+    1,144,1,255,1,55,1,173,1,234,1,252,1,240,1,194,1,83,2,0,1,0,1,51,
+    1,172,1,229,2,250,1,233,1,193,1,93,1,0,1,39,1,247,1,179,1,39,1,5,
+    1,6,1,32,1,153,1,255,1,72,1,141,1,255,1,32,4,0,1,25,1,255,1,140,
+    1,193,1,242,8,0,1,219,1,222,8,0,1,225,1,217,8,0,1,217,1,222,8,0,
+    1,194,1,242,6,0,1,225,1,200,1,145,1,255,1,35,4,0,1,4,1,247,1,170,
+    1,48,1,252,1,188,1,52,1,10,1,2,1,23,1,127,1,249,1,59,1,0,1,61,
+    1,175,1,228,1,249,1,251,1,229,1,171,1,53,1,0,8,0,1,212,1,208,8,0,
+    1,212,1,208,8,0,1,212,1,208,8,0,1,212,1,208,8,0,1,212,1,208,1,0,
+    1,54,1,181,1,236,1,251,1,238,1,192,1,75,1,212,1,208,1,35,1,246,1,198,
+    1,51,1,6,1,11,1,63,1,205,1,241,1,208,1,135,1,255,1,47,4,0,1,54,
+    1,255,1,208,1,187,1,246,1,1,4,0,1,1,1,245,1,208,1,211,1,226,6,0,
+    1,222,1,208,1,217,1,221,6,0,1,219,1,208,1,208,1,229,6,0,1,227,1,208,
+    1,182,1,250,1,3,4,0,1,3,1,249,1,208,1,129,1,255,1,54,4,0,1,54,
+    1,255,1,208,1,32,1,245,1,203,1,53,1,6,1,9,1,58,1,201,1,235,1,208,
+    1,0,1,52,1,177,1,234,1,252,1,240,1,192,1,73,1,205,1,208,1,0,1,60,
+    1,177,1,230,1,250,1,249,1,233,1,194,1,105,1,0,1,47,1,251,1,156,1,36,
+    1,5,1,4,1,27,1,121,1,255,1,100,1,146,1,252,1,11,5,0,1,227,1,188,
+    1,196,1,229,6,0,1,201,1,221,1,219,8,255,1,231,1,225,1,218,8,0,1,217,
+    1,227,8,0,1,194,1,248,1,1,7,0,1,145,1,255,1,44,5,0,1,206,1,229,
+    1,48,1,252,1,193,1,52,1,8,1,2,1,16,1,81,1,250,1,169,1,0,1,61,
+    1,175,1,227,1,249,1,253,1,242,1,211,1,142,1,16,5,0,1,4,1,7,2,0,
+    1,21,1,159,1,228,1,254,1,116,2,0,1,179,1,236,1,53,1,14,1,28,1,0,
+    1,6,1,252,1,152,3,0,1,0,1,30,1,255,1,132,3,0,1,0,1,32,1,255,
+    1,132,3,0,1,212,5,255,1,116,1,0,1,32,1,255,1,132,3,0,1,0,1,32,
+    1,255,1,132,3,0,1,0,1,32,1,255,1,132,3,0,1,0,1,32,1,255,1,132,
+    3,0,1,0,1,32,1,255,1,132,3,0,1,0,1,32,1,255,1,132,3,0,1,0,
+    1,32,1,255,1,132,3,0,1,0,1,32,1,255,1,132,3,0,1,0,1,32,1,255,
+    1,132,3,0,1,0,1,32,1,255,1,132,3,0,1,0,1,52,1,177,1,234,1,251,
+    1,238,1,188,1,66,1,204,1,208,1,34,1,245,1,190,1,48,1,6,1,9,1,55,
+    1,195,1,232,1,208,1,133,1,255,1,39,4,0,1,50,1,255,1,208,1,187,1,243,
+    5,0,1,1,1,249,1,208,1,213,1,223,6,0,1,230,1,208,1,221,1,217,6,0,
+    1,226,1,208,1,214,1,223,6,0,1,235,1,208,1,190,1,244,5,0,1,7,1,254,
+    1,208,1,137,1,255,1,41,4,0,1,66,1,255,1,208,1,38,1,248,1,191,1,47,
+    1,6,1,9,1,62,1,209,1,243,1,208,1,0,1,58,1,183,1,238,1,252,1,240,
+    1,194,1,79,1,212,1,208,8,0,1,212,1,206,1,106,1,255,1,40,5,0,1,225,
+    1,192,1,76,1,255,1,72,4,0,1,18,1,253,1,147,1,11,1,235,1,193,1,43,
+    1,6,1,5,1,43,1,176,1,248,1,45,1,0,1,47,1,175,1,231,1,251,1,249,
+    1,227,1,172,1,56,1,0,1,144,1,255,1,20,7,0,1,144,1,255,1,20,7,0,
+    1,144,1,255,1,20,7,0,1,144,1,255,1,20,7,0,1,144,1,255,1,20,7,0,
+    1,144,1,255,1,63,1,176,1,234,1,251,1,238,1,188,1,71,1,0,1,144,1,255,
+    1,216,1,85,1,20,1,5,1,40,1,181,1,253,1,68,1,144,1,255,1,101,4,0,
+    1,17,1,250,1,174,1,144,1,255,1,42,5,0,1,219,1,205,1,144,1,255,1,23,
+    5,0,1,212,1,208,1,144,1,255,1,20,5,0,1,212,1,208,1,144,1,255,1,20,
+    5,0,1,212,1,208,1,144,1,255,1,20,5,0,1,212,1,208,1,144,1,255,1,20,
+    5,0,1,212,1,208,1,144,1,255,1,20,5,0,1,212,1,208,1,144,1,255,1,20,
+    5,0,1,212,1,208,1,144,1,255,1,20,1,144,1,255,1,20,3,0,3,0,3,0,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,2,0,1,168,1,252,
+    2,0,1,168,1,252,4,0,4,0,4,0,2,0,1,168,1,252,2,0,1,168,1,252,
+    2,0,1,168,1,252,2,0,1,168,1,252,2,0,1,168,1,252,2,0,1,168,1,252,
+    2,0,1,168,1,252,2,0,1,168,1,252,2,0,1,168,1,252,2,0,1,168,1,252,
+    2,0,1,168,1,252,2,0,1,168,1,252,2,0,1,172,1,250,1,0,1,1,1,214,
+    1,230,1,19,1,117,1,255,1,173,1,13,1,220,1,204,1,36,1,144,1,255,1,20,
+    7,0,1,144,1,255,1,20,7,0,1,144,1,255,1,20,7,0,1,144,1,255,1,20,
+    7,0,1,144,1,255,1,20,7,0,1,144,1,255,1,20,2,0,1,4,1,174,1,250,
+    1,88,1,0,1,144,1,255,1,20,1,0,1,4,1,172,1,247,1,75,2,0,1,144,
+    1,255,1,20,1,4,1,171,1,242,1,63,3,0,1,144,1,255,1,23,1,169,1,236,
+    1,52,4,0,1,144,3,255,1,77,5,0,1,144,1,255,1,30,1,208,1,218,1,19,
+    4,0,1,144,1,255,1,20,1,33,1,237,1,197,1,8,3,0,1,144,1,255,1,20,
+    1,0,1,71,1,253,1,169,1,1,2,0,1,144,1,255,1,20,2,0,1,121,1,255,
+    1,138,2,0,1,144,1,255,1,20,3,0,1,172,1,255,1,105,1,0,1,144,1,255,
+    1,20,3,0,1,12,1,213,1,252,1,75,1,144,1,255,1,20,1,144,1,255,1,20,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,20,
+    1,144,1,255,1,20,1,144,1,255,1,20,1,144,1,255,1,31,1,140,1,222,1,249,
+    1,239,1,190,1,63,1,2,1,107,1,204,1,242,1,241,1,205,1,96,1,1,1,0,
+    1,144,1,255,1,201,1,140,1,38,1,9,1,49,1,203,1,246,1,169,1,157,1,40,
+    1,6,1,18,1,91,1,253,1,105,1,0,1,144,1,255,1,157,4,0,1,61,1,255,
+    1,223,1,2,4,0,1,185,1,220,1,0,1,144,1,255,1,60,4,0,1,22,1,255,
+    1,167,5,0,1,153,1,252,1,6,1,144,1,255,1,29,4,0,1,16,1,255,1,150,
+    5,0,1,148,1,255,1,16,1,144,1,255,1,20,4,0,1,16,1,255,1,148,5,0,
+    1,148,1,255,1,16,1,144,1,255,1,20,4,0,1,16,1,255,1,148,5,0,1,148,
+    1,255,1,16,1,144,1,255,1,20,4,0,1,16,1,255,1,148,5,0,1,148,1,255,
+    1,16,1,144,1,255,1,20,4,0,1,16,1,255,1,148,5,0,1,148,1,255,1,16,
+    1,144,1,255,1,20,4,0,1,16,1,255,1,148,5,0,1,148,1,255,1,16,1,144,
+    1,255,1,20,4,0,1,16,1,255,1,148,5,0,1,148,1,255,1,16,1,144,1,255,
+    1,37,1,163,1,228,1,249,1,246,1,214,1,127,1,3,1,144,1,254,1,220,1,134,
+    1,38,1,6,1,20,1,128,1,255,1,113,1,144,1,255,1,139,4,0,1,1,1,233,
+    1,190,1,144,1,255,1,52,5,0,1,204,1,214,1,144,1,255,1,22,5,0,1,200,
+    1,220,1,144,1,255,1,20,5,0,1,200,1,220,1,144,1,255,1,20,5,0,1,200,
+    1,220,1,144,1,255,1,20,5,0,1,200,1,220,1,144,1,255,1,20,5,0,1,200,
+    1,220,1,144,1,255,1,20,5,0,1,200,1,220,1,144,1,255,1,20,5,0,1,200,
+    1,220,1,0,1,73,1,181,1,230,1,249,1,250,1,234,1,191,1,94,2,0,1,58,
+    1,255,1,167,1,41,1,7,1,5,1,32,1,140,1,255,1,93,1,0,1,150,1,255,
+    1,22,4,0,1,2,1,238,1,188,1,0,1,194,1,237,6,0,1,199,1,233,1,0,
+    1,215,1,221,6,0,1,183,1,253,1,0,1,222,1,217,6,0,1,178,1,255,1,5,
+    1,215,1,221,6,0,1,182,1,253,1,0,1,194,1,237,6,0,1,199,1,233,1,0,
+    1,150,1,255,1,22,4,0,1,2,1,237,1,188,1,0,1,58,1,255,1,164,1,39,
+    1,6,1,4,1,31,1,137,1,255,1,94,1,0,1,0,1,74,1,182,1,231,1,250,
+    1,251,1,235,1,192,1,95,2,0,1,144,1,255,1,48,1,165,1,229,1,250,1,242,
+    1,196,1,82,2,0,1,144,1,255,1,210,1,78,1,15,1,5,1,34,1,156,1,255,
+    1,77,1,0,1,144,1,255,1,114,4,0,1,5,1,238,1,186,1,0,1,144,1,255,
+    1,59,5,0,1,191,1,240,1,0,1,144,1,255,1,36,5,0,1,169,1,255,1,11,
+    1,144,1,255,1,29,5,0,1,162,1,255,1,21,1,144,1,255,1,35,5,0,1,167,
+    1,255,1,14,1,144,1,255,1,60,5,0,1,188,1,244,1,1,1,144,1,255,1,120,
+    4,0,1,5,1,237,1,192,1,0,1,144,1,255,1,224,1,86,1,17,1,4,1,32,
+    1,156,1,255,1,83,1,0,1,144,1,255,1,57,1,166,1,229,1,250,1,244,1,200,
+    1,88,2,0,1,144,1,255,1,20,8,0,1,144,1,255,1,20,8,0,1,144,1,255,
+    1,20,8,0,1,144,1,255,1,20,8,0,1,144,1,255,1,20,8,0,1,0,1,50,
+    1,176,1,234,1,251,1,237,1,187,1,69,1,205,1,208,1,32,1,244,1,195,1,48,
+    1,6,1,11,1,61,1,203,1,238,1,208,1,133,1,255,1,45,4,0,1,58,1,255,
+    1,208,1,188,1,246,1,1,4,0,1,5,1,253,1,208,1,213,1,224,6,0,1,234,
+    1,208,1,221,1,217,6,0,1,226,1,208,1,213,1,222,6,0,1,231,1,208,1,187,
+    1,242,5,0,1,3,1,250,1,208,1,133,1,255,1,38,4,0,1,60,1,255,1,208,
+    1,33,1,246,1,189,1,46,1,6,1,9,1,62,1,207,1,242,1,208,1,0,1,54,
+    1,181,1,237,1,252,1,238,1,189,1,70,1,212,1,208,8,0,1,212,1,208,8,0,
+    1,212,1,208,8,0,1,212,1,208,8,0,1,212,1,208,8,0,1,212,1,208,1,100,
+    1,255,1,102,1,186,1,239,1,248,1,217,1,105,1,0,1,100,1,255,1,242,1,94,
+    1,18,1,15,1,138,1,255,1,55,1,100,1,255,1,130,3,0,1,43,1,255,1,102,
+    1,100,1,255,1,76,6,0,1,100,1,255,1,64,6,0,1,100,1,255,1,64,6,0,
+    1,100,1,255,1,64,6,0,1,100,1,255,1,64,6,0,1,100,1,255,1,64,6,0,
+    1,100,1,255,1,64,6,0,1,100,1,255,1,64,6,0,1,0,1,23,1,155,1,217,
+    1,244,1,253,1,246,1,215,1,144,1,21,1,0,1,0,1,175,1,245,1,61,1,10,
+    1,1,1,8,1,42,1,215,1,207,1,0,1,0,1,237,1,201,5,0,1,141,1,255,
+    1,26,1,0,1,239,1,230,1,5,7,0,1,0,1,186,1,255,1,202,1,133,1,118,
+    1,106,1,87,1,38,2,0,1,0,1,38,1,197,1,254,5,255,1,148,1,0,3,0,
+    1,13,1,46,1,65,1,73,1,93,1,219,1,255,1,56,1,17,1,255,1,167,5,0,
+    1,90,1,255,1,104,1,4,1,250,1,195,5,0,1,87,1,255,1,97,1,0,1,173,
+    1,253,1,90,1,15,1,1,1,10,1,46,1,200,1,248,1,29,1,0,1,14,1,137,
+    1,209,1,242,1,253,1,249,1,229,1,178,1,60,1,0,2,0,1,144,1,255,1,20,
+    4,0,2,0,1,144,1,255,1,20,4,0,2,0,1,144,1,255,1,20,4,0,1,32,
+    7,255,1,100,2,0,1,144,1,255,1,20,4,0,2,0,1,144,1,255,1,20,4,0,
+    2,0,1,144,1,255,1,20,4,0,2,0,1,144,1,255,1,20,4,0,2,0,1,144,
+    1,255,1,20,4,0,2,0,1,144,1,255,1,20,4,0,2,0,1,144,1,255,1,20,
+    2,0,1,187,1,207,2,0,1,135,1,255,1,35,2,0,1,202,1,182,2,0,1,78,
+    1,255,1,147,1,12,1,65,1,251,1,109,3,0,1,114,1,219,1,247,1,225,1,133,
+    1,4,1,144,1,255,1,20,4,0,1,16,1,255,1,148,1,144,1,255,1,20,4,0,
+    1,16,1,255,1,148,1,144,1,255,1,20,4,0,1,16,1,255,1,148,1,144,1,255,
+    1,20,4,0,1,16,1,255,1,148,1,144,1,255,1,20,4,0,1,16,1,255,1,148,
+    1,144,1,255,1,20,4,0,1,16,1,255,1,148,1,144,1,255,1,20,4,0,1,19,
+    1,255,1,148,1,135,1,255,1,22,4,0,1,38,1,255,1,148,1,97,1,255,1,48,
+    4,0,1,101,1,255,1,148,1,14,1,228,1,175,1,34,1,5,1,17,1,85,1,214,
+    1,250,1,148,1,0,1,36,1,168,1,226,1,250,1,232,1,171,1,47,1,255,1,148,
+    1,2,1,230,1,197,5,0,1,65,1,255,1,143,1,0,1,146,1,254,1,28,4,0,
+    1,145,1,255,1,56,1,0,1,60,1,255,1,111,4,0,1,225,1,224,1,1,1,0,
+    1,1,1,227,1,196,3,0,1,51,1,255,1,138,1,0,2,0,1,143,1,254,1,27,
+    2,0,1,131,1,255,1,50,1,0,2,0,1,56,1,255,1,110,2,0,1,212,1,219,
+    2,0,3,0,1,224,1,194,1,0,1,37,1,255,1,132,2,0,3,0,1,139,1,253,
+    1,24,1,118,1,255,1,45,2,0,3,0,1,53,1,255,1,103,1,196,1,214,3,0,
+    4,0,1,221,1,204,1,253,1,126,3,0,4,0,1,135,2,255,1,39,3,0,1,201,
+    1,238,1,2,3,0,1,69,2,255,1,95,4,0,1,222,1,223,1,0,1,130,1,255,
+    1,51,3,0,1,133,1,237,1,223,1,159,3,0,1,31,1,255,1,149,1,0,1,59,
+    1,255,1,117,3,0,1,197,1,179,1,161,1,222,3,0,1,98,1,255,1,76,1,0,
+    1,3,1,240,1,183,2,0,1,10,1,250,1,117,1,102,1,255,1,30,2,0,1,164,
+    1,248,1,11,1,0,1,0,1,173,1,244,1,5,1,0,1,70,1,255,1,53,1,40,
+    1,255,1,93,2,0,1,230,1,186,2,0,1,0,1,102,1,255,1,60,1,0,1,134,
+    1,242,1,3,1,0,1,233,1,157,1,0,1,41,1,255,1,113,2,0,1,0,1,31,
+    1,255,1,125,1,0,1,198,1,182,2,0,1,171,1,220,1,0,1,106,1,255,1,40,
+    2,0,2,0,1,216,1,191,1,10,1,250,1,119,2,0,1,108,1,255,1,27,1,171,
+    1,223,3,0,2,0,1,145,1,247,1,75,1,255,1,56,2,0,1,45,1,255,1,91,
+    1,234,1,150,3,0,2,0,1,74,1,255,1,193,1,244,1,5,2,0,1,1,1,236,
+    1,197,1,255,1,77,3,0,2,0,1,10,1,248,1,255,1,187,4,0,1,175,1,255,
+    1,249,1,11,3,0,1,0,1,80,1,255,1,160,3,0,1,11,1,225,1,232,1,21,
+    2,0,1,158,1,255,1,67,2,0,1,142,1,255,1,74,1,0,2,0,1,13,1,223,
+    1,220,1,9,1,51,1,252,1,149,2,0,3,0,1,61,1,253,1,139,1,205,1,215,
+    1,9,2,0,4,0,1,137,1,255,1,250,1,50,3,0,4,0,1,60,1,255,1,229,
+    1,14,3,0,3,0,1,11,1,218,1,227,1,251,1,161,3,0,3,0,1,155,1,253,
+    1,60,1,133,1,255,1,84,2,0,2,0,1,80,1,255,1,142,1,0,1,6,1,211,
+    1,237,1,26,1,0,1,0,1,25,1,235,1,217,1,9,2,0,1,51,1,251,1,185,
+    1,1,1,1,1,184,1,253,1,57,4,0,1,133,1,255,1,110,1,2,1,226,1,216,
+    5,0,1,122,1,255,1,68,1,0,1,135,1,255,1,50,4,0,1,188,1,246,1,8,
+    1,0,1,41,1,255,1,140,3,0,1,7,1,246,1,185,1,0,2,0,1,203,1,227,
+    1,1,2,0,1,64,1,255,1,115,1,0,2,0,1,109,1,255,1,63,2,0,1,129,
+    1,255,1,45,1,0,2,0,1,20,1,250,1,153,2,0,1,196,1,230,2,0,3,0,
+    1,176,1,237,1,5,1,12,1,250,1,161,2,0,3,0,1,82,1,255,1,77,1,72,
+    1,255,1,91,2,0,3,0,1,6,1,237,1,165,1,132,1,254,1,22,2,0,4,0,
+    1,150,1,244,2,207,3,0,4,0,1,55,2,255,1,137,3,0,5,0,1,135,1,255,
+    1,67,3,0,5,0,1,203,1,242,1,6,3,0,4,0,1,34,1,254,1,157,4,0,
+    2,0,1,17,1,20,1,186,1,248,1,38,4,0,2,0,1,96,1,248,1,203,1,63,
+    5,0,1,0,1,236,7,255,1,40,6,0,1,49,1,248,1,226,1,14,5,0,1,15,
+    1,221,1,250,1,57,1,0,5,0,1,175,1,255,1,111,2,0,4,0,1,116,1,255,
+    1,171,3,0,3,0,1,60,1,251,1,218,1,14,3,0,2,0,1,21,1,229,1,246,
+    1,46,4,0,1,0,1,2,1,187,1,255,1,97,5,0,1,0,1,130,1,255,1,157,
+    6,0,1,66,1,253,1,208,1,9,6,0,1,124,8,255,1,40,2,0,1,104,1,223,
+    1,255,1,48,1,0,1,47,1,255,1,234,1,123,1,18,1,0,1,126,1,255,1,71,
+    2,0,1,0,1,153,1,255,1,13,2,0,1,0,1,160,1,255,1,4,2,0,1,0,
+    1,160,1,255,1,4,2,0,1,0,1,160,1,255,1,4,2,0,1,0,1,161,1,255,
+    1,3,2,0,1,0,1,193,1,238,3,0,1,111,1,254,1,146,3,0,1,255,1,216,
+    1,12,3,0,1,109,1,254,1,145,3,0,1,0,1,192,1,238,3,0,1,0,1,161,
+    1,255,1,3,2,0,1,0,1,160,1,255,1,4,2,0,1,0,1,160,1,255,1,4,
+    2,0,1,0,1,160,1,255,1,4,2,0,1,0,1,151,1,255,1,13,2,0,1,0,
+    1,124,1,255,1,71,2,0,1,0,1,45,1,255,1,233,1,124,1,18,2,0,1,103,
+    1,224,1,255,1,48,1,255,1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,
+    1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,
+    1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,
+    1,164,1,255,1,164,1,255,1,164,1,255,1,164,1,255,1,234,1,149,1,7,2,0,
+    1,16,1,139,1,255,1,111,2,0,1,0,1,5,1,238,1,188,2,0,2,0,1,206,
+    1,214,2,0,2,0,1,200,1,220,2,0,2,0,1,200,1,220,2,0,2,0,1,200,
+    1,220,2,0,2,0,1,199,1,220,2,0,2,0,1,179,1,243,1,6,1,0,2,0,
+    1,87,1,255,1,150,1,8,3,0,1,168,1,255,1,48,2,0,1,84,1,255,1,157,
+    1,10,2,0,1,177,1,244,1,7,1,0,2,0,1,199,1,221,2,0,2,0,1,200,
+    1,220,2,0,2,0,1,200,1,220,2,0,2,0,1,200,1,220,2,0,2,0,1,209,
+    1,212,2,0,1,0,1,22,1,247,1,185,2,0,1,111,1,212,1,255,1,106,2,0,
+    1,255,1,234,1,146,1,5,2,0,10,0,1,52,1,3,1,0,1,90,1,218,1,246,
+    1,213,1,153,1,88,1,29,1,10,1,104,1,250,1,79,1,94,9,255,1,183,1,0,
+    1,174,1,158,1,28,1,10,1,56,1,126,1,192,2,240,1,156,1,12,1,0,1,1,
+    11,0,
+};
+
+constexpr BakedFont BAKED_FONT_24 =
+{
+    24, 25,
+    {
+        {0, 20, 0, 0, 6, 6, 0},
+        {1, 4, 3, 16, 6, 6, 0},
+        {1, 4, 6, 6, 7, 7, 88},
+        {1, 4, 13, 16, 15, 15, 160},
+        {0, 3, 15, 19, 15, 15, 386},
+        {0, 4, 19, 16, 19, 19, 786},
+        {1, 4, 16, 16, 17, 17, 1136},
+        {1, 4, 2, 6, 4, 4, 1462},
+        {1, 3, 5, 22, 7, 7, 1486},
+        {1, 3, 5, 22, 7, 7, 1666},
+        {3, 4, 9, 9, 15, 15, 1846},
+        {1, 6, 12, 12, 15, 15, 1976},
+        {1, 18, 3, 5, 5, 5, 2088},
+        {0, 13, 5, 2, 5, 5, 2116},
+        {1, 18, 3, 2, 5, 5, 2128},
+        {0, 4, 16, 21, 18, 16, 2140},
+        {1, 4, 13, 16, 15, 15, 2344},
+        {2, 4, 8, 16, 15, 15, 2596},
+        {1, 4, 12, 16, 15, 15, 2760},
+        {1, 4, 13, 16, 15, 15, 2960},
+        {0, 4, 14, 16, 15, 15, 3214},
+        {1, 4, 13, 16, 15, 15, 3440},
+        {1, 4, 13, 16, 15, 15, 3654},
+        {1, 4, 12, 16, 15, 15, 3922},
+        {1, 4, 13, 16, 15, 15, 4084},
+        {1, 4, 13, 16, 15, 15, 4376},
+        {1, 9, 3, 11, 5, 5, 4646},
+        {0, 9, 3, 14, 4, 4, 4684},
+        {0, 6, 11, 12, 11, 10, 4740},
+        {1, 9, 12, 6, 15, 15, 4888},
+        {0, 6, 11, 12, 11, 10, 4916},
+        {1, 4, 11, 16, 12, 12, 5064},
+        {0, 6, 15, 14, 15, 15, 5238},
+        {0, 4, 15, 16, 15, 15, 5580},
+        {1, 4, 13, 16, 15, 15, 5848},
+        {0, 4, 14, 16, 14, 14, 6070},
+        {1, 4, 14, 16, 16, 16, 6308},
+        {0, 4, 12, 16, 12, 12, 6526},
+        {1, 4, 11, 16, 12, 12, 6646},
+        {0, 4, 15, 16, 15, 15, 6766},
+        {1, 4, 14, 16, 16, 16, 7030},
+        {1, 4, 3, 16, 5, 5, 7238},
+        {0, 4, 11, 16, 12, 12, 7334},
+        {1, 4, 14, 16, 15, 14, 7510},
+        {1, 4, 11, 16, 12, 12, 7784},
+        {1, 4, 19, 16, 21, 21, 7908},
+        {1, 4, 15, 16, 17, 17, 8336},
+        {0, 4, 15, 16, 15, 15, 8670},
+        {1, 4, 13, 16, 14, 14, 8952},
+        {0, 4, 16, 16, 16, 16, 9138},
+        {1, 4, 13, 16, 15, 15, 9474},
+        {0, 4, 13, 16, 13, 13, 9692},
+        {0, 4, 13, 16, 13, 12, 9948},
+        {1, 4, 14, 16, 16, 16, 10100},
+        {0, 4, 15, 16, 15, 14, 10346},
+        {0, 4, 24, 16, 24, 24, 10614},
+        {0, 4, 16, 16, 16, 14, 11094},
+        {0, 4, 15, 16, 15, 14, 11396},
+        {0, 4, 14, 16, 14, 14, 11630},
+        {1, 4, 5, 21, 7, 7, 11798},
+        {0, 4, 16, 21, 18, 16, 11964},
+        {1, 4, 5, 21, 7, 7, 12168},
+        {0, 4, 11, 7, 11, 11, 12334},
+        {0, 21, 12, 2, 12, 12, 12446},
+        {3, 4, 5, 4, 12, 12, 12450},
+        {1, 9, 10, 11, 12, 12, 12484},
+        {1, 4, 11, 16, 12, 12, 12658},
+        {1, 9, 10, 11, 12, 12, 12884},
+        {1, 4, 10, 16, 12, 12, 13024},
+        {1, 9, 10, 11, 12, 12, 13220},
+        {0, 3, 7, 17, 7, 6, 13360},
+        {1, 9, 10, 16, 12, 12, 13526},
+        {1, 4, 10, 16, 12, 12, 13760},
+        {1, 4, 3, 16, 5, 5, 13950},
+        {0, 4, 4, 21, 5, 4, 14034},
+        {1, 4, 10, 16, 11, 10, 14154},
+        {1, 4, 3, 16, 5, 5, 14364},
+        {1, 9, 18, 11, 20, 20, 14460},
+        {1, 9, 10, 11, 12, 12, 14732},
+        {1, 9, 11, 11, 12, 12, 14882},
+        {1, 9, 11, 16, 12, 12, 15058},
+        {1, 9, 10, 16, 12, 12, 15284},
+        {1, 9, 9, 11, 10, 10, 15478},
+        {0, 9, 11, 11, 11, 11, 15592},
+        {0, 6, 9, 14, 9, 8, 15784},
+        {1, 9, 10, 11, 12, 12, 15938},
+        {0, 9, 11, 11, 11, 10, 16104},
+        {0, 9, 17, 11, 17, 16, 16270},
+        {0, 9, 11, 11, 11, 10, 16566},
+        {0, 9, 11, 16, 11, 9, 16746},
+        {0, 9, 10, 11, 10, 10, 16970},
+        {2, 4, 6, 21, 9, 9, 17082},
+        {0, 4, 2, 20, 2, 2, 17286},
+        {2, 4, 6, 21, 9, 9, 17366},
+        {0, 2, 12, 5, 12, 12, 17554},
+    },
+    BAKED_RUNS_24
+};
+
+constexpr const BakedFont *BAKED_FONTS[] =
+{
+    &BAKED_FONT_48,
+    &BAKED_FONT_24,
+};
+
+const int BAKED_FONT_COUNT = 2;
+
+#endif
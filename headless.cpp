@@ -0,0 +1,395 @@
+#include "sim.h"
+#include "replay.h"
+#include "swarm.h"
+#include "tournament.h"
+#include "eventsim.h"
+#include "ai.h"
+#include "netplay.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <ctime>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+//Headless runner - plays bot vs bot matches with no window, as fast as possible
+//usage: headless [matches] [seed]
+//       headless -replay file
+//       headless -tournament matches [threads] [seed]
+//       headless -events [matches] [seed]
+//       headless -ai difficulty [matches] [seed]
+//       headless -netplay [delay ms] [loss %] [seed]
+
+//Print the share of count that each non-empty bucket holds
+void print_distribution(const char *name, long long *buckets, int bucketCount, int bucketWidth, long long count)
+{
+    std::cout << name << ":" << std::endl;
+    for (int i = 0; i < bucketCount; i++)
+    {
+        if (buckets[i] == 0)
+            continue;
+        std::cout << "  " << i * bucketWidth;
+        if (i == bucketCount - 1)
+            std::cout << "+";
+        std::cout << ": " << 100.0 * buckets[i] / count << "%" << std::endl;
+    }
+}
+
+//Play a big batch of matches on every core and print the aggregate stats
+int run_tournament(int argc, char *argv[])
+{
+    long long matches = atoll(argv[2]);
+    int threads = 0;
+    unsigned int seed = time(NULL);
+
+    if (argc > 3)
+        threads = atoi(argv[3]);
+    if (argc > 4)
+        seed = strtoul(argv[4], NULL, 10);
+
+    if (matches <= 0 || matches > 0xFFFFFFFFLL)
+    {
+        std::cerr << "usage: headless -tournament matches [threads] [seed]" << std::endl;
+        return 1;
+    }
+
+    Tournament tournament;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    tournament.run((unsigned int)matches, seed, threads);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1e6;
+
+    TournamentStats *stats = tournament.get_stats();
+    long long rallyHits = 0;
+    for (int i = 0; i < RALLY_BUCKETS; i++)
+        rallyHits += (long long)i * stats->rallies[i];
+
+    std::cout << "seed " << seed << ", " << stats->matches << " matches, " << tournament.get_threads() << " threads, ";
+    std::cout << tournament.get_steals() << " steals" << std::endl;
+    std::cout << "left wins " << 100.0 * stats->leftWins / stats->matches << "%, right wins ";
+    std::cout << 100.0 * stats->rightWins / stats->matches << "%, unfinished " << stats->unfinished << std::endl;
+    if (stats->points > 0)
+    {
+        std::cout << stats->points << " points, mean rally " << double(rallyHits) / stats->points << " hits" << std::endl;
+        print_distribution("rally length (paddle hits)", stats->rallies, RALLY_BUCKETS, 1, stats->points);
+        print_distribution("ball speed at the point (px/s)", stats->speeds, SPEED_BUCKETS, SPEED_BUCKET_WIDTH, stats->points);
+    }
+    std::cout << seconds << " s, ";
+    if (seconds > 0)
+        std::cout << stats->matches / seconds << " matches/s, " << stats->steps / seconds << " frames/s";
+    std::cout << std::endl;
+
+    return 0;
+}
+
+//Play a recorded match back at full speed
+int play_replay(const char *filename)
+{
+    ReplayReader replay;
+    if (!replay.open(filename))
+    {
+        std::cerr << "could not open replay " << filename << std::endl;
+        return 1;
+    }
+
+    MatchState match;
+    static BallSwarm swarm;
+    match_init(&match, replay.get_seed());
+    match_add_swarm(&match, &swarm, replay.get_balls());
+
+    int leftInput, rightInput;
+    long long steps = 0;
+
+    clock_t start = clock();
+    while (replay.next(&leftInput, &rightInput))
+    {
+        match_step(&match, leftInput, rightInput);
+        steps++;
+    }
+    double seconds = double(clock() - start) / CLOCKS_PER_SEC;
+
+    std::cout << "seed " << replay.get_seed() << ", " << steps << " steps";
+    if (replay.get_steps() != steps)
+        std::cout << " (header says " << replay.get_steps() << ")";
+    std::cout << std::endl;
+    std::cout << "score " << match.leftScore << " - " << match.rightScore << std::endl;
+    std::cout << seconds << " s" << std::endl;
+
+    return 0;
+}
+
+//Play matches on the event driven engine, bot paddles going straight to the intercept
+int run_events(int argc, char *argv[])
+{
+    int matches = 100000;
+    unsigned int seed = time(NULL);
+
+    if (argc > 2)
+        matches = atoi(argv[2]);
+    if (argc > 3)
+        seed = strtoul(argv[3], NULL, 10);
+
+    if (matches <= 0)
+    {
+        std::cerr << "usage: headless -events [matches] [seed]" << std::endl;
+        return 1;
+    }
+
+    EventMatch match;
+    long long events = 0, hits = 0;
+    double gameTime = 0;
+    int leftWins = 0, rightWins = 0, unfinished = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < matches; i++)
+    {
+        match.init(seed + i);
+        match.play();
+
+        events += match.get_events();
+        hits += match.get_hits();
+        gameTime += match.get_time();
+        if (!match.is_over())
+            unfinished++;
+        else if (match.get_left_score() >= SCORE_LIMIT)
+            leftWins++;
+        else
+            rightWins++;
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e9;
+
+    std::cout << "seed " << seed << ", " << matches << " matches, " << events << " events" << std::endl;
+    std::cout << "left wins " << leftWins << ", right wins " << rightWins << ", unfinished " << unfinished << std::endl;
+    std::cout << "mean " << double(hits) / matches << " paddle hits, " << gameTime / matches << " s of game time per match" << std::endl;
+    std::cout << seconds << " s, " << seconds * 1e6 / matches << " us/match" << std::endl;
+
+    return 0;
+}
+
+//Play the CPU opponent (left) against the tracking bot (right)
+int run_ai(int argc, char *argv[])
+{
+    int difficulty = parse_difficulty(argv[2]);
+    int matches = 100;
+    unsigned int seed = time(NULL);
+
+    if (argc > 3)
+        matches = atoi(argv[3]);
+    if (argc > 4)
+        seed = strtoul(argv[4], NULL, 10);
+
+    if (difficulty < 0 || matches <= 0)
+    {
+        std::cerr << "usage: headless -ai easy|normal|hard [matches] [seed]" << std::endl;
+        return 1;
+    }
+
+    MatchState match;
+    PaddleAI ai;
+    long long frames = 0;
+    int aiWins = 0, botWins = 0, unfinished = 0;
+
+    clock_t start = clock();
+    for (int i = 0; i < matches; i++)
+    {
+        match_init(&match, seed + i);
+        ai.init(SIDE_LEFT, difficulty, seed + i);
+
+        int steps = 0;
+        while (!match.endGame && steps < MAX_MATCH_STEPS)
+        {
+            int leftInput = ai.think(&match);
+            int rightInput = track_ball(match.rightPaddle, match.theBall);
+            match_step(&match, leftInput, rightInput);
+            steps++;
+        }
+        frames += steps;
+
+        if (!match.endGame)
+            unfinished++;
+        else if (match.leftScore >= match.scoreLimit)
+            aiWins++;
+        else
+            botWins++;
+    }
+    double seconds = double(clock() - start) / CLOCKS_PER_SEC;
+
+    std::cout << "seed " << seed << ", " << matches << " matches, " << frames << " frames" << std::endl;
+    std::cout << "ai wins " << aiWins << ", bot wins " << botWins << ", unfinished " << unfinished << std::endl;
+    std::cout << seconds << " s, ";
+    if (seconds > 0)
+        std::cout << frames / seconds << " frames/s";
+    std::cout << std::endl;
+
+    return 0;
+}
+
+//Both ends of a networked match, one CPU player each, over UDP on localhost
+//through the latency and loss shim. The two ends are stepped in turn on a
+//made up clock, so it runs as fast as it can. Once a match is over both are
+//brought to the same step with every input known, and must agree with each
+//other and with the match played again from the inputs they confirmed.
+int run_netplay(int argc, char *argv[])
+{
+    int delayMs = 50;
+    int lossPercent = 5;
+    unsigned int seed = time(NULL);
+
+    if (argc > 2)
+        delayMs = atoi(argv[2]);
+    if (argc > 3)
+        lossPercent = atoi(argv[3]);
+    if (argc > 4)
+        seed = strtoul(argv[4], NULL, 10);
+
+    if (delayMs < 0 || lossPercent < 0 || lossPercent >= 100)
+    {
+        std::cerr << "usage: headless -netplay [delay ms] [loss %] [seed]" << std::endl;
+        return 1;
+    }
+
+    static RollbackSession sides[2];
+    static MatchState matches[2];
+    PaddleAI players[2];
+    std::vector<int> confirmed[2];
+
+    if (!sides[SIDE_LEFT].host(0, seed) || !sides[SIDE_RIGHT].join("127.0.0.1", sides[SIDE_LEFT].get_port()))
+    {
+        std::cerr << "could not open sockets on localhost" << std::endl;
+        return 1;
+    }
+    for (int side = 0; side < 2; side++)
+    {
+        //jitter of a fifth of the delay, so packets overtake each other too
+        sides[side].set_shim(delayMs, delayMs / 5, lossPercent, seed + side);
+        players[side].init(side, AI_NORMAL, seed);
+    }
+
+    const long long stepMicros = 1000000 / SIM_HZ;
+    const long long maxTicks = (long long)MAX_MATCH_STEPS * 2;
+    long long now = 0;
+    long long ticks = 0;
+    int lastStep = -1;
+    bool done = false;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (!done && ticks < maxTicks)
+    {
+        now += stepMicros;
+        ticks++;
+        done = lastStep >= 0;
+
+        for (int side = 0; side < 2; side++)
+        {
+            RollbackSession &session = sides[side];
+            MatchState &match = matches[side];
+
+            if (!session.connect(&match, now))
+            {
+                done = false;
+                continue;
+            }
+
+            //play on until one end sees the match over, then bring both to the step it got to
+            if (lastStep < 0)
+            {
+                session.advance(players[side].think(&match), now);
+                if (match.endGame)
+                    lastStep = std::max(sides[0].get_frame(), sides[1].get_frame());
+            }
+            if (lastStep >= 0)
+            {
+                if (session.get_frame() < lastStep)
+                    session.advance(players[side].think(&match), now);
+                if (!session.settle(now) || session.get_frame() < lastStep)
+                    done = false;
+            }
+
+            int leftInput, rightInput;
+            while (session.next_confirmed(&leftInput, &rightInput))
+                confirmed[side].push_back(leftInput | rightInput << 8);
+        }
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1e6;
+
+    if (!done)
+    {
+        std::cerr << "match never settled, status " << sides[0].get_status() << " / " << sides[1].get_status() << std::endl;
+        return 1;
+    }
+
+    //the same match again from scratch, on the inputs the host confirmed
+    MatchState replayed;
+    match_init(&replayed, seed);
+    for (size_t i = 0; i < confirmed[SIDE_LEFT].size(); i++)
+        match_step(&replayed, confirmed[SIDE_LEFT][i] & 0xFF, confirmed[SIDE_LEFT][i] >> 8);
+
+    unsigned long long replayedSum = match_checksum(&replayed);
+    bool agree = confirmed[SIDE_LEFT] == confirmed[SIDE_RIGHT];
+    for (int side = 0; side < 2; side++)
+        agree = agree && match_checksum(&matches[side]) == replayedSum;
+
+    std::cout << "seed " << seed << ", " << delayMs << " ms each way, " << lossPercent << "% lost, ";
+    std::cout << lastStep << " steps, score " << replayed.leftScore << " - " << replayed.rightScore << std::endl;
+    const char *names[2] = {"host", "join"};
+    for (int side = 0; side < 2; side++)
+    {
+        NetStats *stats = sides[side].get_stats();
+        std::cout << names[side] << ": " << stats->rollbacks << " rollbacks, " << stats->resimulated << " steps again, deepest ";
+        std::cout << stats->deepest << ", " << stats->waits << " waits, " << stats->packetsSent << " sent, ";
+        std::cout << stats->packetsReceived << " received" << std::endl;
+    }
+    std::cout << (agree ? "both ends and the replay agree" : "DESYNC") << std::endl;
+    std::cout << seconds << " s" << std::endl;
+
+    return agree ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 2 && std::string(argv[1]) == "-replay")
+        return play_replay(argv[2]);
+    if (argc > 2 && std::string(argv[1]) == "-tournament")
+        return run_tournament(argc, argv);
+    if (argc > 1 && std::string(argv[1]) == "-events")
+        return run_events(argc, argv);
+    if (argc > 2 && std::string(argv[1]) == "-ai")
+        return run_ai(argc, argv);
+    if (argc > 1 && std::string(argv[1]) == "-netplay")
+        return run_netplay(argc, argv);
+
+    int matches = 100;
+    unsigned int seed = time(NULL);
+
+    if (argc > 1)
+        matches = atoi(argv[1]);
+    if (argc > 2)
+        seed = strtoul(argv[2], NULL, 10);
+
+    if (matches <= 0)
+    {
+        std::cerr << "usage: headless [matches] [seed]" << std::endl;
+        return 1;
+    }
+
+    TournamentStats stats;
+    MatchState match;
+    stats_clear(&stats);
+
+    clock_t start = clock();
+    for (int i = 0; i < matches; i++)
+        play_match(&match, seed + i, &stats);
+    double seconds = double(clock() - start) / CLOCKS_PER_SEC;
+
+    std::cout << "seed " << seed << ", " << matches << " matches, " << stats.steps << " frames" << std::endl;
+    std::cout << "left wins " << stats.leftWins << ", right wins " << stats.rightWins << ", unfinished " << stats.unfinished << std::endl;
+    std::cout << seconds << " s, ";
+    if (seconds > 0)
+        std::cout << stats.steps / seconds << " frames/s";
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <cstdarg>
+#include <cstdio>
+#include "logger.h"
+
+const char *LOG_LEVEL_NAMES[] = {"DEBUG", "INFO", "WARNING", "ERROR"};
+
+AsyncLogger logger;
+
+AsyncLogger::AsyncLogger()
+{
+    for (int i = 0; i < LOG_QUEUE_SIZE; i++)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    head = 0;
+    dropped.store(0, std::memory_order_relaxed);
+    running.store(false, std::memory_order_relaxed);
+    epoch = std::chrono::steady_clock::now();
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+bool AsyncLogger::start(const char *filename)
+{
+    if (running.load())
+        return true;
+
+    file.open(filename);
+    if (!file)
+        return false;
+
+    running.store(true);
+    writer = std::thread(&AsyncLogger::run, this);
+    return true;
+}
+
+//Write out whatever is still queued and join the writer thread
+void AsyncLogger::stop()
+{
+    if (!running.load())
+        return;
+
+    running.store(false);
+    writer.join();
+    file.close();
+}
+
+//Reserve the next free slot, or NULL if the ring is full. Bounded
+//multi-producer queue: a slot is free for position pos when its
+//sequence equals pos, and ready to read when it equals pos + 1.
+AsyncLogger::Slot *AsyncLogger::claim_slot()
+{
+    unsigned int pos = tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Slot *slot = &slots[pos & (LOG_QUEUE_SIZE - 1)];
+        unsigned int sequence = slot->sequence.load(std::memory_order_acquire);
+        int diff = int(sequence - pos);
+
+        if (diff == 0)
+        {
+            if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                return slot;
+        }
+        else if (diff < 0)
+            return NULL;
+        else
+            pos = tail.load(std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogger::write(int level, const char *format, va_list args)
+{
+    Slot *slot = claim_slot();
+    if (slot == NULL)
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    slot->time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+    slot->level = level;
+    vsnprintf(slot->text, LOG_MESSAGE_LENGTH, format, args);
+
+    unsigned int pos = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+//Drain the ring to the file, returns whether anything was written
+bool AsyncLogger::write_pending()
+{
+    bool wrote = false;
+
+    for (;;)
+    {
+        Slot *slot = &slots[head & (LOG_QUEUE_SIZE - 1)];
+        if (slot->sequence.load(std::memory_order_acquire) != head + 1)
+            break;
+
+        char stamp[32];
+        snprintf(stamp, sizeof(stamp), "[%12.6f] ", slot->time / 1000000.0);
+        file << stamp << LOG_LEVEL_NAMES[slot->level] << ": " << slot->text << '\n';
+
+        slot->sequence.store(head + LOG_QUEUE_SIZE, std::memory_order_release);
+        head++;
+        wrote = true;
+    }
+
+    unsigned int lost = dropped.exchange(0, std::memory_order_relaxed);
+    if (lost > 0)
+    {
+        file << "(" << lost << " log messages dropped)" << '\n';
+        wrote = true;
+    }
+
+    if (wrote)
+        file.flush();
+    return wrote;
+}
+
+void AsyncLogger::run()
+{
+    while (running.load())
+    {
+        if (!write_pending())
+            std::this_thread::sleep_for(std::chrono::milliseconds(LOG_IDLE_MS));
+    }
+    write_pending();
+}
+
+bool logger_start(const char *filename)
+{
+    return logger.start(filename);
+}
+
+void logger_stop()
+{
+    logger.stop();
+}
+
+void log(const char *message, int level)
+{
+    log_printf(level, "%s", message);
+}
+
+void log_printf(int level, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    logger.write(level, format, args);
+    va_end(args);
+}
@@ -0,0 +1,65 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstdarg>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+enum LogLevels
+{
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARNING,
+    LOG_ERROR,
+};
+
+//queue size must be a power of two
+const int LOG_QUEUE_SIZE = 1024;
+const int LOG_MESSAGE_LENGTH = 120;
+
+//how long the writer thread sleeps when there is nothing to write
+const int LOG_IDLE_MS = 10;
+
+//Asynchronous logger - callers copy their message into a lock-free ring
+//buffer and return straight away, a background thread does the disk writes.
+//When the ring is full new messages are dropped and counted instead of waiting.
+class AsyncLogger
+{
+    private:
+        struct Slot
+        {
+            std::atomic<unsigned int> sequence;
+            long long time;
+            int level;
+            char text[LOG_MESSAGE_LENGTH];
+        };
+
+        Slot slots[LOG_QUEUE_SIZE];
+        std::atomic<unsigned int> tail;
+        unsigned int head;
+        std::atomic<unsigned int> dropped;
+        std::atomic<bool> running;
+        std::thread writer;
+        std::ofstream file;
+        std::chrono::steady_clock::time_point epoch;
+
+        Slot *claim_slot();
+        bool write_pending();
+        void run();
+    public:
+        AsyncLogger();
+        ~AsyncLogger();
+        bool start(const char *filename);
+        void stop();
+        void write(int level, const char *format, va_list args);
+};
+
+bool logger_start(const char *filename);
+void logger_stop();
+
+void log(const char *message, int level = LOG_INFO);
+void log_printf(int level, const char *format, ...);
+
+#endif
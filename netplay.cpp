@@ -0,0 +1,648 @@
+#include "netplay.h"
+#include "replay.h"
+#include <cstring>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef int socklen_t;
+const size_t NO_SOCKET = INVALID_SOCKET;
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+const int NO_SOCKET = -1;
+#endif
+
+//Packet layout, numbers little endian like replays:
+//  u32 NET_MAGIC, u8 type, then
+//  hello, welcome: u32 NET_PROTOCOL, u32 SIM_HZ, u32 PHYSICS_KIND, u32 seed (0 in a hello)
+//  inputs: u32 sender's frame, u32 inputs it has from the receiver, i32 its frame
+//          advantage, u32 first step, u8 count, then count inputs a byte each
+const unsigned int NET_MAGIC = 0x31474E50; //"PNG1"
+const int PACKET_HEADER_SIZE = 5;
+const int HELLO_SIZE = PACKET_HEADER_SIZE + 4 * 4;
+const int INPUTS_HEADER_SIZE = PACKET_HEADER_SIZE + 4 * 4 + 1;
+
+NetLink::NetLink()
+{
+    sock = NO_SOCKET;
+    peerKnown = false;
+    delayMicros = 0;
+    jitterMicros = 0;
+    lossPercent = 0;
+    delayedCount = 0;
+}
+
+NetLink::~NetLink()
+{
+    close();
+}
+
+//Listen on port, 0 for any free one
+bool NetLink::open(int port)
+{
+    close();
+
+#ifdef _WIN32
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+        return false;
+#endif
+
+    sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock == NO_SOCKET)
+    {
+#ifdef _WIN32
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons((unsigned short)port);
+
+    //the simulation thread polls, it never blocks on the socket
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    bool ready = ioctlsocket(sock, FIONBIO, &nonBlocking) == 0;
+#else
+    bool ready = fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK) != -1;
+#endif
+    if (!ready || bind(sock, (sockaddr *)&local, sizeof(local)) != 0)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void NetLink::close()
+{
+    if (sock != NO_SOCKET)
+    {
+#ifdef _WIN32
+        closesocket(sock);
+        WSACleanup();
+#else
+        ::close(sock);
+#endif
+    }
+    sock = NO_SOCKET;
+    peerKnown = false;
+    delayedCount = 0;
+}
+
+int NetLink::get_port()
+{
+    sockaddr_in local;
+    socklen_t length = sizeof(local);
+    if (sock == NO_SOCKET || getsockname(sock, (sockaddr *)&local, &length) != 0)
+        return 0;
+    return ntohs(local.sin_port);
+}
+
+bool NetLink::set_peer(const char *host, int port)
+{
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    addrinfo *found = NULL;
+    if (getaddrinfo(host, NULL, &hints, &found) != 0 || found == NULL)
+        return false;
+    set_peer(ntohl(((sockaddr_in *)found->ai_addr)->sin_addr.s_addr), port);
+    freeaddrinfo(found);
+    return true;
+}
+
+void NetLink::set_peer(unsigned int address, int port)
+{
+    peerAddress = address;
+    peerPort = port;
+    peerKnown = true;
+}
+
+bool NetLink::is_peer(unsigned int address, int port)
+{
+    return peerKnown && address == peerAddress && port == peerPort;
+}
+
+bool NetLink::has_peer()
+{
+    return peerKnown;
+}
+
+//Hold back and drop what is sent from here on - 0, 0, 0 sends straight away
+void NetLink::set_shim(int delayMs, int jitterMs, int percentLost, unsigned int seed)
+{
+    delayMicros = delayMs * 1000;
+    jitterMicros = jitterMs * 1000;
+    lossPercent = percentLost;
+    random.seed(seed, STREAM_NET_SHIM);
+}
+
+void NetLink::send_now(const unsigned char *data, int length)
+{
+    if (sock == NO_SOCKET || !peerKnown)
+        return;
+
+    sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = htonl(peerAddress);
+    to.sin_port = htons((unsigned short)peerPort);
+    sendto(sock, (const char *)data, length, 0, (sockaddr *)&to, sizeof(to));
+}
+
+void NetLink::send(const unsigned char *data, int length, long long now)
+{
+    if (lossPercent > 0 && int(random.next() % 100) < lossPercent)
+        return;
+
+    if (delayMicros == 0 && jitterMicros == 0)
+    {
+        send_now(data, length);
+        return;
+    }
+
+    //a full shim loses the packet, as a full router queue would
+    if (delayedCount == MAX_DELAYED_PACKETS || length > MAX_PACKET_SIZE)
+        return;
+
+    DelayedPacket &packet = delayed[delayedCount++];
+    packet.due = now + delayMicros;
+    if (jitterMicros > 0)
+        packet.due += random.next() % (jitterMicros + 1);
+    packet.length = length;
+    memcpy(packet.data, data, length);
+}
+
+//Send whatever the shim has held back long enough
+void NetLink::flush(long long now)
+{
+    int kept = 0;
+    for (int i = 0; i < delayedCount; i++)
+    {
+        if (delayed[i].due <= now)
+            send_now(delayed[i].data, delayed[i].length);
+        else
+        {
+            if (kept != i)
+                delayed[kept] = delayed[i];
+            kept++;
+        }
+    }
+    delayedCount = kept;
+}
+
+//Next packet waiting, its length or 0 when there is none
+int NetLink::receive(unsigned char *data, int size, unsigned int *address, int *port)
+{
+    if (sock == NO_SOCKET)
+        return 0;
+
+    sockaddr_in from;
+    socklen_t length = sizeof(from);
+    int received = recvfrom(sock, (char *)data, size, 0, (sockaddr *)&from, &length);
+    if (received <= 0)
+        return 0;
+
+    *address = ntohl(from.sin_addr.s_addr);
+    *port = ntohs(from.sin_port);
+    return received;
+}
+
+RollbackSession::RollbackSession()
+{
+    status = NET_CLOSED;
+    hosting = false;
+    localSide = SIDE_LEFT;
+    seed = 0;
+    clear();
+}
+
+void RollbackSession::clear()
+{
+    match = NULL;
+    frame = 0;
+    remoteCount = 0;
+    remoteAcked = 0;
+    remoteFrame = 0;
+    remoteAdvantage = 0;
+    rollbackFrom = 0;
+    syncedFrame = -1;
+    recorded = 0;
+    //the first hello goes straight out
+    lastSent = -HELLO_INTERVAL_MS * 1000LL;
+    lastHeard = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+//Wait on port for someone to join, the match will be played from matchSeed
+bool RollbackSession::host(int port, unsigned int matchSeed)
+{
+    close();
+    if (!link.open(port))
+        return false;
+
+    hosting = true;
+    localSide = SIDE_LEFT;
+    seed = matchSeed;
+    status = NET_CONNECTING;
+    return true;
+}
+
+bool RollbackSession::join(const char *address, int port)
+{
+    close();
+    if (!link.open(0) || !link.set_peer(address, port))
+    {
+        link.close();
+        return false;
+    }
+
+    hosting = false;
+    localSide = SIDE_RIGHT;
+    status = NET_CONNECTING;
+    return true;
+}
+
+void RollbackSession::set_shim(int delayMs, int jitterMs, int percentLost, unsigned int shimSeed)
+{
+    link.set_shim(delayMs, jitterMs, percentLost, shimSeed);
+}
+
+void RollbackSession::close()
+{
+    link.close();
+    status = NET_CLOSED;
+    clear();
+}
+
+void RollbackSession::put_header(unsigned char *data, int type)
+{
+    write_u32(data, NET_MAGIC);
+    data[4] = (unsigned char)type;
+}
+
+void RollbackSession::send_hello(int type, long long now)
+{
+    unsigned char data[HELLO_SIZE];
+    put_header(data, type);
+    write_u32(data + PACKET_HEADER_SIZE, NET_PROTOCOL);
+    write_u32(data + PACKET_HEADER_SIZE + 4, SIM_HZ);
+    write_u32(data + PACKET_HEADER_SIZE + 8, PHYSICS_KIND);
+    write_u32(data + PACKET_HEADER_SIZE + 12, type == PACKET_WELCOME ? seed : 0);
+
+    link.send(data, HELLO_SIZE, now);
+    stats.packetsSent++;
+    lastSent = now;
+}
+
+//Every local input the other side hasn't acknowledged, so a lost packet
+//costs nothing once the next one arrives
+void RollbackSession::send_inputs(long long now)
+{
+    unsigned char data[MAX_PACKET_SIZE];
+    int first = remoteAcked;
+    if (frame - first > MAX_PACKET_INPUTS)
+        first = frame - MAX_PACKET_INPUTS;
+    int count = frame - first;
+
+    put_header(data, PACKET_INPUTS);
+    write_u32(data + PACKET_HEADER_SIZE, frame);
+    write_u32(data + PACKET_HEADER_SIZE + 4, remoteCount);
+    write_u32(data + PACKET_HEADER_SIZE + 8, (unsigned int)(frame - remoteFrame));
+    write_u32(data + PACKET_HEADER_SIZE + 12, first);
+    data[PACKET_HEADER_SIZE + 16] = (unsigned char)count;
+    for (int i = 0; i < count; i++)
+        data[INPUTS_HEADER_SIZE + i] = (unsigned char)localInputs[(first + i) & INPUT_HISTORY_MASK];
+
+    link.send(data, INPUTS_HEADER_SIZE + count, now);
+    stats.packetsSent++;
+    lastSent = now;
+}
+
+void RollbackSession::receive(long long now)
+{
+    unsigned char data[MAX_PACKET_SIZE];
+    unsigned int address;
+    int port;
+    int length;
+
+    while ((length = link.receive(data, MAX_PACKET_SIZE, &address, &port)) > 0)
+    {
+        if (length < PACKET_HEADER_SIZE || read_u32(data) != NET_MAGIC)
+            continue;
+        stats.packetsReceived++;
+
+        switch (data[4])
+        {
+            case PACKET_HELLO:
+                handle_hello(data, length, address, port, now);
+                break;
+            case PACKET_WELCOME:
+                if (link.is_peer(address, port))
+                    handle_welcome(data, length, now);
+                break;
+            case PACKET_INPUTS:
+                if (link.is_peer(address, port))
+                    handle_inputs(data, length, now);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (status == NET_PLAYING && now - lastHeard > NET_TIMEOUT_MS * 1000LL)
+        status = NET_LOST;
+}
+
+bool same_rules(const unsigned char *data)
+{
+    return read_u32(data + PACKET_HEADER_SIZE) == NET_PROTOCOL
+        && read_u32(data + PACKET_HEADER_SIZE + 4) == (unsigned int)SIM_HZ
+        && read_u32(data + PACKET_HEADER_SIZE + 8) == (unsigned int)PHYSICS_KIND;
+}
+
+//The host takes the first player to say hello, and welcomes them again
+//whenever they ask, in case the welcome was lost
+void RollbackSession::handle_hello(const unsigned char *data, int length, unsigned int address, int port, long long now)
+{
+    if (!hosting || length < HELLO_SIZE)
+        return;
+
+    if (!link.has_peer())
+    {
+        link.set_peer(address, port);
+        //told either way, so both ends can say why the match won't start
+        status = same_rules(data) ? NET_PLAYING : NET_MISMATCH;
+        lastHeard = now;
+    }
+    if (link.is_peer(address, port))
+        send_hello(PACKET_WELCOME, now);
+}
+
+void RollbackSession::handle_welcome(const unsigned char *data, int length, long long now)
+{
+    if (hosting || status != NET_CONNECTING || length < HELLO_SIZE)
+        return;
+
+    if (!same_rules(data))
+    {
+        status = NET_MISMATCH;
+        return;
+    }
+
+    seed = read_u32(data + PACKET_HEADER_SIZE + 12);
+    status = NET_PLAYING;
+    lastHeard = now;
+}
+
+//Take the other side's inputs in step order. One for a step already taken
+//that differs from what was guessed marks the match for rolling back.
+void RollbackSession::handle_inputs(const unsigned char *data, int length, long long now)
+{
+    if (status != NET_PLAYING || length < INPUTS_HEADER_SIZE)
+        return;
+
+    int sentFrame = read_u32(data + PACKET_HEADER_SIZE);
+    int ack = read_u32(data + PACKET_HEADER_SIZE + 4);
+    int advantage = (int)read_u32(data + PACKET_HEADER_SIZE + 8);
+    int first = read_u32(data + PACKET_HEADER_SIZE + 12);
+    int count = data[PACKET_HEADER_SIZE + 16];
+    if (length < INPUTS_HEADER_SIZE + count)
+        return;
+
+    lastHeard = now;
+
+    //packets can arrive out of order, the newest one says where the other side is
+    if (sentFrame >= remoteFrame)
+    {
+        remoteFrame = sentFrame;
+        remoteAdvantage = advantage;
+    }
+    if (ack > remoteAcked && ack <= frame)
+        remoteAcked = ack;
+
+    for (int i = 0; i < count; i++)
+    {
+        int step = first + i;
+        if (step < remoteCount)
+            continue;
+        //after a gap, wait for it to be sent again
+        if (step > remoteCount || step >= frame + MAX_PACKET_INPUTS)
+            break;
+
+        int input = data[INPUTS_HEADER_SIZE + i];
+        remoteInputs[step & INPUT_HISTORY_MASK] = input;
+        if (step < frame && input != usedInputs[step & INPUT_HISTORY_MASK] && step < rollbackFrom)
+            rollbackFrom = step;
+        remoteCount++;
+    }
+}
+
+//Handshake - once it is done the match is started on match_init with the
+//host's seed and this returns true. Call it until then.
+bool RollbackSession::connect(MatchState *state, long long now)
+{
+    if (status == NET_CONNECTING)
+    {
+        receive(now);
+        if (!hosting && status == NET_CONNECTING && now - lastSent >= HELLO_INTERVAL_MS * 1000LL)
+            send_hello(PACKET_HELLO, now);
+        link.flush(now);
+    }
+
+    if (status != NET_PLAYING)
+        return false;
+
+    if (match == NULL)
+    {
+        match = state;
+        match_init(match, seed);
+        lastHeard = now;
+    }
+    return true;
+}
+
+//whatever the other side pressed last, held - its keys change far less often than steps go by
+int RollbackSession::guess_remote()
+{
+    if (remoteCount == 0)
+        return INPUT_NONE;
+    return remoteInputs[(remoteCount - 1) & INPUT_HISTORY_MASK] & INPUT_KEYS;
+}
+
+void RollbackSession::run_step(int step)
+{
+    saved[step % MAX_ROLLBACK] = *match;
+
+    int remote = step < remoteCount ? remoteInputs[step & INPUT_HISTORY_MASK] : guess_remote();
+    int local = localInputs[step & INPUT_HISTORY_MASK];
+    usedInputs[step & INPUT_HISTORY_MASK] = remote;
+
+    if (localSide == SIDE_LEFT)
+        match_step(match, local, remote);
+    else
+        match_step(match, remote, local);
+}
+
+//Back to the first step that ran on a wrong guess, and forward again to now
+void RollbackSession::roll_back()
+{
+    int depth = frame - rollbackFrom;
+    *match = saved[rollbackFrom % MAX_ROLLBACK];
+    for (int step = rollbackFrom; step < frame; step++)
+        run_step(step);
+    rollbackFrom = frame;
+
+    stats.rollbacks++;
+    stats.resimulated += depth;
+    if (depth > stats.deepest)
+        stats.deepest = depth;
+}
+
+//One step of the match with this side's input, fixing up earlier steps first
+//if the other side's inputs for them came in different from the guess. False
+//when the step is held back - the network is too far behind to guess any
+//further, or this side is running ahead of the other and waits for it.
+bool RollbackSession::advance(int localInput, long long now)
+{
+    if (match == NULL)
+        return false;
+
+    receive(now);
+    if (status != NET_PLAYING)
+        return false;
+
+    if (rollbackFrom < frame)
+        roll_back();
+
+    bool wait = frame - remoteCount >= MAX_ROLLBACK;
+    if (!wait && frame % SYNC_INTERVAL == 0 && frame != syncedFrame)
+    {
+        //each side sees the other late by the same latency, so half the
+        //difference between how far ahead each thinks it is is the real gap
+        syncedFrame = frame;
+        wait = ((frame - remoteFrame) - remoteAdvantage) / 2 >= 1;
+    }
+
+    if (wait)
+        stats.waits++;
+    else
+    {
+        localInputs[frame & INPUT_HISTORY_MASK] = localInput;
+        run_step(frame);
+        frame++;
+        rollbackFrom = frame;
+    }
+
+    send_inputs(now);
+    link.flush(now);
+    return !wait;
+}
+
+//Keep the connection going without stepping - true once every step taken
+//so far has both sides' real inputs and the match is no longer a guess
+bool RollbackSession::settle(long long now)
+{
+    if (match == NULL)
+        return false;
+
+    receive(now);
+    if (status != NET_PLAYING)
+        return false;
+
+    if (rollbackFrom < frame)
+        roll_back();
+    send_inputs(now);
+    link.flush(now);
+    return remoteCount >= frame;
+}
+
+//Inputs of the next step both sides' inputs are known for, for the replay.
+//Call it every step, only the last INPUT_HISTORY are kept.
+bool RollbackSession::next_confirmed(int *leftInput, int *rightInput)
+{
+    if (recorded >= get_confirmed())
+        return false;
+
+    int local = localInputs[recorded & INPUT_HISTORY_MASK];
+    int remote = remoteInputs[recorded & INPUT_HISTORY_MASK];
+    *leftInput = localSide == SIDE_LEFT ? local : remote;
+    *rightInput = localSide == SIDE_LEFT ? remote : local;
+    recorded++;
+    return true;
+}
+
+int RollbackSession::get_status()
+{
+    return status;
+}
+
+int RollbackSession::get_side()
+{
+    return localSide;
+}
+
+unsigned int RollbackSession::get_seed()
+{
+    return seed;
+}
+
+int RollbackSession::get_frame()
+{
+    return frame;
+}
+
+//Steps with both sides' real inputs
+int RollbackSession::get_confirmed()
+{
+    return remoteCount < frame ? remoteCount : frame;
+}
+
+int RollbackSession::get_port()
+{
+    return link.get_port();
+}
+
+NetStats *RollbackSession::get_stats()
+{
+    return &stats;
+}
+
+//Fingerprint of what decides how the match goes on, for checking that two
+//machines (or a machine and a replay) ended up in the same place
+unsigned long long match_checksum(MatchState *match)
+{
+    double vx, vy;
+    match->theBall.get_velocity(&vx, &vy);
+    Rect *ball = match->theBall.get_position();
+
+    unsigned long long values[12];
+    values[0] = match->leftPaddle.get_position()->y;
+    values[1] = match->rightPaddle.get_position()->y;
+    values[2] = ball->x;
+    values[3] = ball->y;
+    memcpy(&values[4], &vx, sizeof(vx));
+    memcpy(&values[5], &vy, sizeof(vy));
+    values[6] = match->leftScore;
+    values[7] = match->rightScore;
+    values[8] = match->serves;
+    values[9] = match->timers.get_now();
+    values[10] = (match->endGame ? 1 : 0) | (match->justStarted ? 2 : 0) | (match->blinkShown ? 4 : 0);
+    values[11] = (match->theBall.is_delayed() ? 1 : 0) | (match->theBall.is_scored() ? 2 : 0);
+
+    unsigned long long hash = 0;
+    for (int i = 0; i < 12; i++)
+        hash = split_mix(hash ^ values[i]);
+    return hash;
+}
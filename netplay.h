@@ -0,0 +1,169 @@
+#ifndef NETPLAY_H
+#define NETPLAY_H
+
+//Two player matches over UDP with rollback - no SDL, so headless.cpp can
+//play both ends against each other on localhost.
+//
+//Each side steps its match the moment its own input is known, guessing the
+//other side's input (it keeps holding whatever keys it last sent). Every
+//step's state is saved first; when the real input for a step turns out to
+//differ from the guess, the match is put back to that step and stepped
+//again up to the present with what was really pressed. The local player
+//never waits on the network, at any round trip the rollback window covers.
+
+#include "sim.h"
+
+const int NET_DEFAULT_PORT = 7240;
+const unsigned int NET_PROTOCOL = 1;
+
+//steps a side may run past the last input it has from the other, ~270 ms;
+//beyond it the side waits for the network rather than guessing further
+const int MAX_ROLLBACK = 64;
+
+//inputs kept for each side - more than a packet can still be asked for
+const int INPUT_HISTORY = 256;
+const int INPUT_HISTORY_MASK = INPUT_HISTORY - 1;
+
+//packets are sent every step, and carry every input the other side hasn't acknowledged
+const int MAX_PACKET_SIZE = 256;
+const int MAX_PACKET_INPUTS = 2 * MAX_ROLLBACK;
+
+//packets the shim can hold back at once
+const int MAX_DELAYED_PACKETS = 128;
+
+const int HELLO_INTERVAL_MS = 100;
+const int NET_TIMEOUT_MS = 5000;
+
+//how often the side that is ahead in time waits a step for the other
+const int SYNC_INTERVAL = SIM_HZ / 4;
+
+enum NetStatus
+{
+    NET_CLOSED,
+    NET_CONNECTING,
+    NET_PLAYING,
+    NET_LOST,       //nothing heard for NET_TIMEOUT_MS
+    NET_MISMATCH,   //the other side runs a different protocol, step rate or physics
+};
+
+enum PacketTypes
+{
+    PACKET_HELLO,   //joining side, until it is welcomed
+    PACKET_WELCOME, //host's answer, with the match seed
+    PACKET_INPUTS,
+};
+
+struct DelayedPacket
+{
+    long long due; //steady clock microseconds
+    int length;
+    unsigned char data[MAX_PACKET_SIZE];
+};
+
+//UDP socket to the other player. Whatever it sends can go through a shim
+//that holds packets back delayMs (plus up to jitterMs, so they can arrive
+//out of order) and drops lossPercent of them, to try rollback on localhost.
+class NetLink
+{
+    private:
+#ifdef _WIN32
+        size_t sock;
+#else
+        int sock;
+#endif
+        //IPv4, host byte order
+        unsigned int peerAddress;
+        int peerPort;
+        bool peerKnown;
+        int delayMicros, jitterMicros, lossPercent;
+        SplitMix random;
+        DelayedPacket delayed[MAX_DELAYED_PACKETS];
+        int delayedCount;
+
+        void send_now(const unsigned char *data, int length);
+    public:
+        NetLink();
+        ~NetLink();
+        bool open(int port);
+        void close();
+        int get_port();
+        bool set_peer(const char *host, int port);
+        void set_peer(unsigned int address, int port);
+        bool is_peer(unsigned int address, int port);
+        bool has_peer();
+        void set_shim(int delayMs, int jitterMs, int percentLost, unsigned int seed);
+        void send(const unsigned char *data, int length, long long now);
+        void flush(long long now);
+        int receive(unsigned char *data, int size, unsigned int *address, int *port);
+};
+
+struct NetStats
+{
+    long long rollbacks;    //times the match was put back and stepped again
+    long long resimulated;  //steps taken again
+    int deepest;            //most steps rolled back at once
+    long long waits;        //steps held back, for the network or to let the other side catch up
+    long long packetsSent;
+    long long packetsReceived;
+};
+
+//One side of a networked match. The host plays the left paddle and picks
+//the seed, the joining side plays the right.
+class RollbackSession
+{
+    private:
+        NetLink link;
+        int status;
+        bool hosting;
+        int localSide;
+        unsigned int seed;
+        MatchState *match;
+        //state before each of the last MAX_ROLLBACK steps, by step
+        MatchState saved[MAX_ROLLBACK];
+        int localInputs[INPUT_HISTORY];
+        int remoteInputs[INPUT_HISTORY];
+        int usedInputs[INPUT_HISTORY]; //the remote input each step ran with, guessed or not
+        int frame;           //next step to take
+        int remoteCount;     //remote inputs in, every step before this one is known
+        int remoteAcked;     //local inputs the other side has
+        int remoteFrame;     //the other side's frame, when it last sent
+        int remoteAdvantage; //how far it thought it was ahead of us then
+        int rollbackFrom;    //first step run on a wrong guess, frame when there is none
+        int syncedFrame;     //last step held back to even out the frame advantage
+        int recorded;        //confirmed steps handed out by next_confirmed
+        long long lastSent, lastHeard;
+        NetStats stats;
+
+        void clear();
+        void put_header(unsigned char *data, int type);
+        void send_hello(int type, long long now);
+        void send_inputs(long long now);
+        void receive(long long now);
+        void handle_hello(const unsigned char *data, int length, unsigned int address, int port, long long now);
+        void handle_welcome(const unsigned char *data, int length, long long now);
+        void handle_inputs(const unsigned char *data, int length, long long now);
+        int guess_remote();
+        void run_step(int step);
+        void roll_back();
+    public:
+        RollbackSession();
+        bool host(int port, unsigned int matchSeed);
+        bool join(const char *address, int port);
+        void set_shim(int delayMs, int jitterMs, int percentLost, unsigned int shimSeed);
+        void close();
+        bool connect(MatchState *state, long long now);
+        bool advance(int localInput, long long now);
+        bool settle(long long now);
+        bool next_confirmed(int *leftInput, int *rightInput);
+        int get_status();
+        int get_side();
+        unsigned int get_seed();
+        int get_frame();
+        int get_confirmed();
+        int get_port();
+        NetStats *get_stats();
+};
+
+unsigned long long match_checksum(MatchState *match);
+
+#endif
@@ -0,0 +1,44 @@
+#include "SDL/SDL.h"
+#include "pacer.h"
+
+FramePacer::FramePacer()
+{
+    capped = false;
+    frameTime = std::chrono::steady_clock::duration::zero();
+    deadline = std::chrono::steady_clock::now();
+}
+
+void FramePacer::set_rate(int fps)
+{
+    capped = (fps > 0);
+    if (capped)
+        frameTime = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / fps;
+    start();
+}
+
+void FramePacer::start()
+{
+    deadline = std::chrono::steady_clock::now() + frameTime;
+}
+
+//Sleep until just before the deadline, then spin the rest of the way
+void FramePacer::wait()
+{
+    if (!capped)
+        return;
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::chrono::microseconds left = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+
+    if (left.count() > SPIN_MARGIN_US)
+        SDL_Delay((left.count() - SPIN_MARGIN_US) / 1000);
+
+    while (std::chrono::steady_clock::now() < deadline)
+        ;
+
+    //if a frame ran long, start over from now rather than rushing to catch up
+    now = std::chrono::steady_clock::now();
+    deadline += frameTime;
+    if (deadline < now)
+        deadline = now + frameTime;
+}
@@ -0,0 +1,28 @@
+#ifndef PACER_H
+#define PACER_H
+
+#include <chrono>
+
+//default frame rate cap, 0 runs uncapped
+const int DEFAULT_FRAME_RATE = 60;
+
+//how long before a deadline to stop sleeping and spin instead, since
+//SDL_Delay can oversleep by a few milliseconds
+const int SPIN_MARGIN_US = 2000;
+
+//Frame pacer - holds the main loop to a target rate without busy-spinning
+//the whole frame
+class FramePacer
+{
+    private:
+        std::chrono::steady_clock::duration frameTime;
+        std::chrono::steady_clock::time_point deadline;
+        bool capped;
+    public:
+        FramePacer();
+        void set_rate(int fps);
+        void start();
+        void wait();
+};
+
+#endif
@@ -1,276 +1,197 @@
-#define _USE_MATH_DEFINES
-#include "SDL/SDL.h"
-#include "SDL/SDL_ttf.h"
-#include <string>
-#include <sstream>
-#include <fstream>
-#include <cmath>
-#include <ctime>
-#include <cstdlib>
-
-//constants
-const int SCREEN_WIDTH = 640;
-const int SCREEN_HEIGHT = 480;
-const int SCREEN_BPP = 32;
-
-const int SCORE_FONT_SIZE = 48;
-const int PAUSE_FONT_SIZE = 24;
-
-const int DIVIDER_WIDTH = 2;
-const int PADDLE_WIDTH = 10;
-const int PADDLE_HEIGHT_DEF = 50;
-const int BALL_WIDTH = 10;
-const int BALL_INIT_VEL = 150;
-
-const int LEFT_SCORE_X = 260;
-const int LEFT_SCORE_Y = 50;
-const int RIGHT_SCORE_X = 378;
-const int RIGHT_SCORE_Y = 50;
-
-const int SCORE_LIMIT = 7;
-
-// key settings
-const SDLKey leftUp = SDLK_a;
-const SDLKey leftDown = SDLK_z;
-const SDLKey rightUp = SDLK_UP;
-const SDLKey rightDown = SDLK_DOWN;
+#include "pong.h"
+#include "fontdata.h"
+
+//a stale fontdata.h would quietly send the game back to reading the font file
+static_assert(has_baked_size(BAKED_FONTS, BAKED_FONT_COUNT, SCORE_FONT_SIZE) && has_baked_size(BAKED_FONTS, BAKED_FONT_COUNT, PAUSE_FONT_SIZE),
+    "fontdata.h isn't baked at SCORE_FONT_SIZE and PAUSE_FONT_SIZE, rerun fontbake (FontBake target)");
 
 //variables
 SDL_Surface *screen;
-SDL_Surface *left, *right;
 
 SDL_Event event;
 
 TTF_Font *font;
 TTF_Font *fontPause;
 
+GlyphAtlas scoreGlyphs;
+GlyphAtlas pauseGlyphs;
+GlyphAtlas creditGlyphs;
+
 SDL_Color textColor = {0xFF, 0xFF, 0xFF};
+SDL_Color nameColor = {0x11, 0x11, 0x11};
+
+//Dirty rectangles - only the parts of the screen that changed get pushed
+bool dirtyRendering = true;
+bool fullRedraw = true;
+SDL_Rect dirtyRects[MAX_DIRTY_RECTS];
+int dirtyCount = 0;
+
+//Frame timing - dumped with F12, and on exit with -profile
+Profiler profiler;
+bool profileOnExit = false;
+
+//Replay to play back instead of taking keyboard input (-replay file, -fast)
+const char *replayFile = NULL;
+bool replayFast = false;
+bool recordReplays = true;
 
-//Game states
-enum GameStates
-{
-    STATE_NULL,
-    STATE_INTRO,
-    STATE_HELP,
-    STATE_CREDITS,
-    STATE_SETTINGS,
-    STATE_GAME,
-    STATE_EXIT,
-};
-
-//functions
-bool init();
-bool load_files();
-void clean_up();
-void apply_surface(int x, int y, SDL_Surface *source, SDL_Surface *destination, SDL_Rect *clip = NULL);
-
-bool check_collision(int ballX, int ballY, SDL_Rect *pad);
-
-bool show_start();
-
-//Game state handling
-void set_next_state(int newState);
-void change_state();
-
-// Timer - to regulate ball speed
-class Timer
-{
-    private:
-        int startTicks;
-        bool started;
-    public:
-        Timer();
-        void start();
-        int get_ticks();
-};
-
-//Paddle class - movement of paddle
-class Paddle
-{
-    private:
-        int vel;
-        double frameVel;
-        //int score;
-        double realY;
-        SDL_Rect position;
-        SDLKey goUp, goDown;
-    public:
-        Paddle();
-        Paddle(SDL_Rect initialPosition, SDLKey up, SDLKey down);
-        void init(SDL_Rect initialPosition, SDLKey up, SDLKey down);
-        void set_keys(SDLKey up, SDLKey down);
-        SDLKey get_up_key();
-        SDLKey get_down_key();
-        void handle_input();
-        void move(int delta);
-        void show();
-        SDL_Rect *get_position();
-};
-
-//Ball class - movement of paddle, also handles collisions between ball and scoring areas, walls, paddle
-class Ball
-{
-    private:
-        double vel, frameVel;
-        bool right;
-        bool delayed;
-        int delayTick;
-        bool scored;
-        int scoredTick;
-        double angle;
-        double realX, realY;
-        SDL_Rect position;
-    public:
-        Ball();
-        void init();
-        void speed_up();
-        int move(SDL_Rect *leftPad, SDL_Rect *rightPad, int delta);
-        void show();
-        void reset();
-        bool is_delayed();
-        int delayed_ticks();
-        void delay();
-        void stop_delay();
-        void have_scored();
-        bool is_scored();
-        int scored_ticks();
-        void begin();
-};
-
-//GameState class
-class GameState
-{
-    public:
-        virtual void handle_events() = 0;
-        virtual void logic() = 0;
-        virtual void render() = 0;
-        virtual ~GameState(){};
-};
+int multiBalls = 0;
+
+bool aiLeft = false, aiRight = false;
+int aiDifficulty = AI_NORMAL;
+
+bool netHosting = false;
+std::string netAddress;
+int netPort = NET_DEFAULT_PORT;
+int netDelay = 0, netJitter = 0, netLoss = 0;
 
 int stateID = STATE_NULL;
 int nextState = STATE_NULL;
 
 GameState *currentState = NULL;
 
-//Game states
-//-------------------------------------------------
-class Intro : public GameState
-{
-    private:
-        SDL_Surface *message;
-        SDL_Surface *help;
-        SDL_Surface *credits;
-    public:
-        Intro();
-        ~Intro();
-        void handle_events();
-        void logic();
-        void render();
-};
-
-class Game : public GameState
-{
-    private:
-        SDL_Rect divider;
-        Paddle leftPaddle;
-        Paddle rightPaddle;
-        Ball theBall;
-        int leftScore, rightScore;
-        bool paused, endGame, justStarted;
-        int startedTick;
-        Timer delta;
-    public:
-        Game();
-        ~Game();
-        void handle_events();
-        void logic();
-        void render();
-        void update_scores(int leftScore, int rightScore);
-        int start_ticks();
-        void reset_start();
-        void show_pause();
-};
-
-class Help : public GameState
-{
-    private:
-        SDL_Surface *player1;
-        SDL_Surface *player1Instructions;
-        SDL_Surface *player2;
-        SDL_Surface *player2Instructions;
-        SDL_Surface *pause;
-        SDL_Surface *escape;
-    public:
-        Help();
-        ~Help();
-        void handle_events();
-        void logic();
-        void render();
-};
-
-class Credits : public GameState
-{
-    private:
-        SDL_Surface *cred;
-        SDL_Surface *fontCred;
-        SDL_Surface *nameCred;
-    public:
-        Credits();
-        ~Credits();
-        void handle_events();
-        void logic();
-        void render();
-};
-
-//-------------------------------------------------
-
-//Error logger
-std::ofstream logger("log.txt");
-void log(std::string message)
-{
-    logger << message << std::endl;
-    logger.flush();
+//Every state is built the first time it is needed, in static storage of its
+//own, and stays resident until free_states - a transition is just exit()
+//on one and enter() on the other
+GameState *residentStates[STATE_EXIT];
+
+template <class State>
+GameState *build_state()
+{
+    static typename std::aligned_storage<sizeof(State), alignof(State)>::type slot;
+    return new (&slot) State();
 }
 
+//the benchmark links everything here but has its own main
+#ifndef PONG_NO_MAIN
 int main(int argc, char *argv[])
 {
-    srand(time(NULL));
+    int frameRate = DEFAULT_FRAME_RATE;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string(argv[i]) == "-fullredraw")
+            dirtyRendering = false;
+        else if (std::string(argv[i]) == "-fps" && i + 1 < argc)
+            frameRate = atoi(argv[++i]);
+        else if (std::string(argv[i]) == "-profile")
+            profileOnExit = true;
+        else if (std::string(argv[i]) == "-replay" && i + 1 < argc)
+            replayFile = argv[++i];
+        else if (std::string(argv[i]) == "-fast")
+            replayFast = true;
+        else if (std::string(argv[i]) == "-norecord")
+            recordReplays = false;
+        else if (std::string(argv[i]) == "-multiball" && i + 1 < argc)
+            multiBalls = atoi(argv[++i]);
+        else if (std::string(argv[i]) == "-ai" && i + 1 < argc)
+        {
+            std::string side = argv[++i];
+            aiLeft = (side == "left" || side == "both");
+            aiRight = (side == "right" || side == "both");
+        }
+        else if (std::string(argv[i]) == "-difficulty" && i + 1 < argc)
+        {
+            aiDifficulty = parse_difficulty(argv[++i]);
+            if (aiDifficulty < 0)
+                aiDifficulty = AI_NORMAL;
+        }
+        else if (std::string(argv[i]) == "-host")
+        {
+            netHosting = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                netPort = atoi(argv[++i]);
+        }
+        else if (std::string(argv[i]) == "-join" && i + 1 < argc)
+        {
+            netAddress = argv[++i];
+            size_t colon = netAddress.rfind(':');
+            if (colon != std::string::npos)
+            {
+                netPort = atoi(netAddress.c_str() + colon + 1);
+                netAddress.erase(colon);
+            }
+        }
+        else if (std::string(argv[i]) == "-netdelay" && i + 1 < argc)
+            netDelay = atoi(argv[++i]);
+        else if (std::string(argv[i]) == "-netjitter" && i + 1 < argc)
+            netJitter = atoi(argv[++i]);
+        else if (std::string(argv[i]) == "-netloss" && i + 1 < argc)
+            netLoss = atoi(argv[++i]);
+    }
 
     //Key settings array
     //SDLKey keys[4];
 
+    //Error logger, written from a background thread
+    logger_start("log.txt");
+
     //Initialization
     if (!init())
+    {
+        log_printf(LOG_ERROR, "Could not initialise: %s", SDL_GetError());
+        logger_stop();
         return 1;
+    }
     if (!load_files())
+    {
+        log_printf(LOG_ERROR, "Could not load files: %s", SDL_GetError());
+        logger_stop();
         return 1;
+    }
 
+    //the game and its text are built up front, the other screens on first use
+    get_state(STATE_GAME);
     stateID = STATE_INTRO;
-    currentState = new Intro();
+    currentState = get_state(STATE_INTRO);
+    currentState->enter();
+
+    FramePacer pacer;
+    pacer.set_rate(frameRate);
+    bool idle = false;
 
     while (stateID != STATE_EXIT)
     {
+        //nothing to redraw on a static screen until an event comes in
+        if (idle)
+            SDL_WaitEvent(NULL);
+
+        profiler.start_frame();
         currentState->handle_events();
+        profiler.end_phase(PROFILE_EVENTS);
         currentState->logic();
+        profiler.end_phase(PROFILE_LOGIC);
         change_state();
+        profiler.end_phase(PROFILE_CHANGE_STATE);
         currentState->render();
+        profiler.end_phase(PROFILE_RENDER);
 
-        if (SDL_Flip(screen) == -1)
+        if (!present())
             return 1;
+        currentState->presented();
+        profiler.end_phase(PROFILE_PRESENT);
+        profiler.end_frame();
+
+        idle = currentState->is_static();
+        if (!idle)
+            pacer.wait();
     }
 
+    if (profileOnExit)
+        dump_profile();
+
+    currentState->exit();
+    free_states();
     clean_up();
     return 0;
 }
+#endif
 
 bool init()
 {
     if (SDL_Init(SDL_INIT_EVERYTHING) == -1)
         return false;
 
-    if (TTF_Init() == -1)
-        return false;
-
     screen = SDL_SetVideoMode(SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_BPP, SDL_SWSURFACE);
     if (screen == NULL)
         return false;
@@ -282,12 +203,26 @@ bool init()
 //SDLKey &keys[]
 bool load_files()
 {
+    //every glyph is built once here, text is drawn from the atlases after this -
+    //from the glyphs baked into the binary, or the font file if a size wasn't baked
+    if (scoreGlyphs.build_baked(SCORE_FONT_SIZE, textColor) && pauseGlyphs.build_baked(PAUSE_FONT_SIZE, textColor)
+        && creditGlyphs.build_baked(PAUSE_FONT_SIZE, nameColor))
+        return true;
+
+    log_printf(LOG_WARNING, "Could not build the baked glyph atlases, loading Eurosti.TTF");
+    if (TTF_Init() == -1)
+        return false;
+
     font = TTF_OpenFont("Eurosti.TTF", SCORE_FONT_SIZE);
     fontPause = TTF_OpenFont("Eurosti.TTF", PAUSE_FONT_SIZE);
 
     if (font == NULL || fontPause == NULL)
         return false;
 
+    if (!scoreGlyphs.build(font, textColor) || !pauseGlyphs.build(fontPause, textColor)
+        || !creditGlyphs.build(fontPause, nameColor))
+        return false;
+
     return true;
 }
 
@@ -296,10 +231,16 @@ void clean_up()
     //SDL_FreeSurface(text);
     //SDL_FreeSurface(frames);
 
-    TTF_CloseFont(font);
-    TTF_CloseFont(fontPause);
+    scoreGlyphs.free_sheet();
+    pauseGlyphs.free_sheet();
+    creditGlyphs.free_sheet();
 
-    logger.close();
+    if (font != NULL)
+        TTF_CloseFont(font);
+    if (fontPause != NULL)
+        TTF_CloseFont(fontPause);
+
+    logger_stop();
 /*
     std::ofstream save("savedata");
     save << leftUp << " ";
@@ -321,261 +262,115 @@ void apply_surface(int x, int y, SDL_Surface *source, SDL_Surface *destination,
     SDL_BlitSurface(source, clip, destination, &offset);
 }
 
-Timer::Timer()
-{
-    startTicks = 0;
-    started = false;
-}
-
-void Timer::start()
-{
-    startTicks = SDL_GetTicks();
-    started = true;
-}
-
-int Timer::get_ticks()
-{
-    return (SDL_GetTicks() - startTicks);
-}
-
-bool check_collision(int ballX, int ballY, SDL_Rect *pad)
-{
-    int ballLeft, ballRight, ballTop, ballBottom;
-    int paddleLeft, paddleRight, paddleTop, paddleBottom;
-
-    ballLeft = ballX;
-    ballRight = ballX + BALL_WIDTH;
-    ballTop = ballY;
-    ballBottom = ballY + BALL_WIDTH;
-
-    paddleLeft = pad->x;
-    paddleRight = pad->x + pad->w;
-    paddleTop = pad->y;
-    paddleBottom = pad->y + pad->h;
-
-    if ((ballLeft >= paddleRight || ballRight <= paddleLeft || ballTop >= paddleBottom || ballBottom <= paddleTop) == false)
-        return true;
-
-    return false;
-}
-
-Paddle::Paddle()
-{
-    vel = 0;
-}
-
-Paddle::Paddle(SDL_Rect initialPosition, SDLKey up, SDLKey down)
-{
-    vel = 0;
-    position = initialPosition;
-    realY = position.y;
-    goUp = up;
-    goDown = down;
-}
-
-void Paddle::init(SDL_Rect pos, SDLKey up, SDLKey down)
-{
-    position = pos;
-    realY = position.y;
-    goUp = up;
-    goDown = down;
-}
-
-void Paddle::show()
-{
-    SDL_FillRect(screen, &position, SDL_MapRGB(screen->format, 0xFF, 0xFF, 0xFF));
-}
-
-void Paddle::handle_input()
-{
-    if (event.type == SDL_KEYDOWN)
-    {
-        if (event.key.keysym.sym == goUp)
-            vel -= 250;
-        else if (event.key.keysym.sym == goDown)
-            vel += 250;
-    }
-    else if (event.type == SDL_KEYUP)
-    {
-        if (event.key.keysym.sym == goUp)
-            vel += 250;
-        else if (event.key.keysym.sym == goDown)
-            vel -= 250;
-    }
-}
-
-void Paddle::move(int delta)
+SDL_Rect to_sdl_rect(Rect *rect)
 {
-    frameVel = vel * double(delta) / 1000;
-    realY += frameVel;
+    SDL_Rect offset;
 
-    //handle collision
-    if (realY < 0)
-        realY = 0;
-    else if ((realY + position.h) > SCREEN_HEIGHT)
-        realY = SCREEN_HEIGHT - position.h;
+    offset.x = rect->x;
+    offset.y = rect->y;
+    offset.w = rect->w;
+    offset.h = rect->h;
 
-    position.y = int(realY);
+    return offset;
 }
 
-SDL_Rect *Paddle::get_position()
+bool same_rect(SDL_Rect *a, SDL_Rect *b)
 {
-    return &position;
+    return a->x == b->x && a->y == b->y && a->w == b->w && a->h == b->h;
 }
 
-Ball::Ball()
-{
-    vel = BALL_INIT_VEL;
-    delayed = true;
-    scored = false;
-    delayTick = SDL_GetTicks();
-
-    if (rand()%2 == 1)
-        right = true;
-    else
-        right = false;
-
-    if (rand()%2 == 1)
-        angle = M_PI_4;
-    else
-        angle = -M_PI_4;
-
-    realX = (SCREEN_WIDTH - BALL_WIDTH)/2;
-    realY = (SCREEN_HEIGHT - BALL_WIDTH)/2;
-    position.x = int(realX);
-    position.y = int(realY);
-    position.w = BALL_WIDTH;
-    position.h = BALL_WIDTH;
+//Smallest rect covering both, an empty rect covers nothing
+SDL_Rect union_rect(SDL_Rect a, SDL_Rect b)
+{
+    if (a.w == 0 || a.h == 0)
+        return b;
+    if (b.w == 0 || b.h == 0)
+        return a;
+
+    int left = a.x < b.x ? a.x : b.x;
+    int top = a.y < b.y ? a.y : b.y;
+    int right = (a.x + a.w) > (b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+    int bottom = (a.y + a.h) > (b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+
+    SDL_Rect result;
+    result.x = left;
+    result.y = top;
+    result.w = right - left;
+    result.h = bottom - top;
+    return result;
 }
 
-int Ball::move(SDL_Rect *leftPad, SDL_Rect *rightPad, int delta)
+void mark_dirty(SDL_Rect *rect)
 {
-    //display the velocity
-    /*std::stringstream stream;
-    stream << vel;
-    log(stream.str());*/
-
-    //if delayed, don't do anything
-    if (delayed || scored)
-        return 0;
-
-    frameVel = vel * double(delta) / 1000;
+    //clip to the screen, SDL_UpdateRects doesn't
+    int left = rect->x < 0 ? 0 : rect->x;
+    int top = rect->y < 0 ? 0 : rect->y;
+    int right = (rect->x + rect->w) > SCREEN_WIDTH ? SCREEN_WIDTH : (rect->x + rect->w);
+    int bottom = (rect->y + rect->h) > SCREEN_HEIGHT ? SCREEN_HEIGHT : (rect->y + rect->h);
 
-    if (right)
-        realX += frameVel * cos(angle);
-    else
-        realX -= frameVel * cos(angle);
-    realY -= frameVel * sin(angle);
-
-    //handle collision
-    if (realY < 0)
-    {
-        realY = 0;
-        angle = -angle;
-        realY -= frameVel * sin(angle);
-    }
-    else if ((realY + position.h) > SCREEN_HEIGHT)
-    {
-        realY = SCREEN_HEIGHT - position.h;
-        angle = -angle;
-        realY -= frameVel * sin(angle);
-    }
+    if (right <= left || bottom <= top)
+        return;
 
-    if (check_collision(int(realX), int(realY), leftPad))
-    {
-        right = true;
-        realX = leftPad->x + leftPad->w;
-        realX += (frameVel * cos(angle));
-        vel += 20;
-    }
-    else if (check_collision(int(realX), int(realY), rightPad))
+    if (dirtyCount == MAX_DIRTY_RECTS)
     {
-        right = false;
-        realX = rightPad->x - position.w;
-        realX -= (frameVel * cos(angle));
-        vel += 20;
+        fullRedraw = true;
+        return;
     }
-    else if (realX < 0)
-        return 2;
-    else if ((realX + position.w) > SCREEN_WIDTH)
-        return 1;
-
-    position.x = int(realX);
-    position.y = int(realY);
 
-    return 0;
+    dirtyRects[dirtyCount].x = left;
+    dirtyRects[dirtyCount].y = top;
+    dirtyRects[dirtyCount].w = right - left;
+    dirtyRects[dirtyCount].h = bottom - top;
+    dirtyCount++;
 }
 
-void Ball::show()
+void mark_all_dirty()
 {
-    SDL_FillRect(screen, &position, SDL_MapRGB(screen->format, 0xFF, 0xFF, 0xFF));
+    fullRedraw = true;
 }
 
-void Ball::reset()
+//Push this frame to the display - the whole screen, or just the dirty rects
+bool present()
 {
-    vel = BALL_INIT_VEL;
-    delayed = true;
-    scored = false;
-    delayTick = SDL_GetTicks();
+    bool ok = true;
 
-    if (rand()%2 == 1)
-        right = true;
-    else
-        right = false;
+    if (!dirtyRendering || fullRedraw)
+        ok = (SDL_Flip(screen) != -1);
+    else if (dirtyCount > 0)
+        SDL_UpdateRects(screen, dirtyCount, dirtyRects);
 
-    if (rand()%2 == 1)
-        angle = M_PI_4;
-    else
-        angle = -M_PI_4;
-
-    realX = (SCREEN_WIDTH - BALL_WIDTH)/2;
-    realY = (SCREEN_HEIGHT - BALL_WIDTH)/2;
-    position.x = int(realX);
-    position.y = int(realY);
-    position.w = BALL_WIDTH;
-    position.h = BALL_WIDTH;
+    dirtyCount = 0;
+    fullRedraw = false;
+    return ok;
 }
 
-bool Ball::is_delayed()
+//Keys that work on every screen
+void check_hotkeys()
 {
-    return delayed;
+    if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F12)
+        dump_profile();
 }
 
-void Ball::delay()
+void dump_profile()
 {
-    delayed = true;
-    delayTick = SDL_GetTicks();
+    if (!profiler.write_summary("profile.txt") || !profiler.write_trace("trace.json"))
+        log("Could not write frame profile", LOG_WARNING);
 }
 
-int Ball::delayed_ticks()
+//Track which of a paddle's keys are held
+void update_input(int *input, SDLKey up, SDLKey down)
 {
-    return (SDL_GetTicks() - delayTick);
-}
+    int key = INPUT_NONE;
 
-void Ball::stop_delay()
-{
-    delayed = false;
-}
+    if (event.key.keysym.sym == up)
+        key = INPUT_UP;
+    else if (event.key.keysym.sym == down)
+        key = INPUT_DOWN;
 
-void Ball::begin()
-{
-    delayTick = SDL_GetTicks();
-}
-
-void Ball::have_scored()
-{
-    scored = true;
-    scoredTick = SDL_GetTicks();
-}
-
-bool Ball::is_scored()
-{
-    return scored;
-}
-
-int Ball::scored_ticks()
-{
-    return (SDL_GetTicks() - scoredTick);
+    if (event.type == SDL_KEYDOWN)
+        *input |= key;
+    else if (event.type == SDL_KEYUP)
+        *input &= ~key;
 }
 
 void set_next_state(int newState)
@@ -588,52 +383,66 @@ void change_state()
 {
     if (nextState != STATE_NULL)
     {
-        if (nextState != STATE_EXIT)
-            delete currentState;
+        GameState *next = nextState != STATE_EXIT ? get_state(nextState) : NULL;
+        if (next != NULL)
+        {
+            currentState->exit();
+            currentState = next;
+            currentState->enter();
+        }
+        stateID = nextState;
+        nextState = STATE_NULL;
+    }
+}
 
-        switch(nextState)
+GameState *get_state(int id)
+{
+    if (id <= STATE_NULL || id >= STATE_EXIT)
+        return NULL;
+
+    if (residentStates[id] == NULL)
+    {
+        switch(id)
         {
             case STATE_INTRO:
-                currentState = new Intro();
+                residentStates[id] = build_state<Intro>();
                 break;
             case STATE_GAME:
-                currentState = new Game();
+                residentStates[id] = build_state<Game>();
                 break;
             case STATE_HELP:
-                currentState = new Help();
+                residentStates[id] = build_state<Help>();
                 break;
             case STATE_CREDITS:
-                currentState = new Credits();
+                residentStates[id] = build_state<Credits>();
                 break;
             /*case STATE_SETTINGS:
-                currentState = new Settings();
+                residentStates[id] = build_state<Settings>();
                 break;*/
             default:
                 break;
         }
-        stateID = nextState;
-        nextState = STATE_NULL;
     }
+    return residentStates[id];
 }
 
-Intro::Intro()
+//Tear down every state built so far, before SDL goes
+void free_states()
 {
-    message = TTF_RenderText_Blended(font, "Press Spacebar to start.", textColor);
-    help = TTF_RenderText_Blended(fontPause, "Help: H", textColor);
-    credits = TTF_RenderText_Blended(fontPause, "Credits: C", textColor);
-}
-
-Intro::~Intro()
-{
-    SDL_FreeSurface(message);
-    SDL_FreeSurface(help);
-    SDL_FreeSurface(credits);
+    for (int i = 0; i < STATE_EXIT; i++)
+    {
+        if (residentStates[i] != NULL)
+            residentStates[i]->~GameState();
+        residentStates[i] = NULL;
+    }
+    currentState = NULL;
 }
 
 void Intro::handle_events()
 {
     while (SDL_PollEvent(&event))
     {
+        check_hotkeys();
         if (event.type == SDL_QUIT)
             set_next_state(STATE_EXIT);
         else if (event.type == SDL_KEYDOWN)
@@ -656,51 +465,166 @@ void Intro::logic()
 
 void Intro::render()
 {
+    mark_all_dirty();
     SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 0x00, 0x00, 0x00));
-    apply_surface((SCREEN_WIDTH - message->w)/2, (SCREEN_HEIGHT - message->h)/2, message, screen);
-    apply_surface(30, 420, help, screen);
-    apply_surface(500, 420, credits, screen);
+    const char *message = "Press Spacebar to start.";
+    scoreGlyphs.draw((SCREEN_WIDTH - scoreGlyphs.text_width(message))/2, (SCREEN_HEIGHT - scoreGlyphs.get_height())/2, message, screen);
+    pauseGlyphs.draw(30, 420, "Help: H", screen);
+    pauseGlyphs.draw(500, 420, "Credits: C", screen);
 }
 
 Game::Game()
 {
-    //Set up paddles, ball and central divider
+    //Set up the central divider and the text, kept for every match
     divider.x = (SCREEN_WIDTH-DIVIDER_WIDTH)/2;
     divider.y = 0;
     divider.w = DIVIDER_WIDTH;
     divider.h = SCREEN_HEIGHT;
 
-    SDL_Rect leftPos, rightPos;
+    leftText.init(&scoreGlyphs);
+    rightText.init(&scoreGlyphs);
+    startText.init(&pauseGlyphs);
+    pauseText.init(&pauseGlyphs);
+    endText.init(&pauseGlyphs);
+    pauseText.set("Press P to resume.");
+    netText.init(&pauseGlyphs);
 
-    leftPos.x = 30;
-    leftPos.y = (SCREEN_HEIGHT-PADDLE_HEIGHT_DEF)/2;
-    leftPos.w = PADDLE_WIDTH;
-    leftPos.h = PADDLE_HEIGHT_DEF;
+    running = false;
+    paused = false;
+    replaying = false;
+    networked = false;
+    netStatus = NET_CLOSED;
+    view = NULL;
+}
 
-    rightPos.x = SCREEN_WIDTH - 30 - PADDLE_WIDTH;
-    rightPos.y = (SCREEN_HEIGHT-PADDLE_HEIGHT_DEF)/2;
-    rightPos.w = PADDLE_WIDTH;
-    rightPos.h = PADDLE_HEIGHT_DEF;
+Game::~Game()
+{
+    stop_simulation();
+}
 
-    leftPaddle.init(leftPos, leftUp, leftDown);
-    rightPaddle.init(rightPos, rightUp, rightDown);
+//A fresh match every time the game is entered
+void Game::enter()
+{
+    //play back a replay, or record this match under a new name
+    unsigned int seed = (unsigned int)split_mix((unsigned long long)time(NULL) << 32 | SDL_GetTicks());
+    int balls = multiBalls;
+    replaying = false;
+    networked = false;
+    if (replayFile != NULL)
+    {
+        if (replay.open(replayFile))
+        {
+            seed = replay.get_seed();
+            balls = replay.get_balls();
+            replaying = true;
+        }
+        else
+            log_printf(LOG_ERROR, "Could not open replay %s", replayFile);
+    }
+    else if (netHosting || !netAddress.empty())
+    {
+        //the match starts, and is recorded, once the other player is there
+        if (netHosting)
+            networked = session.host(netPort, seed);
+        else
+            networked = session.join(netAddress.c_str(), netPort);
 
-    leftScore = 0;
-    rightScore = 0;
+        if (networked)
+        {
+            session.set_shim(netDelay, netJitter, netLoss, seed);
+            //the swarm isn't part of the state rolled back
+            if (balls > 0)
+                log_printf(LOG_WARNING, "Multi-ball isn't played over the network");
+            balls = 0;
+        }
+        else
+            log_printf(LOG_ERROR, "Could not open a network connection (port %d)", netPort);
+    }
+    if (!replaying && !networked && recordReplays)
+        record_match(seed, balls);
+    netStatus = session.get_status();
+    netShown = -1;
+
+    match_init(&match, seed);
+    match_add_swarm(&match, &swarm, balls);
+    log_printf(LOG_INFO, "Match seed %u, %d extra balls", seed, balls);
+    leftAI.init(SIDE_LEFT, aiDifficulty, seed);
+    rightAI.init(SIDE_RIGHT, aiDifficulty, seed);
+
+    leftInput = INPUT_NONE;
+    rightInput = INPUT_NONE;
+    leftKeys = INPUT_NONE;
+    rightKeys = INPUT_NONE;
+    stepLeftKeys = INPUT_NONE;
+    stepRightKeys = INPUT_NONE;
+    stepEnd = 0;
+    appliedInputs = 0;
+    skippedInputs = 0;
+    pushedInputs = 0;
+    measuredInputs = 0;
     paused = false;
-    endGame = false;
-    justStarted = true;
-    startedTick = SDL_GetTicks();
+    running = false;
+
+    //the renderer always has a snapshot to draw, even before the first step
+    publish_snapshot();
+    snapshots.update();
+    view = snapshots.read_slot();
+
+    leftShown = -1;
+    rightShown = -1;
+
+    char startMess[CACHED_TEXT_LENGTH];
+    sprintf(startMess, "First to %d", match.scoreLimit);
+    startText.set(startMess);
+
+    drawn = false;
+    lastPhase = PHASE_START;
+    ballShown = false;
+    scoresChanged = false;
+    SDL_Rect empty = {0, 0, 0, 0};
+    leftRect = rightRect = ballRect = empty;
+    leftScoreRect = rightScoreRect = empty;
 }
 
-Game::~Game()
+//Record this match under a new name
+void Game::record_match(unsigned int seed, int balls)
 {
+    char filename[64];
+    time_t now = time(NULL);
+    strftime(filename, sizeof(filename), "replay-%Y%m%d-%H%M%S.rpl", localtime(&now));
+    if (!recorder.open(filename, seed, balls))
+        log_printf(LOG_WARNING, "Could not record replay %s", filename);
+}
+
+//Leaving the match stops the simulation and finishes the replay file
+void Game::exit()
+{
+    stop_simulation();
+    recorder.close();
+    replay.close();
+    session.close();
+    networked = false;
+
+    //key changes the match never got to
+    while (inputs.peek() != NULL)
+        inputs.pop();
+}
+
+void Game::stop_simulation()
+{
+    running = false;
+    if (simulation.joinable())
+        simulation.join();
 }
 
 void Game::handle_events()
 {
     while (SDL_PollEvent(&event))
     {
+        //SDL 1.2 events carry no timestamp, so stamp them as they are taken
+        long long arrived = steady_micros(std::chrono::steady_clock::now());
+        int oldLeft = leftKeys, oldRight = rightKeys;
+        check_hotkeys();
         switch (event.type)
         {
             case SDL_QUIT:
@@ -709,199 +633,472 @@ void Game::handle_events()
             case SDL_KEYDOWN:
                 if (event.key.keysym.sym == SDLK_ESCAPE)
                     set_next_state(STATE_INTRO);
-                else if (event.key.keysym.sym == SDLK_p)
-                {
-                    if (!paused)
-                        paused = true;
-                    else
-                        paused = false;
-                }
+                //the other player's clock doesn't stop
+                else if (event.key.keysym.sym == SDLK_p && !networked)
+                    paused = !paused;
             default:
-                leftPaddle.handle_input();
-                rightPaddle.handle_input();
+                update_input(&leftKeys, leftUp, leftDown);
+                update_input(&rightKeys, rightUp, rightDown);
                 break;
         }
+
+        //the simulation applies it in the step covering its arrival
+        if (leftKeys != oldLeft || rightKeys != oldRight)
+        {
+            InputEvent input = {arrived, leftKeys, rightKeys};
+            if (inputs.push(input))
+                inputTimes[pushedInputs++ % INPUT_QUEUE_SIZE] = arrived;
+            else
+                log_printf(LOG_WARNING, "Input queue full, key change dropped");
+        }
     }
 }
 
+//Physics runs on its own thread, started with the first frame (the
+//benchmark calls step() itself and never starts it)
 void Game::logic()
 {
-    if (!paused)
+    if (!running)
+    {
+        running = true;
+        simulation = std::thread(&Game::simulate, this);
+    }
+}
+
+//Simulation thread - one step every SIM_DT on its own clock, however long
+//frames take to draw. A replay played with -fast steps as fast as it can.
+void Game::simulate()
+{
+    const std::chrono::nanoseconds stepTime(1000000000LL / SIM_HZ);
+
+    if (networked && !wait_for_peer())
+        return;
+    std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+
+    while (running)
     {
-        leftPaddle.move(delta.get_ticks());
-        rightPaddle.move(delta.get_ticks());
-        if (!justStarted)
+        if (paused)
         {
-            switch ( theBall.move(leftPaddle.get_position(), rightPaddle.get_position(), delta.get_ticks()) )
-            {
-                case 1:
-                    leftScore++;
-                    if (leftScore >= SCORE_LIMIT)
-                        endGame = true;
-                    theBall.have_scored();
-                    break;
-                case 2:
-                    rightScore++;
-                    if (rightScore >= SCORE_LIMIT)
-                        endGame = true;
-                    theBall.have_scored();
-                    break;
-                default:
-                    break;
-            }
+            std::this_thread::sleep_for(stepTime);
+            next = std::chrono::steady_clock::now();
+            //keep up with the keys so the queue never fills while paused
+            stepEnd = steady_micros(next);
+            take_inputs(false);
+            continue;
         }
-        else if (justStarted)
+
+        //the step taken at next covers the SIM_DT before it
+        stepEnd = steady_micros(next);
+        step();
+        if (replaying && replayFast)
+            continue;
+
+        //after a long stall, drop the backlog rather than fast-forward through it
+        next += stepTime;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now - next > stepTime * MAX_CATCH_UP_STEPS)
+            next = now;
+        std::this_thread::sleep_until(next);
+    }
+}
+
+//Handshake with the other player, then the match starts on the host's seed.
+//False if the simulation is stopped first or the other game doesn't match.
+bool Game::wait_for_peer()
+{
+    while (running)
+    {
+        long long now = steady_micros(std::chrono::steady_clock::now());
+        if (session.connect(&match, now))
         {
-            if (start_ticks() > 500)
-            {
-                justStarted = false;
-                theBall.begin();
-            }
+            unsigned int seed = session.get_seed();
+            leftAI.init(SIDE_LEFT, aiDifficulty, seed);
+            rightAI.init(SIDE_RIGHT, aiDifficulty, seed);
+            if (recordReplays)
+                record_match(seed, 0);
+            log_printf(LOG_INFO, "Connected, playing %s, match seed %u", session.get_side() == SIDE_LEFT ? "left" : "right", seed);
+            netStatus = NET_PLAYING;
+            publish_snapshot();
+            return true;
+        }
+
+        netStatus = session.get_status();
+        if (netStatus == NET_MISMATCH)
+        {
+            log("The other player's game runs different rules, can't play it", LOG_ERROR);
+            return false;
         }
+
+        //keep up with the keys so the queue never fills while waiting
+        stepEnd = now;
+        take_inputs(false);
+        std::this_thread::sleep_for(std::chrono::milliseconds(NET_CONNECT_POLL_MS));
+    }
+    return false;
+}
+
+//One physics step, with inputs from the keyboard, the AI or the replay
+void Game::step()
+{
+    if (networked)
+    {
+        step_networked();
+        publish_snapshot();
+        return;
     }
-    else if (justStarted)
-        reset_start();
-    delta.start();
+
+    if (replaying)
+    {
+        //the keys don't drive a replay, keep the queue empty without measuring them
+        take_inputs(false);
+
+        //hold the last frame once the replay runs out
+        if (!replay.next(&leftInput, &rightInput))
+        {
+            replaying = false;
+            replay.close();
+            paused = true;
+            return;
+        }
+    }
+    else
+    {
+        take_inputs(true);
+        if (aiLeft)
+            leftInput = leftAI.think(&match);
+        if (aiRight)
+            rightInput = rightAI.think(&match);
+        recorder.record(leftInput, rightInput);
+    }
+
+    match_step(&match, leftInput, rightInput);
+    publish_snapshot();
+}
+
+//This side's keys (or AI) go into the session, which steps the match at
+//once and rolls it back whenever the other side's keys come in different
+//from its guess. Only steps both sides' keys are known for are recorded.
+void Game::step_networked()
+{
+    take_inputs(true);
+
+    int side = session.get_side();
+    int input = side == SIDE_LEFT ? leftInput : rightInput;
+    if (side == SIDE_LEFT && aiLeft)
+        input = leftAI.think(&match);
+    else if (side == SIDE_RIGHT && aiRight)
+        input = rightAI.think(&match);
+
+    session.advance(input, steady_micros(std::chrono::steady_clock::now()));
+    if (session.get_status() != netStatus)
+    {
+        netStatus = session.get_status();
+        if (netStatus == NET_LOST)
+            log("Lost the connection to the other player", LOG_WARNING);
+    }
+
+    int left, right;
+    while (session.next_confirmed(&left, &right))
+        recorder.record(left, right);
+}
+
+//Apply the key changes that arrived before the end of this step. The paddle
+//moves with the old keys up to the point in the step the last change came
+//in and the new ones after it; anything older than the step starts it.
+//Without measure (paused, or no step to take them) they aren't counted as
+//input latency, nothing will show them until the simulation goes on.
+void Game::take_inputs(bool measure)
+{
+    const long long stepMicros = 1000000 / SIM_HZ;
+    long long stepStart = stepEnd - stepMicros;
+    int leftPhase = 0, rightPhase = 0;
+
+    InputEvent *input;
+    while ((input = inputs.peek()) != NULL && input->time < stepEnd)
+    {
+        int phase = 0;
+        if (input->time > stepStart)
+            phase = int((input->time - stepStart) * INPUT_PHASES / stepMicros);
+        if (input->leftKeys != stepLeftKeys)
+            leftPhase = phase;
+        if (input->rightKeys != stepRightKeys)
+            rightPhase = phase;
+        stepLeftKeys = input->leftKeys;
+        stepRightKeys = input->rightKeys;
+        inputs.pop();
+        appliedInputs++;
+    }
+
+    if (!measure)
+        skippedInputs = appliedInputs;
+
+    leftInput = input_with_phase(stepLeftKeys, leftPhase);
+    rightInput = input_with_phase(stepRightKeys, rightPhase);
+}
+
+//Copy what the renderer needs into the triple buffer
+void Game::publish_snapshot()
+{
+    MatchSnapshot *snapshot = snapshots.write_slot();
+
+    snapshot->match = match;
+    snapshot->match.swarm = NULL;
+    snapshot->swarmCount = 0;
+    if (match.swarm != NULL && !match.justStarted)
+    {
+        snapshot->swarmCount = swarm.get_count();
+        for (int i = 0; i < snapshot->swarmCount; i++)
+            snapshot->swarmBalls[i] = swarm.get_ball(i);
+    }
+    snapshot->stepTime = steady_micros(std::chrono::steady_clock::now());
+    snapshot->appliedInputs = appliedInputs;
+    snapshot->skippedInputs = skippedInputs;
+
+    snapshots.publish();
 }
 
 void Game::render()
 {
+    snapshots.update();
+    view = snapshots.read_slot();
+    MatchState &state = view->match;
+
+    //draw between the snapshot's step and the next one, due SIM_DT later
+    long long now = steady_micros(std::chrono::steady_clock::now());
+    double alpha = paused ? 1.0 : (now - view->stepTime) / (SIM_DT * 1e6);
+    if (alpha > 1)
+        alpha = 1;
+    Rect leftPos = state.leftPaddle.get_interpolated(alpha);
+    Rect rightPos = state.rightPaddle.get_interpolated(alpha);
+    Rect ballPos = state.theBall.get_interpolated(alpha);
+
+    SDL_Rect oldLeft = leftRect;
+    SDL_Rect oldRight = rightRect;
+    SDL_Rect oldBall = ballRect;
+    SDL_Rect oldLeftScore = leftScoreRect;
+    SDL_Rect oldRightScore = rightScoreRect;
+    bool oldBallShown = ballShown;
+
+    leftRect = to_sdl_rect(&leftPos);
+    rightRect = to_sdl_rect(&rightPos);
+    ballRect = to_sdl_rect(&ballPos);
+    ballShown = ball_visible();
+    update_scores(state.leftScore, state.rightScore);
+    if (networked)
+        update_net_text();
+
+    int phase = get_phase();
+
+    //the swarm moves all over the screen, cheaper to just redraw it all
+    if (!dirtyRendering || !drawn || phase != lastPhase || view->swarmCount > 0)
+    {
+        draw_scene();
+        mark_all_dirty();
+    }
+    else
+    {
+        //erase and redraw only what moved
+        if (!same_rect(&oldLeft, &leftRect))
+            redraw_region(union_rect(oldLeft, leftRect));
+        if (!same_rect(&oldRight, &rightRect))
+            redraw_region(union_rect(oldRight, rightRect));
+        if (ballShown != oldBallShown || (ballShown && !same_rect(&oldBall, &ballRect)))
+            redraw_region(union_rect(oldBall, ballRect));
+        if (scoresChanged)
+        {
+            redraw_region(union_rect(oldLeftScore, leftScoreRect));
+            redraw_region(union_rect(oldRightScore, rightScoreRect));
+        }
+    }
+
+    drawn = true;
+    lastPhase = phase;
+}
+
+//Redraw the scene clipped to one area and queue it for SDL_UpdateRects
+void Game::redraw_region(SDL_Rect region)
+{
+    if (region.w == 0 || region.h == 0)
+        return;
+
+    SDL_SetClipRect(screen, &region);
+    draw_scene();
+    SDL_SetClipRect(screen, NULL);
+
+    mark_dirty(&region);
+}
+
+//Redraw a corner of the left paddle on its own - false if that changed
+//any rect drawn, which would leave trails behind on the next dirty frame
+bool Game::check_clipped_redraw()
+{
+    SDL_Rect oldDivider = divider;
+    SDL_Rect oldLeft = leftRect, oldRight = rightRect, oldBall = ballRect;
+
+    SDL_Rect corner = {leftRect.x, leftRect.y, Uint16(leftRect.w / 2), Uint16(leftRect.h / 2)};
+    redraw_region(corner);
+
+    return same_rect(&divider, &oldDivider) && same_rect(&leftRect, &oldLeft)
+        && same_rect(&rightRect, &oldRight) && same_rect(&ballRect, &oldBall);
+}
+
+void Game::draw_scene()
+{
+    MatchState &state = view->match;
+
+    Uint32 white = SDL_MapRGB(screen->format, 0xFF, 0xFF, 0xFF);
+
+    //SDL_FillRect clips the rect it is given to the clip rect in place, so
+    //it only ever gets copies - the real ones must outlive a clipped redraw
+    SDL_Rect fill = divider;
     SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 0x00, 0x00, 0x00));
-    SDL_FillRect(screen, &divider, SDL_MapRGB(screen->format, 0xFF, 0xFF, 0xFF));
+    SDL_FillRect(screen, &fill, white);
 
-    leftPaddle.show();
-    rightPaddle.show();
+    fill = leftRect;
+    SDL_FillRect(screen, &fill, white);
+    fill = rightRect;
+    SDL_FillRect(screen, &fill, white);
 
-    update_scores(leftScore, rightScore);
+    leftText.draw(leftScoreRect.x, leftScoreRect.y, screen);
+    rightText.draw(rightScoreRect.x, rightScoreRect.y, screen);
 
-    if (justStarted)
+    if (ballShown)
     {
-        SDL_Surface* startMessage;
-        std::stringstream startMess;
-        startMess << "First to " << SCORE_LIMIT;
-        startMessage = TTF_RenderText_Blended(fontPause, startMess.str().c_str(), textColor);
-        apply_surface((SCREEN_WIDTH - startMessage->w)/2, 100, startMessage, screen);
-        SDL_FreeSurface(startMessage);
+        fill = ballRect;
+        SDL_FillRect(screen, &fill, white);
+    }
+
+    for (int i = 0; i < view->swarmCount; i++)
+    {
+        SDL_Rect ball = to_sdl_rect(&view->swarmBalls[i]);
+        SDL_FillRect(screen, &ball, white);
+    }
+
+    if (networked && netStatus != NET_PLAYING)
+        netText.draw((SCREEN_WIDTH - netText.get_width())/2, (SCREEN_HEIGHT - netText.get_height())/2, screen);
+
+    if (state.justStarted)
+    {
+        startText.draw((SCREEN_WIDTH - startText.get_width())/2, 100, screen);
         if (paused)
             show_pause();
-        delta.start();
     }
-    else if (!endGame)
+    else if (!state.endGame)
     {
-        if (!paused)
-        {
-            if (theBall.is_delayed())
-            {
-                if (theBall.delayed_ticks() > 2000)
-                {
-                    theBall.stop_delay();
-                }
-                else if (theBall.delayed_ticks() < 500 || (theBall.delayed_ticks() > 1000 && theBall.delayed_ticks() < 1500) )
-                    theBall.show();
-            }
-            else if (theBall.is_scored())
-            {
-                //log("scored");
-                if (theBall.scored_ticks() > 400)
-                    theBall.reset();
-                else
-                    theBall.show();
-            }
-            else
-                theBall.show();
-        }
-        else
-        {
-            theBall.show();
+        if (paused)
             show_pause();
-        }
     }
     else
     {
-        theBall.show();
-        SDL_Surface *endMessage;
-        if (leftScore >= SCORE_LIMIT)
+        if (state.leftScore >= state.scoreLimit)
         {
-            endMessage = TTF_RenderText_Blended(fontPause, "Player 1 wins!", textColor);
-            apply_surface((SCREEN_WIDTH/2 - endMessage->w)/2, 400, endMessage, screen);
+            endText.set("Player 1 wins!");
+            endText.draw((SCREEN_WIDTH/2 - endText.get_width())/2, 400, screen);
         }
         else
         {
-            endMessage = TTF_RenderText_Blended(fontPause, "Player 2 wins!", textColor);
-            apply_surface((SCREEN_WIDTH*3/2 - endMessage->w)/2, 400, endMessage, screen);
+            endText.set("Player 2 wins!");
+            endText.draw((SCREEN_WIDTH*3/2 - endText.get_width())/2, 400, screen);
         }
-        if (SDL_Flip(screen) == -1)
-            return;
-        SDL_FreeSurface(endMessage);
     }
 }
 
-void Game::show_pause()
+bool Game::ball_visible()
 {
-    SDL_Surface *pauseMessage;
-    pauseMessage = TTF_RenderText_Blended(fontPause, "Press P to resume.", textColor);
+    //no blinking while paused
+    if (paused && !view->match.justStarted)
+        return true;
 
-    apply_surface((screen->w - pauseMessage->w)/2, (screen->h - pauseMessage->h)/2, pauseMessage, screen);
-    if (SDL_Flip(screen) == -1)
-        return;
-    SDL_FreeSurface(pauseMessage);
+    return match_ball_shown(&view->match);
 }
 
-void Game::update_scores(int leftScore, int rightScore)
-{
-    std::stringstream stream;
-    std::string leftSc, rightSc;
-
-    stream << leftScore << " " << rightScore;
-    stream >> leftSc;
-    stream >> rightSc;
-    stream.flush();
-
-    //handle error?
-    left = TTF_RenderText_Blended(font, leftSc.c_str(), textColor);
-    right = TTF_RenderText_Blended(font, rightSc.c_str(), textColor);
-
-    apply_surface(LEFT_SCORE_X-left->w/2, LEFT_SCORE_Y-left->h/2, left, screen);
-    apply_surface(RIGHT_SCORE_X-right->w/2, RIGHT_SCORE_Y-right->h/2, right, screen);
-
-    SDL_FreeSurface(left);
-    SDL_FreeSurface(right);
+//Anything that changes the overlay text needs a full redraw
+int Game::get_phase()
+{
+    if (networked && netStatus == NET_CONNECTING)
+        return PHASE_CONNECTING;
+    else if (networked && netStatus != NET_PLAYING)
+        return PHASE_DISCONNECTED;
+    else if (view->match.justStarted)
+        return paused ? PHASE_START_PAUSED : PHASE_START;
+    else if (view->match.endGame)
+        return PHASE_END;
+    else if (paused)
+        return PHASE_PAUSED;
+
+    return PHASE_PLAYING;
 }
 
-int Game::start_ticks()
+void Game::show_pause()
 {
-    return (SDL_GetTicks() - startedTick);
+    pauseText.draw((screen->w - pauseText.get_width())/2, (screen->h - pauseText.get_height())/2, screen);
 }
 
-void Game::reset_start()
+//Input latency - every key change the simulation had applied by the step
+//just shown has now made it to the screen. Those taken while paused or
+//connecting waited on the player, not the game, and are passed over.
+void Game::presented()
 {
-    startedTick = SDL_GetTicks();
+    long long now = steady_micros(std::chrono::steady_clock::now());
+    if ((int)(view->skippedInputs - measuredInputs) > 0)
+        measuredInputs = view->skippedInputs;
+    for (; measuredInputs != view->appliedInputs; measuredInputs++)
+        profiler.record_input_latency((now - inputTimes[measuredInputs % INPUT_QUEUE_SIZE]) * 1000);
 }
 
-Help::Help()
+void Game::update_scores(int leftScore, int rightScore)
 {
-    player1 = TTF_RenderText_Blended(fontPause, "Player 1:", textColor);
-    player1Instructions = TTF_RenderText_Blended(fontPause, "Up: A, Down: Z", textColor);
-    player2 = TTF_RenderText_Blended(fontPause, "Player 2:", textColor);
-    player2Instructions = TTF_RenderText_Blended(fontPause, "Up: Up, Down: Down", textColor);
-    pause = TTF_RenderText_Blended(fontPause, "Pause: P", textColor);
-    escape = TTF_RenderText_Blended(fontPause, "Exit: Escape", textColor);
+    char score[CACHED_TEXT_LENGTH];
+
+    //only re-compose a score when it changes
+    scoresChanged = false;
+    if (leftScore != leftShown)
+    {
+        sprintf(score, "%d", leftScore);
+        leftText.set(score);
+        leftShown = leftScore;
+        scoresChanged = true;
+    }
+    if (rightScore != rightShown)
+    {
+        sprintf(score, "%d", rightScore);
+        rightText.set(score);
+        rightShown = rightScore;
+        scoresChanged = true;
+    }
+
+    leftScoreRect.x = LEFT_SCORE_X-leftText.get_width()/2;
+    leftScoreRect.y = LEFT_SCORE_Y-leftText.get_height()/2;
+    leftScoreRect.w = leftText.get_width();
+    leftScoreRect.h = leftText.get_height();
+
+    rightScoreRect.x = RIGHT_SCORE_X-rightText.get_width()/2;
+    rightScoreRect.y = RIGHT_SCORE_Y-rightText.get_height()/2;
+    rightScoreRect.w = rightText.get_width();
+    rightScoreRect.h = rightText.get_height();
 }
 
-Help::~Help()
+//What the connection is up to, when it isn't just playing
+void Game::update_net_text()
 {
-    SDL_FreeSurface(player1);
-    SDL_FreeSurface(player1Instructions);
-    SDL_FreeSurface(player2);
-    SDL_FreeSurface(player2Instructions);
-    SDL_FreeSurface(pause);
-    SDL_FreeSurface(escape);
+    int status = netStatus;
+    if (status == netShown)
+        return;
+
+    netShown = status;
+    if (status == NET_CONNECTING)
+        netText.set(netHosting ? "Waiting for player 2..." : "Connecting...");
+    else if (status == NET_LOST)
+        netText.set("Connection lost.");
+    else if (status == NET_MISMATCH)
+        netText.set("Different game version.");
 }
 
 void Help::handle_events()
 {
     while (SDL_PollEvent(&event))
     {
+        check_hotkeys();
         switch (event.type)
         {
             case SDL_QUIT:
@@ -921,34 +1118,21 @@ void Help::logic()
 
 void Help::render()
 {
+    mark_all_dirty();
     SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 0x00, 0x00, 0x00));
-    apply_surface(30, 30, player1, screen);
-    apply_surface(50, 70, player1Instructions, screen);
-    apply_surface(30, 110, player2, screen);
-    apply_surface(50, 150, player2Instructions, screen);
-    apply_surface(30, 230, pause, screen);
-    apply_surface(30, 310, escape, screen);
-}
-
-Credits::Credits()
-{
-    cred = TTF_RenderText_Blended(fontPause, "Created with SDL 1.2.15 and SDL_ttf.", textColor);
-    fontCred = TTF_RenderText_Blended(fontPause, "Font: Eurostile.", textColor);
-    SDL_Color nameColor = {0x11, 0x11, 0x11};
-    nameCred = TTF_RenderText_Blended(fontPause, "Made by Yao Chong", nameColor);
-}
-
-Credits::~Credits()
-{
-    SDL_FreeSurface(cred);
-    SDL_FreeSurface(fontCred);
-    SDL_FreeSurface(nameCred);
+    pauseGlyphs.draw(30, 30, "Player 1:", screen);
+    pauseGlyphs.draw(50, 70, "Up: A, Down: Z", screen);
+    pauseGlyphs.draw(30, 110, "Player 2:", screen);
+    pauseGlyphs.draw(50, 150, "Up: Up, Down: Down", screen);
+    pauseGlyphs.draw(30, 230, "Pause: P", screen);
+    pauseGlyphs.draw(30, 310, "Exit: Escape", screen);
 }
 
 void Credits::handle_events()
 {
     while (SDL_PollEvent(&event))
     {
+        check_hotkeys();
         switch (event.type)
         {
             case SDL_QUIT:
@@ -968,8 +1152,13 @@ void Credits::logic()
 
 void Credits::render()
 {
+    mark_all_dirty();
     SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 0x00, 0x00, 0x00));
-    apply_surface((SCREEN_WIDTH - cred->w)/2, (SCREEN_HEIGHT - cred->h)/2 - 40, cred, screen);
-    apply_surface((SCREEN_WIDTH - fontCred->w)/2, (SCREEN_HEIGHT - fontCred->h)/2 + 40, fontCred, screen);
-    apply_surface((SCREEN_WIDTH*3/2 - nameCred->w)/2, SCREEN_HEIGHT - 80, nameCred, screen);
+    const char *cred = "Created with SDL 1.2.15 and SDL_ttf.";
+    const char *fontCred = "Font: Eurostile.";
+    const char *nameCred = "Made by Yao Chong";
+    int lineHeight = pauseGlyphs.get_height();
+    pauseGlyphs.draw((SCREEN_WIDTH - pauseGlyphs.text_width(cred))/2, (SCREEN_HEIGHT - lineHeight)/2 - 40, cred, screen);
+    pauseGlyphs.draw((SCREEN_WIDTH - pauseGlyphs.text_width(fontCred))/2, (SCREEN_HEIGHT - lineHeight)/2 + 40, fontCred, screen);
+    creditGlyphs.draw((SCREEN_WIDTH*3/2 - creditGlyphs.text_width(nameCred))/2, SCREEN_HEIGHT - 80, nameCred, screen);
 }
@@ -0,0 +1,260 @@
+#ifndef PONG_H
+#define PONG_H
+
+#include "SDL/SDL.h"
+#include "SDL/SDL_ttf.h"
+#include "sim.h"
+#include "text.h"
+#include "pacer.h"
+#include "profiler.h"
+#include "logger.h"
+#include "replay.h"
+#include "swarm.h"
+#include "ai.h"
+#include "snapshot.h"
+#include "netplay.h"
+#include <atomic>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <string>
+#include <cstdio>
+#include <ctime>
+#include <cstdlib>
+
+//constants
+const int SCREEN_BPP = 32;
+
+const int SCORE_FONT_SIZE = 48;
+const int PAUSE_FONT_SIZE = 24;
+
+//most rects pushed with SDL_UpdateRects before falling back to a full flip
+const int MAX_DIRTY_RECTS = 32;
+
+//most physics steps the simulation thread catches up on after a stall
+const int MAX_CATCH_UP_STEPS = SIM_HZ / 4;
+
+//how often the simulation thread looks for the other player while connecting
+const int NET_CONNECT_POLL_MS = 10;
+
+// key settings
+const SDLKey leftUp = SDLK_a;
+const SDLKey leftDown = SDLK_z;
+const SDLKey rightUp = SDLK_UP;
+const SDLKey rightDown = SDLK_DOWN;
+
+//variables
+extern SDL_Surface *screen;
+
+extern SDL_Event event;
+
+extern TTF_Font *font;
+extern TTF_Font *fontPause;
+
+extern GlyphAtlas scoreGlyphs;
+extern GlyphAtlas pauseGlyphs;
+extern GlyphAtlas creditGlyphs;
+
+extern SDL_Color textColor;
+
+//Dirty rectangles - only the parts of the screen that changed get pushed
+extern bool dirtyRendering;
+extern bool fullRedraw;
+extern SDL_Rect dirtyRects[MAX_DIRTY_RECTS];
+extern int dirtyCount;
+
+//Frame timing - dumped with F12, and on exit with -profile
+extern Profiler profiler;
+extern bool profileOnExit;
+
+//Replay to play back instead of taking keyboard input (-replay file, -fast)
+extern const char *replayFile;
+extern bool replayFast;
+extern bool recordReplays;
+
+//Extra balls for multi-ball mode (-multiball N)
+extern int multiBalls;
+
+//CPU controlled paddles (-ai left|right|both, -difficulty easy|normal|hard)
+extern bool aiLeft, aiRight;
+extern int aiDifficulty;
+
+//Versus over the network (-host [port], -join address[:port]), and the
+//shim to try it out on one machine (-netdelay ms, -netjitter ms, -netloss percent)
+extern bool netHosting;
+extern std::string netAddress;
+extern int netPort;
+extern int netDelay, netJitter, netLoss;
+
+//Game states
+enum GameStates
+{
+    STATE_NULL,
+    STATE_INTRO,
+    STATE_HELP,
+    STATE_CREDITS,
+    STATE_SETTINGS,
+    STATE_GAME,
+    STATE_EXIT,
+};
+
+//What the Game screen is showing on top of the playfield
+enum GamePhases
+{
+    PHASE_START,
+    PHASE_START_PAUSED,
+    PHASE_PLAYING,
+    PHASE_PAUSED,
+    PHASE_END,
+    PHASE_CONNECTING,
+    PHASE_DISCONNECTED,
+};
+
+//functions
+bool init();
+bool load_files();
+void clean_up();
+void apply_surface(int x, int y, SDL_Surface *source, SDL_Surface *destination, SDL_Rect *clip = NULL);
+SDL_Rect to_sdl_rect(Rect *rect);
+bool same_rect(SDL_Rect *a, SDL_Rect *b);
+SDL_Rect union_rect(SDL_Rect a, SDL_Rect b);
+void mark_dirty(SDL_Rect *rect);
+void mark_all_dirty();
+bool present();
+void check_hotkeys();
+void dump_profile();
+void update_input(int *input, SDLKey up, SDLKey down);
+
+bool show_start();
+
+//Game state handling
+class GameState;
+void set_next_state(int newState);
+void change_state();
+GameState *get_state(int id);
+void free_states();
+
+//GameState class - built once, then kept resident and switched between
+//with exit() on the old state and enter() on the new one
+class GameState
+{
+    public:
+        virtual void enter() {}
+        virtual void exit() {}
+        virtual void handle_events() = 0;
+        virtual void logic() = 0;
+        virtual void render() = 0;
+        //static screens only change on input, so the main loop can sleep until some arrives
+        virtual bool is_static() { return false; }
+        //called once the frame drawn by render() is on screen
+        virtual void presented() {}
+        virtual ~GameState(){};
+};
+
+extern int stateID;
+extern int nextState;
+
+extern GameState *currentState;
+
+//Game states
+//-------------------------------------------------
+class Intro : public GameState
+{
+    public:
+        void handle_events();
+        void logic();
+        void render();
+        bool is_static() { return true; }
+};
+
+class Game : public GameState
+{
+    private:
+        SDL_Rect divider;
+        //owned by the simulation thread once it starts
+        MatchState match;
+        int leftInput, rightInput;
+        ReplayWriter recorder;
+        ReplayReader replay;
+        bool replaying;
+        BallSwarm swarm;
+        PaddleAI leftAI, rightAI;
+        RollbackSession session;
+        int stepLeftKeys, stepRightKeys;
+        long long stepEnd; //steady clock microseconds the step being taken covers up to
+        unsigned int appliedInputs;
+        unsigned int skippedInputs;
+
+        //shared between the threads
+        TripleBuffer<MatchSnapshot> snapshots;
+        InputQueue inputs;
+        std::atomic<bool> paused;
+        std::atomic<bool> running;
+        std::atomic<int> netStatus;
+        std::thread simulation;
+        bool networked;
+
+        //owned by the main thread
+        MatchSnapshot *view;
+        int leftKeys, rightKeys;
+        unsigned int pushedInputs, measuredInputs;
+        long long inputTimes[INPUT_QUEUE_SIZE]; //arrival of each pushed input, by sequence number
+        int leftShown, rightShown;
+        bool scoresChanged;
+        CachedText leftText, rightText;
+        CachedText startText, pauseText, endText, netText;
+        int netShown;
+        //what was drawn last frame, for dirty rects
+        bool drawn;
+        int lastPhase;
+        bool ballShown;
+        SDL_Rect leftRect, rightRect, ballRect;
+        SDL_Rect leftScoreRect, rightScoreRect;
+    public:
+        Game();
+        ~Game();
+        void enter();
+        void exit();
+        void stop_simulation();
+        void handle_events();
+        void logic();
+        void render();
+        void presented();
+        void update_scores(int leftScore, int rightScore);
+        void update_net_text();
+        void show_pause();
+        void record_match(unsigned int seed, int balls);
+        bool wait_for_peer();
+        void step();
+        void step_networked();
+        void take_inputs(bool measure);
+        void simulate();
+        void publish_snapshot();
+        void draw_scene();
+        void redraw_region(SDL_Rect region);
+        bool check_clipped_redraw();
+        bool ball_visible();
+        int get_phase();
+};
+
+class Help : public GameState
+{
+    public:
+        void handle_events();
+        void logic();
+        void render();
+        bool is_static() { return true; }
+};
+
+class Credits : public GameState
+{
+    public:
+        void handle_events();
+        void logic();
+        void render();
+        bool is_static() { return true; }
+};
+
+//-------------------------------------------------
+
+#endif
@@ -0,0 +1,309 @@
+#include "pongenv.h"
+#include "sim.h"
+#include "ai.h"
+#include "raster.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//cut a match short after this long (one hour of game time)
+const int MAX_EPISODE_STEPS = 60 * 60 * SIM_HZ;
+
+//jobs the thread pool runs over its slice of matches
+enum EnvJobs
+{
+    JOB_RESET,
+    JOB_STEP,
+    JOB_RENDER,
+};
+
+//One environment - a match, its opponent, and how to reseed it when it ends
+struct TrainingMatch
+{
+    MatchState match;
+    PaddleAI opponent;
+    unsigned int seed;
+    int steps;
+};
+
+struct PongVecEnv
+{
+    int count;
+    int difficulty;
+    TrainingMatch *matches;
+
+    float *observations;
+    float *rewards;
+    unsigned char *dones;
+    std::vector<float> ownObservations, ownRewards;
+    std::vector<unsigned char> ownDones;
+
+    //the batch being worked on
+    int job;
+    const int *actions;
+    const unsigned int *seeds;
+    Rasterizer raster;
+    unsigned char *pixels;
+
+    //thread pool - the caller's thread runs slice 0, workers the rest
+    int threadCount;
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable wake, finished;
+    unsigned long long generation;
+    int pending;
+    bool quitting;
+};
+
+void restart_match(TrainingMatch *training, unsigned int seed, int difficulty)
+{
+    training->seed = seed;
+    training->steps = 0;
+    match_init(&training->match, seed);
+    training->opponent.init(SIDE_RIGHT, difficulty, seed);
+}
+
+void observe(TrainingMatch *training, float *obs)
+{
+    MatchState *match = &training->match;
+    Rect *ball = match->theBall.get_position();
+    double vx, vy;
+    match->theBall.get_velocity(&vx, &vy);
+    bool inPlay = !match->justStarted && !match->theBall.is_delayed() && !match->theBall.is_scored();
+
+    obs[PONG_OBS_BALL_X] = float(ball->x) / SCREEN_WIDTH;
+    obs[PONG_OBS_BALL_Y] = float(ball->y) / SCREEN_HEIGHT;
+    obs[PONG_OBS_BALL_VX] = inPlay ? float(vx) / PONG_VELOCITY_SCALE : 0.0f;
+    obs[PONG_OBS_BALL_VY] = inPlay ? float(vy) / PONG_VELOCITY_SCALE : 0.0f;
+    obs[PONG_OBS_PADDLE_Y] = float(match->leftPaddle.get_position()->y) / SCREEN_HEIGHT;
+    obs[PONG_OBS_OPPONENT_Y] = float(match->rightPaddle.get_position()->y) / SCREEN_HEIGHT;
+    obs[PONG_OBS_BALL_IN_PLAY] = inPlay ? 1.0f : 0.0f;
+    obs[PONG_OBS_SCORE_DIFFERENCE] = float(match->leftScore - match->rightScore) / match->scoreLimit;
+}
+
+void step_match(PongVecEnv *env, int i)
+{
+    TrainingMatch *training = &env->matches[i];
+    MatchState *match = &training->match;
+
+    int opponentInput = training->opponent.think(match);
+    int result = match_step(match, env->actions[i] & (INPUT_UP | INPUT_DOWN), opponentInput);
+    training->steps++;
+
+    float reward = 0;
+    if (result == MOVE_LEFT_SCORED)
+        reward = 1;
+    else if (result == MOVE_RIGHT_SCORED)
+        reward = -1;
+
+    bool done = match->endGame || training->steps >= MAX_EPISODE_STEPS;
+    if (done)
+        restart_match(training, (unsigned int)split_mix(training->seed), env->difficulty);
+
+    env->rewards[i] = reward;
+    env->dones[i] = done ? 1 : 0;
+    observe(training, env->observations + i * PONG_OBSERVATION_SIZE);
+}
+
+void run_slice(PongVecEnv *env, int slice)
+{
+    int first = (int)((long long)env->count * slice / env->threadCount);
+    int end = (int)((long long)env->count * (slice + 1) / env->threadCount);
+
+    for (int i = first; i < end; i++)
+    {
+        if (env->job == JOB_STEP)
+            step_match(env, i);
+        else if (env->job == JOB_RENDER)
+            env->raster.render(&env->matches[i].match, env->pixels + (size_t)i * env->raster.get_frame_size());
+        else
+        {
+            restart_match(&env->matches[i], env->seeds != NULL ? env->seeds[i] : i, env->difficulty);
+            env->rewards[i] = 0;
+            env->dones[i] = 0;
+            observe(&env->matches[i], env->observations + i * PONG_OBSERVATION_SIZE);
+        }
+    }
+}
+
+void worker_loop(PongVecEnv *env, int slice)
+{
+    unsigned long long seen = 0;
+
+    for (;;)
+    {
+        std::unique_lock<std::mutex> guard(env->lock);
+        while (!env->quitting && env->generation == seen)
+            env->wake.wait(guard);
+        if (env->quitting)
+            return;
+        seen = env->generation;
+        guard.unlock();
+
+        run_slice(env, slice);
+
+        guard.lock();
+        if (--env->pending == 0)
+            env->finished.notify_one();
+    }
+}
+
+//Run a job over every match, split across the pool
+void run_batch(PongVecEnv *env, int job)
+{
+    env->job = job;
+    if (env->threadCount == 1)
+    {
+        run_slice(env, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(env->lock);
+        env->pending = env->threadCount - 1;
+        env->generation++;
+    }
+    env->wake.notify_all();
+
+    run_slice(env, 0);
+
+    std::unique_lock<std::mutex> guard(env->lock);
+    while (env->pending > 0)
+        env->finished.wait(guard);
+}
+
+PongVecEnv *pong_env_create(int count, int threads, int difficulty)
+{
+    if (count <= 0)
+        return NULL;
+    if (threads <= 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads <= 0)
+        threads = 1;
+    if (threads > count)
+        threads = count;
+
+    PongVecEnv *env = new PongVecEnv;
+    env->count = count;
+    env->difficulty = difficulty;
+    env->matches = new TrainingMatch[count];
+
+    env->ownObservations.resize(count * PONG_OBSERVATION_SIZE);
+    env->ownRewards.resize(count);
+    env->ownDones.resize(count);
+    env->observations = &env->ownObservations[0];
+    env->rewards = &env->ownRewards[0];
+    env->dones = &env->ownDones[0];
+
+    env->job = JOB_RESET;
+    env->actions = NULL;
+    env->seeds = NULL;
+    env->pixels = NULL;
+    env->threadCount = threads;
+    env->generation = 0;
+    env->pending = 0;
+    env->quitting = false;
+
+    for (int i = 1; i < threads; i++)
+        env->workers.push_back(std::thread(worker_loop, env, i));
+
+    pong_env_reset(env, NULL);
+    return env;
+}
+
+void pong_env_destroy(PongVecEnv *env)
+{
+    if (env == NULL)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(env->lock);
+        env->quitting = true;
+    }
+    env->wake.notify_all();
+    for (size_t i = 0; i < env->workers.size(); i++)
+        env->workers[i].join();
+
+    delete[] env->matches;
+    delete env;
+}
+
+int pong_env_count(PongVecEnv *env)
+{
+    return env->count;
+}
+
+int pong_env_observation_size(void)
+{
+    return PONG_OBSERVATION_SIZE;
+}
+
+void pong_env_set_buffers(PongVecEnv *env, float *observations, float *rewards, unsigned char *dones)
+{
+    env->observations = observations != NULL ? observations : &env->ownObservations[0];
+    env->rewards = rewards != NULL ? rewards : &env->ownRewards[0];
+    env->dones = dones != NULL ? dones : &env->ownDones[0];
+
+    //the new buffer should start out describing the current matches too
+    for (int i = 0; i < env->count; i++)
+        observe(&env->matches[i], env->observations + i * PONG_OBSERVATION_SIZE);
+}
+
+float *pong_env_observations(PongVecEnv *env)
+{
+    return env->observations;
+}
+
+float *pong_env_rewards(PongVecEnv *env)
+{
+    return env->rewards;
+}
+
+unsigned char *pong_env_dones(PongVecEnv *env)
+{
+    return env->dones;
+}
+
+void pong_env_reset(PongVecEnv *env, const unsigned int *seeds)
+{
+    env->seeds = seeds;
+    run_batch(env, JOB_RESET);
+    env->seeds = NULL;
+}
+
+int pong_env_frame_width(int scale)
+{
+    Rasterizer raster;
+    raster.init(scale, RASTER_GRAY8);
+    return raster.get_width();
+}
+
+int pong_env_frame_height(int scale)
+{
+    Rasterizer raster;
+    raster.init(scale, RASTER_GRAY8);
+    return raster.get_height();
+}
+
+int pong_env_frame_size(int scale, int format)
+{
+    Rasterizer raster;
+    raster.init(scale, format);
+    return raster.get_frame_size();
+}
+
+void pong_env_render(PongVecEnv *env, int scale, int format, unsigned char *pixels)
+{
+    env->raster.init(scale, format);
+    env->pixels = pixels;
+    run_batch(env, JOB_RENDER);
+    env->pixels = NULL;
+}
+
+void pong_env_step(PongVecEnv *env, const int *actions)
+{
+    env->actions = actions;
+    run_batch(env, JOB_STEP);
+    env->actions = NULL;
+}
@@ -0,0 +1,96 @@
+#ifndef PONGENV_H
+#define PONGENV_H
+
+/*Vectorised training environment - N independent matches stepped together,
+  with the agent on the left paddle and the CPU opponent (ai.h) on the right.
+  Plain C so it can be loaded from any language as a shared library.
+
+  Every call works on whole batches: observations are count *
+  PONG_OBSERVATION_SIZE floats, rewards count floats and dones count bytes,
+  all contiguous. They live in the environment unless the caller hands in
+  its own memory with pong_env_set_buffers, in which case results are
+  written straight into it. A finished match is restarted inside
+  pong_env_step, so its observation is already the first of the next
+  match when done is set.*/
+
+#ifdef _WIN32
+#ifdef PONG_ENV_BUILD
+#define PONG_ENV_API __declspec(dllexport)
+#else
+#define PONG_ENV_API __declspec(dllimport)
+#endif
+#else
+#define PONG_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*actions, the same values as the game's paddle inputs*/
+enum PongActions
+{
+    PONG_ACTION_NONE = 0,
+    PONG_ACTION_UP = 1,
+    PONG_ACTION_DOWN = 2
+};
+
+/*layout of one observation, positions scaled to 0..1 of the screen and
+  velocities to PONG_VELOCITY_SCALE pixels per second*/
+enum PongObservations
+{
+    PONG_OBS_BALL_X,
+    PONG_OBS_BALL_Y,
+    PONG_OBS_BALL_VX,
+    PONG_OBS_BALL_VY,
+    PONG_OBS_PADDLE_Y,
+    PONG_OBS_OPPONENT_Y,
+    PONG_OBS_BALL_IN_PLAY,
+    PONG_OBS_SCORE_DIFFERENCE,
+    PONG_OBSERVATION_SIZE
+};
+
+#define PONG_VELOCITY_SCALE 1000.0f
+
+/*pixel observations, the same values as RasterFormats*/
+enum PongPixelFormats
+{
+    PONG_PIXELS_GRAY8,
+    PONG_PIXELS_ARGB32
+};
+
+typedef struct PongVecEnv PongVecEnv;
+
+/*threads <= 0 uses one per core, difficulty is one of AIDifficulties (0 easy .. 2 hard)*/
+PONG_ENV_API PongVecEnv *pong_env_create(int count, int threads, int difficulty);
+PONG_ENV_API void pong_env_destroy(PongVecEnv *env);
+
+PONG_ENV_API int pong_env_count(PongVecEnv *env);
+PONG_ENV_API int pong_env_observation_size(void);
+
+/*caller owned buffers, any of them NULL keeps the environment's own*/
+PONG_ENV_API void pong_env_set_buffers(PongVecEnv *env, float *observations, float *rewards, unsigned char *dones);
+PONG_ENV_API float *pong_env_observations(PongVecEnv *env);
+PONG_ENV_API float *pong_env_rewards(PongVecEnv *env);
+PONG_ENV_API unsigned char *pong_env_dones(PongVecEnv *env);
+
+/*start every match over, seeds holds count seeds (NULL for 0, 1, 2, ...)*/
+PONG_ENV_API void pong_env_reset(PongVecEnv *env, const unsigned int *seeds);
+
+/*pixel observations - every match drawn into frames of
+  pong_env_frame_size(scale, format) bytes, one after another, the screen
+  shrunk scale times (pong_env_frame_width/height pixels)*/
+PONG_ENV_API int pong_env_frame_width(int scale);
+PONG_ENV_API int pong_env_frame_height(int scale);
+PONG_ENV_API int pong_env_frame_size(int scale, int format);
+PONG_ENV_API void pong_env_render(PongVecEnv *env, int scale, int format, unsigned char *pixels);
+
+/*one physics step of every match, actions holds count PongActions; reward
+  is +1 when the agent scores and -1 when the opponent does*/
+PONG_ENV_API void pong_env_step(PongVecEnv *env, const int *actions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,208 @@
+#include "profiler.h"
+#include <fstream>
+#include <iomanip>
+
+const char *PROFILE_PHASE_NAMES[PROFILE_PHASE_COUNT] =
+{
+    "handle_events",
+    "logic",
+    "change_state",
+    "render",
+    "present",
+    "frame",
+};
+
+int highest_bit(long long value)
+{
+    int bit = -1;
+    while (value != 0)
+    {
+        value >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+int bucket_index(long long value)
+{
+    if (value < HISTOGRAM_SUB_BUCKETS)
+        return int(value);
+
+    int shift = highest_bit(value) - (HISTOGRAM_SUB_BITS - 1);
+    int index = HISTOGRAM_SUB_BUCKETS + (shift - 1) * HISTOGRAM_HALF_BUCKETS + int(value >> shift) - HISTOGRAM_HALF_BUCKETS;
+
+    if (index >= HISTOGRAM_BUCKETS)
+        index = HISTOGRAM_BUCKETS - 1;
+    return index;
+}
+
+//Largest value that lands in a bucket
+long long bucket_value(int index)
+{
+    if (index < HISTOGRAM_SUB_BUCKETS)
+        return index;
+
+    int shift = (index - HISTOGRAM_SUB_BUCKETS) / HISTOGRAM_HALF_BUCKETS + 1;
+    long long sub = (index - HISTOGRAM_SUB_BUCKETS) % HISTOGRAM_HALF_BUCKETS + HISTOGRAM_HALF_BUCKETS;
+    return ((sub + 1) << shift) - 1;
+}
+
+Histogram::Histogram()
+{
+    clear();
+}
+
+void Histogram::clear()
+{
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+        counts[i] = 0;
+    total = 0;
+    maxValue = 0;
+}
+
+void Histogram::record(long long value)
+{
+    if (value < 0)
+        value = 0;
+
+    counts[bucket_index(value)]++;
+    total++;
+    if (value > maxValue)
+        maxValue = value;
+}
+
+long long Histogram::get_total()
+{
+    return total;
+}
+
+long long Histogram::get_max()
+{
+    return maxValue;
+}
+
+long long Histogram::percentile(double percent)
+{
+    if (total == 0)
+        return 0;
+
+    long long wanted = (long long)(total * percent / 100.0 + 0.5);
+    if (wanted < 1)
+        wanted = 1;
+
+    long long seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        seen += counts[i];
+        if (seen >= wanted)
+            return bucket_value(i) < maxValue ? bucket_value(i) : maxValue;
+    }
+    return maxValue;
+}
+
+Profiler::Profiler()
+{
+    traceNext = 0;
+    traceCount = 0;
+    epoch = std::chrono::steady_clock::now();
+    frameStart = epoch;
+    phaseStart = epoch;
+}
+
+long long Profiler::since_epoch(std::chrono::steady_clock::time_point when)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(when - epoch).count();
+}
+
+void Profiler::add_event(int phase, std::chrono::steady_clock::time_point start, long long duration)
+{
+    phases[phase].record(duration);
+
+    trace[traceNext].start = since_epoch(start);
+    trace[traceNext].duration = duration;
+    trace[traceNext].phase = phase;
+    traceNext = (traceNext + 1) % MAX_TRACE_EVENTS;
+    if (traceCount < MAX_TRACE_EVENTS)
+        traceCount++;
+}
+
+void Profiler::start_frame()
+{
+    frameStart = std::chrono::steady_clock::now();
+    phaseStart = frameStart;
+}
+
+//Time since the previous phase ended (or the frame started)
+void Profiler::end_phase(int phase)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    add_event(phase, phaseStart, std::chrono::duration_cast<std::chrono::nanoseconds>(now - phaseStart).count());
+    phaseStart = now;
+}
+
+void Profiler::end_frame()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    add_event(PROFILE_FRAME, frameStart, std::chrono::duration_cast<std::chrono::nanoseconds>(now - frameStart).count());
+}
+
+//Time from a key event arriving to the first frame presented with its effect
+void Profiler::record_input_latency(long long nanoseconds)
+{
+    inputLatency.record(nanoseconds);
+}
+
+//p50/p99/p99.9 and max of every phase, in microseconds
+bool Profiler::write_summary(const char *filename)
+{
+    std::ofstream out(filename);
+    if (!out)
+        return false;
+
+    out << std::fixed << std::setprecision(1);
+    out << "phase count p50_us p99_us p999_us max_us" << std::endl;
+    for (int i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        out << PROFILE_PHASE_NAMES[i] << " " << phases[i].get_total();
+        out << " " << phases[i].percentile(50) / 1000.0;
+        out << " " << phases[i].percentile(99) / 1000.0;
+        out << " " << phases[i].percentile(99.9) / 1000.0;
+        out << " " << phases[i].get_max() / 1000.0 << std::endl;
+    }
+
+    out << "input_to_present " << inputLatency.get_total();
+    out << " " << inputLatency.percentile(50) / 1000.0;
+    out << " " << inputLatency.percentile(99) / 1000.0;
+    out << " " << inputLatency.percentile(99.9) / 1000.0;
+    out << " " << inputLatency.get_max() / 1000.0 << std::endl;
+
+    return true;
+}
+
+//Chrome trace event format, open in chrome://tracing or Perfetto
+bool Profiler::write_trace(const char *filename)
+{
+    std::ofstream out(filename);
+    if (!out)
+        return false;
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[" << std::endl;
+
+    int first = (traceNext - traceCount + MAX_TRACE_EVENTS) % MAX_TRACE_EVENTS;
+    for (int i = 0; i < traceCount; i++)
+    {
+        TraceEvent &e = trace[(first + i) % MAX_TRACE_EVENTS];
+        //the whole frame goes on its own track so it doesn't nest oddly with its phases
+        int track = (e.phase == PROFILE_FRAME) ? 2 : 1;
+
+        out << "{\"name\":\"" << PROFILE_PHASE_NAMES[e.phase] << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << track;
+        out << ",\"ts\":" << e.start / 1000.0 << ",\"dur\":" << e.duration / 1000.0 << "}";
+        if (i + 1 < traceCount)
+            out << ",";
+        out << std::endl;
+    }
+
+    out << "]}" << std::endl;
+    return true;
+}
@@ -0,0 +1,77 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+
+//parts of the main loop that get timed
+enum ProfilePhases
+{
+    PROFILE_EVENTS,
+    PROFILE_LOGIC,
+    PROFILE_CHANGE_STATE,
+    PROFILE_RENDER,
+    PROFILE_PRESENT,
+    PROFILE_FRAME,
+    PROFILE_PHASE_COUNT,
+};
+
+//Histogram layout, HDR style: values below HISTOGRAM_SUB_BUCKETS are exact,
+//above that every power of two is split into HISTOGRAM_SUB_BUCKETS/2 buckets,
+//so any recorded value is within ~3% of the truth
+const int HISTOGRAM_SUB_BITS = 6;
+const int HISTOGRAM_SUB_BUCKETS = 1 << HISTOGRAM_SUB_BITS;
+const int HISTOGRAM_HALF_BUCKETS = HISTOGRAM_SUB_BUCKETS / 2;
+const int HISTOGRAM_MAX_BITS = 40; //~18 minutes in ns
+const int HISTOGRAM_BUCKETS = HISTOGRAM_SUB_BUCKETS + (HISTOGRAM_MAX_BITS - HISTOGRAM_SUB_BITS) * HISTOGRAM_HALF_BUCKETS;
+
+//most recent phase timings kept for the trace
+const int MAX_TRACE_EVENTS = 6 * 60 * 60;
+
+//Fixed size latency histogram
+class Histogram
+{
+    private:
+        long long counts[HISTOGRAM_BUCKETS];
+        long long total;
+        long long maxValue;
+    public:
+        Histogram();
+        void clear();
+        void record(long long value);
+        long long get_total();
+        long long get_max();
+        long long percentile(double percent);
+};
+
+//Frame profiler - times each phase of every frame into a histogram, and
+//keeps the most recent ones for a Chrome trace
+class Profiler
+{
+    private:
+        struct TraceEvent
+        {
+            long long start;
+            long long duration;
+            int phase;
+        };
+
+        Histogram phases[PROFILE_PHASE_COUNT];
+        Histogram inputLatency;
+        TraceEvent trace[MAX_TRACE_EVENTS];
+        int traceNext, traceCount;
+        std::chrono::steady_clock::time_point epoch;
+        std::chrono::steady_clock::time_point frameStart, phaseStart;
+
+        long long since_epoch(std::chrono::steady_clock::time_point when);
+        void add_event(int phase, std::chrono::steady_clock::time_point start, long long duration);
+    public:
+        Profiler();
+        void start_frame();
+        void end_phase(int phase);
+        void end_frame();
+        void record_input_latency(long long nanoseconds);
+        bool write_summary(const char *filename);
+        bool write_trace(const char *filename);
+};
+
+#endif
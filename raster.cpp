@@ -0,0 +1,163 @@
+#include "raster.h"
+#include "swarm.h"
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+const unsigned int RASTER_BLACK = 0xFF000000;
+const unsigned int RASTER_WHITE = 0xFFFFFFFF;
+
+//3x5 digits, top row in the highest bits
+const unsigned short DIGIT_GLYPHS[10] =
+{
+    0x7B6F, 0x2C97, 0x73E7, 0x73CF, 0x5BC9, 0x79CF, 0x79EF, 0x7249, 0x7BEF, 0x7BCF
+};
+
+Rasterizer::Rasterizer()
+{
+    init(1, RASTER_GRAY8);
+}
+
+void Rasterizer::init(int frameScale, int pixelFormat)
+{
+    if (frameScale < 1)
+        frameScale = 1;
+
+    scale = frameScale;
+    format = pixelFormat;
+    width = (SCREEN_WIDTH + scale - 1) / scale;
+    height = (SCREEN_HEIGHT + scale - 1) / scale;
+    bytesPerPixel = format == RASTER_ARGB32 ? 4 : 1;
+}
+
+int Rasterizer::get_width()
+{
+    return width;
+}
+
+int Rasterizer::get_height()
+{
+    return height;
+}
+
+//Bytes in one frame, rows are packed with no padding
+int Rasterizer::get_frame_size()
+{
+    return width * height * bytesPerPixel;
+}
+
+//Fill count pixels from row, colour given as ARGB (grey frames take its low byte)
+void Rasterizer::fill_span(unsigned char *row, int count, unsigned int colour)
+{
+    int bytes = count * bytesPerPixel;
+    int i = 0;
+
+    //grey is a plain byte fill, which memset already does with the widest stores there are
+    if (bytesPerPixel == 1)
+    {
+        memset(row, colour & 0xFF, count);
+        return;
+    }
+
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i fill = _mm_set1_epi32((int)colour);
+    for (; i + 16 <= bytes; i += 16)
+        _mm_storeu_si128((__m128i *)(row + i), fill);
+#endif
+
+    for (; i < bytes; i += 4)
+        memcpy(row + i, &colour, 4);
+}
+
+//White rectangle, in screen pixels
+void Rasterizer::fill_rect(unsigned char *frame, int x, int y, int w, int h)
+{
+    int left = x < 0 ? 0 : x / scale;
+    int top = y < 0 ? 0 : y / scale;
+    int right = (x + w + scale - 1) / scale;
+    int bottom = (y + h + scale - 1) / scale;
+
+    if (right > width)
+        right = width;
+    if (bottom > height)
+        bottom = height;
+    if (left >= right || top >= bottom)
+        return;
+
+    int pitch = width * bytesPerPixel;
+    unsigned char *row = frame + top * pitch + left * bytesPerPixel;
+    for (int r = top; r < bottom; r++, row += pitch)
+        fill_span(row, right - left, RASTER_WHITE);
+}
+
+void Rasterizer::draw_number(unsigned char *frame, int centreX, int centreY, int number)
+{
+    char digits[12];
+    int count = 0;
+
+    if (number < 0)
+        number = 0;
+    do
+    {
+        digits[count++] = number % 10;
+        number /= 10;
+    } while (number > 0 && count < 12);
+
+    //digits are 3 cells wide with a cell of space between them
+    int textWidth = count * 4 * DIGIT_CELL - DIGIT_CELL;
+    int x = centreX - textWidth / 2;
+    int y = centreY - 5 * DIGIT_CELL / 2;
+
+    for (int d = count - 1; d >= 0; d--, x += 4 * DIGIT_CELL)
+    {
+        unsigned short glyph = DIGIT_GLYPHS[(int)digits[d]];
+
+        //one rectangle per run of lit cells in a glyph row
+        for (int cellRow = 0; cellRow < 5; cellRow++)
+        {
+            int bits = (glyph >> (12 - cellRow * 3)) & 7;
+            for (int cell = 0; cell < 3; cell++)
+            {
+                if (!(bits & (4 >> cell)))
+                    continue;
+                int run = 1;
+                while (cell + run < 3 && (bits & (4 >> (cell + run))))
+                    run++;
+                fill_rect(frame, x + cell * DIGIT_CELL, y + cellRow * DIGIT_CELL, run * DIGIT_CELL, DIGIT_CELL);
+                cell += run;
+            }
+        }
+    }
+}
+
+//Draw one match into frame, which holds get_frame_size() bytes
+void Rasterizer::render(MatchState *match, unsigned char *frame)
+{
+    fill_span(frame, width * height, RASTER_BLACK);
+
+    fill_rect(frame, (SCREEN_WIDTH - DIVIDER_WIDTH) / 2, 0, DIVIDER_WIDTH, SCREEN_HEIGHT);
+
+    Rect *left = match->leftPaddle.get_position();
+    Rect *right = match->rightPaddle.get_position();
+    fill_rect(frame, left->x, left->y, left->w, left->h);
+    fill_rect(frame, right->x, right->y, right->w, right->h);
+
+    draw_number(frame, LEFT_SCORE_X, LEFT_SCORE_Y, match->leftScore);
+    draw_number(frame, RIGHT_SCORE_X, RIGHT_SCORE_Y, match->rightScore);
+
+    if (match_ball_shown(match))
+    {
+        Rect *ball = match->theBall.get_position();
+        fill_rect(frame, ball->x, ball->y, ball->w, ball->h);
+    }
+
+    if (match->swarm != NULL && !match->justStarted)
+    {
+        for (int i = 0; i < match->swarm->get_count(); i++)
+        {
+            Rect ball = match->swarm->get_ball(i);
+            fill_rect(frame, ball.x, ball.y, ball.w, ball.h);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include "sim.h"
+
+//pixel formats the rasterizer writes
+enum RasterFormats
+{
+    RASTER_GRAY8,  //one byte per pixel, 0 black to 255 white
+    RASTER_ARGB32, //one Uint32 per pixel, 0xAARRGGBB
+};
+
+//scores are drawn with a built in 3x5 digit font, each cell this many screen pixels
+const int DIGIT_CELL = 6;
+
+//Offscreen rasterizer - draws the playfield Game::render shows (divider,
+//paddles, ball and scores, but no messages) into a caller's framebuffer
+//with no SDL. Everything on the field is a white rectangle on black, so
+//drawing is just span fills, done 16 bytes at a time. scale shrinks the
+//frame by a whole factor; a rectangle lights every pixel it touches, so
+//the ball never disappears however small the frame gets. render keeps no
+//state of its own, so one Rasterizer can draw on several threads at once.
+class Rasterizer
+{
+    private:
+        int scale;
+        int format;
+        int width, height;
+        int bytesPerPixel;
+
+        void fill_span(unsigned char *row, int count, unsigned int colour);
+        void fill_rect(unsigned char *frame, int x, int y, int w, int h);
+        void draw_number(unsigned char *frame, int centreX, int centreY, int number);
+    public:
+        Rasterizer();
+        void init(int frameScale, int pixelFormat);
+        int get_width();
+        int get_height();
+        int get_frame_size();
+        void render(MatchState *match, unsigned char *frame);
+};
+
+#endif
@@ -0,0 +1,315 @@
+#include "replay.h"
+#include "sim.h"
+#include <cstring>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+unsigned int read_u32(const unsigned char *bytes)
+{
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
+}
+
+void write_u32(unsigned char *bytes, unsigned int value)
+{
+    for (int i = 0; i < 4; i++)
+        bytes[i] = (unsigned char)(value >> (8 * i));
+}
+
+ReplayWriter::ReplayWriter()
+{
+    used = 0;
+    runInputs = 0;
+    runLength = 0;
+    steps = 0;
+}
+
+ReplayWriter::~ReplayWriter()
+{
+    close();
+}
+
+bool ReplayWriter::open(const char *filename, unsigned int seed, int balls)
+{
+    close();
+
+    file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    used = 0;
+    runInputs = 0;
+    runLength = 0;
+    steps = 0;
+
+    for (int i = 0; i < REPLAY_MAGIC_LENGTH; i++)
+        put_byte(REPLAY_MAGIC[i]);
+    put_u32(REPLAY_VERSION);
+    put_u32(seed);
+    put_u32(SIM_HZ);
+    put_u32(PHYSICS_KIND);
+    put_u32(balls);
+    put_u32(0); //step count, filled in by close()
+
+    return true;
+}
+
+void ReplayWriter::put_byte(unsigned char byte)
+{
+    if (used == REPLAY_BUFFER_SIZE)
+        flush_buffer();
+    buffer[used++] = byte;
+}
+
+void ReplayWriter::put_u32(unsigned int value)
+{
+    for (int i = 0; i < 4; i++)
+        put_byte((value >> (8 * i)) & 0xFF);
+}
+
+void ReplayWriter::flush_buffer()
+{
+    file.write((const char *)buffer, used);
+    used = 0;
+}
+
+void ReplayWriter::end_run()
+{
+    if (runLength == 0)
+        return;
+
+    int phases = runInputs >> 8;
+    put_byte((runInputs & 0x0F) | (phases != 0 ? REPLAY_PHASE_FLAG : 0));
+    if (phases != 0)
+        put_byte(phases);
+
+    unsigned int length = runLength;
+    while (length >= 0x80)
+    {
+        put_byte((length & 0x7F) | 0x80);
+        length >>= 7;
+    }
+    put_byte(length);
+
+    runLength = 0;
+}
+
+//Inputs for one step - consecutive identical steps share a run
+void ReplayWriter::record(int leftInput, int rightInput)
+{
+    if (!file.is_open())
+        return;
+
+    int inputs = (leftInput & INPUT_KEYS) | ((rightInput & INPUT_KEYS) << 2);
+    inputs |= (input_phase(leftInput) | (input_phase(rightInput) << 4)) << 8;
+    if (runLength > 0 && inputs != runInputs)
+        end_run();
+
+    runInputs = inputs;
+    runLength++;
+    steps++;
+}
+
+void ReplayWriter::close()
+{
+    if (!file.is_open())
+        return;
+
+    end_run();
+    flush_buffer();
+
+    unsigned char count[4];
+    for (int i = 0; i < 4; i++)
+        count[i] = (steps >> (8 * i)) & 0xFF;
+    file.seekp(REPLAY_STEPS_OFFSET);
+    file.write((const char *)count, 4);
+
+    file.close();
+}
+
+bool ReplayWriter::is_open()
+{
+    return file.is_open();
+}
+
+ReplayReader::ReplayReader()
+{
+    data = NULL;
+    size = 0;
+    offset = 0;
+    seed = 0;
+    balls = 0;
+    steps = 0;
+    runInputs = 0;
+    runLeft = 0;
+#ifdef _WIN32
+    fileHandle = INVALID_HANDLE_VALUE;
+    mapHandle = NULL;
+#else
+    fd = -1;
+#endif
+}
+
+ReplayReader::~ReplayReader()
+{
+    close();
+}
+
+#ifdef _WIN32
+bool ReplayReader::map_file(const char *filename)
+{
+    fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        return false;
+    size = size_t(fileSize.QuadPart);
+
+    mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapHandle == NULL)
+        return false;
+
+    data = (const unsigned char *)MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0);
+    return data != NULL;
+}
+
+void ReplayReader::unmap_file()
+{
+    if (data != NULL)
+        UnmapViewOfFile(data);
+    if (mapHandle != NULL)
+        CloseHandle(mapHandle);
+    if (fileHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(fileHandle);
+
+    data = NULL;
+    mapHandle = NULL;
+    fileHandle = INVALID_HANDLE_VALUE;
+}
+#else
+bool ReplayReader::map_file(const char *filename)
+{
+    fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) == -1 || info.st_size == 0)
+        return false;
+    size = size_t(info.st_size);
+
+    void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED)
+        return false;
+
+    data = (const unsigned char *)mapped;
+    return true;
+}
+
+void ReplayReader::unmap_file()
+{
+    if (data != NULL)
+        munmap((void *)data, size);
+    if (fd != -1)
+        ::close(fd);
+
+    data = NULL;
+    fd = -1;
+}
+#endif
+
+bool ReplayReader::open(const char *filename)
+{
+    close();
+
+    if (!map_file(filename) || size < size_t(REPLAY_HEADER_SIZE)
+        || memcmp(data, REPLAY_MAGIC, REPLAY_MAGIC_LENGTH) != 0
+        || read_u32(data + REPLAY_MAGIC_LENGTH) != REPLAY_VERSION
+        || read_u32(data + REPLAY_MAGIC_LENGTH + 8) != (unsigned int)SIM_HZ
+        || read_u32(data + REPLAY_PHYSICS_OFFSET) != (unsigned int)PHYSICS_KIND)
+    {
+        close();
+        return false;
+    }
+
+    seed = read_u32(data + REPLAY_MAGIC_LENGTH + 4);
+    balls = read_u32(data + REPLAY_BALLS_OFFSET);
+    steps = read_u32(data + REPLAY_STEPS_OFFSET);
+    offset = REPLAY_HEADER_SIZE;
+    runLeft = 0;
+
+    return true;
+}
+
+void ReplayReader::close()
+{
+    unmap_file();
+    size = 0;
+    offset = 0;
+    runLeft = 0;
+}
+
+bool ReplayReader::is_open()
+{
+    return data != NULL;
+}
+
+unsigned int ReplayReader::get_seed()
+{
+    return seed;
+}
+
+//Extra balls for multi-ball mode, 0 for a normal match
+int ReplayReader::get_balls()
+{
+    return int(balls);
+}
+
+//Number of steps recorded, 0 if the recording wasn't closed properly
+unsigned int ReplayReader::get_steps()
+{
+    return steps;
+}
+
+//Inputs for the next step, false once the replay runs out
+bool ReplayReader::next(int *leftInput, int *rightInput)
+{
+    if (data == NULL)
+        return false;
+
+    if (runLeft == 0)
+    {
+        if (offset >= size)
+            return false;
+        runInputs = data[offset++];
+        if ((runInputs & REPLAY_PHASE_FLAG) && offset < size)
+            runInputs = (runInputs & 0x0F) | (data[offset++] << 8);
+
+        unsigned int length = 0;
+        int shift = 0;
+        while (offset < size)
+        {
+            unsigned char byte = data[offset++];
+            length |= (unsigned int)(byte & 0x7F) << shift;
+            shift += 7;
+            if ((byte & 0x80) == 0 || shift > 28)
+                break;
+        }
+
+        if (length == 0)
+            return false;
+        runLeft = length;
+    }
+
+    *leftInput = input_with_phase(runInputs & 3, (runInputs >> 8) & 0x0F);
+    *rightInput = input_with_phase((runInputs >> 2) & 3, (runInputs >> 12) & 0x0F);
+    runLeft--;
+    return true;
+}
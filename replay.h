@@ -0,0 +1,87 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstddef>
+#include <fstream>
+
+//Replay file layout, all numbers little endian:
+//  "PONGRPL1", u32 version, u32 seed (for SplitMix), u32 SIM_HZ,
+//  u32 PHYSICS_KIND (a replay only plays back on the physics that recorded it),
+//  u32 multi-ball count, u32 step count
+//then runs of identical per-step inputs: one byte (left input | right input << 2),
+//with REPLAY_PHASE_FLAG set when a second byte (left phase | right phase << 4)
+//follows, then the run length as a LEB128 varint
+const char REPLAY_MAGIC[] = "PONGRPL1";
+const int REPLAY_MAGIC_LENGTH = 8;
+const unsigned int REPLAY_VERSION = 5;
+const int REPLAY_PHASE_FLAG = 0x10;
+const int REPLAY_HEADER_SIZE = REPLAY_MAGIC_LENGTH + 6 * 4;
+const int REPLAY_PHYSICS_OFFSET = REPLAY_MAGIC_LENGTH + 3 * 4;
+const int REPLAY_BALLS_OFFSET = REPLAY_MAGIC_LENGTH + 4 * 4;
+const int REPLAY_STEPS_OFFSET = REPLAY_MAGIC_LENGTH + 5 * 4;
+
+//little endian u32s, also used for network packets
+unsigned int read_u32(const unsigned char *bytes);
+void write_u32(unsigned char *bytes, unsigned int value);
+
+//bytes buffered before the writer touches the file
+const int REPLAY_BUFFER_SIZE = 4096;
+
+//Replay writer - records the inputs of every step of one match
+class ReplayWriter
+{
+    private:
+        std::ofstream file;
+        unsigned char buffer[REPLAY_BUFFER_SIZE];
+        int used;
+        int runInputs;
+        unsigned int runLength;
+        unsigned int steps;
+
+        void put_byte(unsigned char byte);
+        void put_u32(unsigned int value);
+        void end_run();
+        void flush_buffer();
+    public:
+        ReplayWriter();
+        ~ReplayWriter();
+        bool open(const char *filename, unsigned int seed, int balls);
+        void record(int leftInput, int rightInput);
+        void close();
+        bool is_open();
+};
+
+//Replay reader - maps a replay file and hands back its inputs one step at a time
+class ReplayReader
+{
+    private:
+        const unsigned char *data;
+        size_t size;
+        size_t offset;
+        unsigned int seed;
+        unsigned int balls;
+        unsigned int steps;
+        int runInputs;
+        unsigned int runLeft;
+#ifdef _WIN32
+        void *fileHandle;
+        void *mapHandle;
+#else
+        int fd;
+#endif
+
+        bool map_file(const char *filename);
+        void unmap_file();
+    public:
+        ReplayReader();
+        ~ReplayReader();
+        bool open(const char *filename);
+        void close();
+        bool is_open();
+        unsigned int get_seed();
+        int get_balls();
+        unsigned int get_steps();
+        bool next(int *leftInput, int *rightInput);
+};
+
+#endif
@@ -0,0 +1,566 @@
+#define _USE_MATH_DEFINES
+#include "sim.h"
+#include "swarm.h"
+#include <cmath>
+
+const unsigned long long GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+//SplitMix64 finaliser - scrambles a 64 bit value
+unsigned long long split_mix(unsigned long long x)
+{
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+SplitMix::SplitMix()
+{
+    seed(0, STREAM_SERVE);
+}
+
+void SplitMix::seed(unsigned int seed, int stream)
+{
+    key = split_mix(((unsigned long long)stream << 32 | seed) * GOLDEN_GAMMA);
+    counter = 0;
+}
+
+unsigned long long SplitMix::next()
+{
+    counter++;
+    return split_mix(key + counter * GOLDEN_GAMMA);
+}
+
+bool SplitMix::next_bool()
+{
+    return (next() >> 63) != 0;
+}
+
+//0 <= value < 1, from the top 53 bits
+double SplitMix::next_unit()
+{
+    return (next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+bool check_collision(int ballX, int ballY, Rect *pad)
+{
+    int ballLeft, ballRight, ballTop, ballBottom;
+    int paddleLeft, paddleRight, paddleTop, paddleBottom;
+
+    ballLeft = ballX;
+    ballRight = ballX + BALL_WIDTH;
+    ballTop = ballY;
+    ballBottom = ballY + BALL_WIDTH;
+
+    paddleLeft = pad->x;
+    paddleRight = pad->x + pad->w;
+    paddleTop = pad->y;
+    paddleBottom = pad->y + pad->h;
+
+    if ((ballLeft >= paddleRight || ballRight <= paddleLeft || ballTop >= paddleBottom || ballBottom <= paddleTop) == false)
+        return true;
+
+    return false;
+}
+
+int input_with_phase(int input, int phase)
+{
+    if (phase < 0)
+        phase = 0;
+    else if (phase >= INPUT_PHASES)
+        phase = INPUT_PHASES - 1;
+    return (input & INPUT_KEYS) | (phase << INPUT_PHASE_SHIFT);
+}
+
+int input_phase(int input)
+{
+    return (input >> INPUT_PHASE_SHIFT) & (INPUT_PHASES - 1);
+}
+
+template <class Number>
+BasicPaddle<Number>::BasicPaddle()
+{
+    vel = 0;
+    prevVel = 0;
+    phase = 0;
+    frameVel = 0;
+    realY = 0;
+    prevY = 0;
+    position.x = 0;
+    position.y = 0;
+    position.w = PADDLE_WIDTH;
+    position.h = PADDLE_HEIGHT_DEF;
+}
+
+template <class Number>
+void BasicPaddle<Number>::init(Rect pos)
+{
+    vel = 0;
+    prevVel = 0;
+    phase = 0;
+    position = pos;
+    realY = position.y;
+    prevY = realY;
+}
+
+template <class Number>
+void BasicPaddle<Number>::set_input(int input)
+{
+    prevVel = vel;
+    phase = input_phase(input);
+
+    vel = 0;
+    if (input & INPUT_UP)
+        vel -= PADDLE_VEL;
+    if (input & INPUT_DOWN)
+        vel += PADDLE_VEL;
+}
+
+template <class Number>
+void BasicPaddle<Number>::move()
+{
+    prevY = realY;
+    //the old input holds for the part of the step before the new one arrived
+    frameVel = physics_ratio<Number>(prevVel * phase + vel * (INPUT_PHASES - phase), INPUT_PHASES * SIM_HZ);
+    realY += frameVel;
+
+    //handle collision
+    if (realY < 0)
+        realY = 0;
+    else if ((realY + position.h) > SCREEN_HEIGHT)
+        realY = SCREEN_HEIGHT - position.h;
+
+    position.y = physics_int(realY);
+}
+
+template <class Number>
+Rect *BasicPaddle<Number>::get_position()
+{
+    return &position;
+}
+
+//Position between the last two steps, for rendering
+template <class Number>
+Rect BasicPaddle<Number>::get_interpolated(double alpha)
+{
+    Rect pos = position;
+    double from = physics_double(prevY);
+    pos.y = int(from + (physics_double(realY) - from) * alpha);
+    return pos;
+}
+
+template <class Number>
+BasicBall<Number>::BasicBall()
+{
+    SplitMix random;
+    reset(&random);
+}
+
+//Steps until the ball's leading edge reaches a paddle face, or -1 if it misses.
+//face is the x the ball's left edge has when touching the paddle.
+template <class Number>
+Number paddle_hit_time(Number x, Number y, Number vx, Number vy, Number face, Rect *pad)
+{
+    if (vx == 0)
+        return -1;
+
+    //already past the face, too late to hit it
+    if ((vx < 0 && x < face) || (vx > 0 && x > face))
+        return -1;
+
+    Number t = (face - x) / vx;
+    Number hitY = y + vy * t;
+
+    if (hitY >= pad->y + pad->h || hitY + BALL_WIDTH <= pad->y)
+        return -1;
+
+    return t;
+}
+
+//Fold a position travelling past the walls back into 0..span, flipping
+//*velocity once for every wall it bounced off
+double fold_walls(double position, double span, double *velocity)
+{
+    double bounces = floor(position / span);
+    double folded = position - bounces * span;
+
+    //an odd number of bounces leaves the ball heading the other way, mirrored
+    if (fmod(fabs(bounces), 2.0) == 1.0)
+    {
+        folded = span - folded;
+        *velocity = -*velocity;
+    }
+    return folded;
+}
+
+//Per step velocity from the speed and direction, worked out again only
+//when the speed changes - bounces just flip a sign
+template <class Number>
+void BasicBall<Number>::update_velocity()
+{
+    Number perStep = physics_ratio<Number>(speed, SIM_HZ);
+    vx = dirX * perStep;
+    vy = dirY * perStep;
+}
+
+//Swept collision - the ball travels in a straight line until its earliest
+//contact with a wall or paddle face, bounces there, and carries on with
+//the time left, so it can't tunnel through a paddle however fast it goes
+template <class Number>
+int BasicBall<Number>::move(Rect *leftPad, Rect *rightPad)
+{
+    prevX = realX;
+    prevY = realY;
+
+    //waiting to serve, or to go back after a point
+    if (delayed || scored)
+        return MOVE_NONE;
+
+    //in steps
+    Number remaining = 1;
+
+    for (int bounce = 0; bounce < MAX_BOUNCES && remaining > 0; bounce++)
+    {
+        Number hitTime = remaining;
+        int hit = HIT_NONE;
+        Number t;
+
+        //walls
+        if (vy < 0)
+        {
+            t = -realY / vy;
+            if (t < hitTime)
+            {
+                hitTime = t;
+                hit = HIT_TOP;
+            }
+        }
+        else if (vy > 0)
+        {
+            t = (Number(SCREEN_HEIGHT - position.h) - realY) / vy;
+            if (t < hitTime)
+            {
+                hitTime = t;
+                hit = HIT_BOTTOM;
+            }
+        }
+
+        //the paddle face the ball is heading towards
+        if (vx < 0)
+        {
+            t = paddle_hit_time<Number>(realX, realY, vx, vy, leftPad->x + leftPad->w, leftPad);
+            if (t >= 0 && t <= hitTime)
+            {
+                hitTime = t;
+                hit = HIT_LEFT_PADDLE;
+            }
+        }
+        else if (vx > 0)
+        {
+            t = paddle_hit_time<Number>(realX, realY, vx, vy, rightPad->x - position.w, rightPad);
+            if (t >= 0 && t <= hitTime)
+            {
+                hitTime = t;
+                hit = HIT_RIGHT_PADDLE;
+            }
+        }
+
+        if (hitTime < 0)
+            hitTime = 0;
+        realX += vx * hitTime;
+        realY += vy * hitTime;
+        remaining -= hitTime;
+
+        switch (hit)
+        {
+            case HIT_TOP:
+                realY = 0;
+                dirY = -dirY;
+                vy = -vy;
+                break;
+            case HIT_BOTTOM:
+                realY = SCREEN_HEIGHT - position.h;
+                dirY = -dirY;
+                vy = -vy;
+                break;
+            case HIT_LEFT_PADDLE:
+                realX = leftPad->x + leftPad->w;
+                dirX = -dirX;
+                speed += BALL_SPEED_UP;
+                update_velocity();
+                break;
+            case HIT_RIGHT_PADDLE:
+                realX = rightPad->x - position.w;
+                dirX = -dirX;
+                speed += BALL_SPEED_UP;
+                update_velocity();
+                break;
+            default:
+                remaining = 0;
+                break;
+        }
+    }
+
+    if (realX < 0)
+    {
+        realX = prevX;
+        realY = prevY;
+        return MOVE_RIGHT_SCORED;
+    }
+    else if ((realX + position.w) > SCREEN_WIDTH)
+    {
+        realX = prevX;
+        realY = prevY;
+        return MOVE_LEFT_SCORED;
+    }
+
+    position.x = physics_int(realX);
+    position.y = physics_int(realY);
+
+    return MOVE_NONE;
+}
+
+//Serve from the centre, direction and angle drawn from random
+template <class Number>
+void BasicBall<Number>::reset(SplitMix *random)
+{
+    speed = BALL_INIT_VEL;
+    delayed = true;
+    scored = false;
+
+    Number diagonal = physics_ratio<Number>(DIAGONAL_NUM, DIAGONAL_DEN);
+    dirX = random->next_bool() ? diagonal : -diagonal;
+    dirY = random->next_bool() ? -diagonal : diagonal;
+    update_velocity();
+
+    realX = (SCREEN_WIDTH - BALL_WIDTH)/2;
+    realY = (SCREEN_HEIGHT - BALL_WIDTH)/2;
+    prevX = realX;
+    prevY = realY;
+    position.x = physics_int(realX);
+    position.y = physics_int(realY);
+    position.w = BALL_WIDTH;
+    position.h = BALL_WIDTH;
+}
+
+template <class Number>
+bool BasicBall<Number>::is_delayed()
+{
+    return delayed;
+}
+
+template <class Number>
+void BasicBall<Number>::delay()
+{
+    delayed = true;
+}
+
+template <class Number>
+void BasicBall<Number>::stop_delay()
+{
+    delayed = false;
+}
+
+template <class Number>
+void BasicBall<Number>::have_scored()
+{
+    scored = true;
+}
+
+template <class Number>
+bool BasicBall<Number>::is_scored()
+{
+    return scored;
+}
+
+//Pixels per second - grows by BALL_SPEED_UP with every paddle hit
+template <class Number>
+double BasicBall<Number>::get_speed()
+{
+    return speed;
+}
+
+//Pixels per second along each axis
+template <class Number>
+void BasicBall<Number>::get_velocity(double *vx, double *vy)
+{
+    *vx = physics_double(this->vx) * SIM_HZ;
+    *vy = physics_double(this->vy) * SIM_HZ;
+}
+
+template <class Number>
+Rect *BasicBall<Number>::get_position()
+{
+    return &position;
+}
+
+//Position between the last two steps, for rendering
+template <class Number>
+Rect BasicBall<Number>::get_interpolated(double alpha)
+{
+    Rect pos = position;
+    double fromX = physics_double(prevX);
+    double fromY = physics_double(prevY);
+    pos.x = int(fromX + (physics_double(realX) - fromX) * alpha);
+    pos.y = int(fromY + (physics_double(realY) - fromY) * alpha);
+    return pos;
+}
+
+//both backends are always built, so the benchmark can weigh one against the other
+template class BasicPaddle<double>;
+template class BasicPaddle<Fixed>;
+template class BasicBall<double>;
+template class BasicBall<Fixed>;
+
+//Steps until a wait of ms is over - the first step past it
+int delay_steps(int ms)
+{
+    return ms * SIM_HZ / 1000 + 1;
+}
+
+//The ball is waiting in the centre, show it blinking until it's served
+void begin_serve(MatchState *match)
+{
+    match->serves++;
+    match->blinkShown = true;
+    match->timers.schedule(delay_steps(SERVE_DELAY), EVENT_SERVE, match->serves);
+    match->timers.schedule(delay_steps(SERVE_BLINK), EVENT_BLINK, match->serves);
+}
+
+void match_fire(MatchState *match, int event, int data)
+{
+    Ball &ball = match->theBall;
+
+    switch (event)
+    {
+        case EVENT_START:
+            match->justStarted = false;
+            begin_serve(match);
+            break;
+        case EVENT_SERVE:
+            //a match that ended in the meantime keeps its ball waiting
+            if (!match->endGame)
+                ball.stop_delay();
+            break;
+        case EVENT_RESET:
+            if (!match->endGame)
+            {
+                ball.reset(&match->random);
+                begin_serve(match);
+            }
+            break;
+        case EVENT_BLINK:
+            //only while the serve it was set for is still waiting
+            if (data == match->serves && ball.is_delayed())
+            {
+                match->blinkShown = !match->blinkShown;
+                match->timers.schedule(delay_steps(SERVE_BLINK), EVENT_BLINK, data);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+//The seed decides every serve, so a match replays exactly from its seed and inputs
+void match_init(MatchState *match, unsigned int seed)
+{
+    Rect leftPos, rightPos;
+
+    match->seed = seed;
+    match->random.seed(seed, STREAM_SERVE);
+
+    leftPos.x = PADDLE_MARGIN;
+    leftPos.y = (SCREEN_HEIGHT-PADDLE_HEIGHT_DEF)/2;
+    leftPos.w = PADDLE_WIDTH;
+    leftPos.h = PADDLE_HEIGHT_DEF;
+
+    rightPos.x = SCREEN_WIDTH - PADDLE_MARGIN - PADDLE_WIDTH;
+    rightPos.y = (SCREEN_HEIGHT-PADDLE_HEIGHT_DEF)/2;
+    rightPos.w = PADDLE_WIDTH;
+    rightPos.h = PADDLE_HEIGHT_DEF;
+
+    match->leftPaddle.init(leftPos);
+    match->rightPaddle.init(rightPos);
+    match->theBall.reset(&match->random);
+
+    match->leftScore = 0;
+    match->rightScore = 0;
+    match->endGame = false;
+    match->justStarted = true;
+    match->serves = 0;
+    match->blinkShown = true;
+    match->timers.clear();
+    match->timers.schedule(delay_steps(START_DELAY), EVENT_START, 0);
+    match->scoreLimit = SCORE_LIMIT;
+    match->swarm = NULL;
+}
+
+//Whether the ball is drawn - hidden before the first serve, blinking while waiting to serve
+bool match_ball_shown(MatchState *match)
+{
+    Ball &ball = match->theBall;
+
+    if (match->justStarted)
+        return false;
+
+    if (!match->endGame && ball.is_delayed())
+        return match->blinkShown;
+
+    return true;
+}
+
+//Advance the match by one fixed step of SIM_DT, returns who scored (if anyone)
+int match_step(MatchState *match, int leftInput, int rightInput)
+{
+    match->leftPaddle.set_input(leftInput);
+    match->rightPaddle.set_input(rightInput);
+    match->leftPaddle.move();
+    match->rightPaddle.move();
+
+    Ball &ball = match->theBall;
+    int result = MOVE_NONE;
+
+    //timers scheduled during the step count from it, the ones due fire at its end
+    match->timers.advance();
+
+    //nothing but the paddles moves until the opening wait is over
+    if (!match->justStarted)
+    {
+        result = ball.move(match->leftPaddle.get_position(), match->rightPaddle.get_position());
+        switch (result)
+        {
+            case MOVE_LEFT_SCORED:
+                match->leftScore++;
+                if (match->leftScore >= match->scoreLimit)
+                    match->endGame = true;
+                ball.have_scored();
+                break;
+            case MOVE_RIGHT_SCORED:
+                match->rightScore++;
+                if (match->rightScore >= match->scoreLimit)
+                    match->endGame = true;
+                ball.have_scored();
+                break;
+            default:
+                break;
+        }
+        if (result != MOVE_NONE)
+            match->timers.schedule(delay_steps(SCORED_DELAY), EVENT_RESET, 0);
+
+        if (match->swarm != NULL && !match->endGame)
+        {
+            int leftPoints = 0, rightPoints = 0;
+            match->swarm->step(match->leftPaddle.get_position(), match->rightPaddle.get_position(), &leftPoints, &rightPoints);
+            match->leftScore += leftPoints;
+            match->rightScore += rightPoints;
+            if (match->leftScore >= match->scoreLimit || match->rightScore >= match->scoreLimit)
+                match->endGame = true;
+        }
+    }
+
+    int event, data;
+    while (match->timers.next_due(&event, &data))
+        match_fire(match, event, data);
+
+    return result;
+}
@@ -0,0 +1,256 @@
+#ifndef SIM_H
+#define SIM_H
+
+//Simulation core - paddles, ball and scoring with no SDL, so a match
+//can be stepped without a window (see headless.cpp)
+
+#include "timers.h"
+#include "fixed.h"
+
+//constants
+const int SCREEN_WIDTH = 640;
+const int SCREEN_HEIGHT = 480;
+
+const int DIVIDER_WIDTH = 2;
+const int PADDLE_WIDTH = 10;
+const int PADDLE_HEIGHT_DEF = 50;
+const int PADDLE_MARGIN = 30; //gap between a paddle and its side of the screen
+const int PADDLE_VEL = 250;
+const int BALL_WIDTH = 10;
+const int BALL_INIT_VEL = 150;
+const int BALL_SPEED_UP = 20;
+
+const int SCORE_LIMIT = 7;
+
+//centres of the scores on screen
+const int LEFT_SCORE_X = 260;
+const int LEFT_SCORE_Y = 50;
+const int RIGHT_SCORE_X = 378;
+const int RIGHT_SCORE_Y = 50;
+
+//physics runs at a fixed rate, independent of the frame rate
+const int SIM_HZ = 240;
+const double SIM_DT = 1.0 / SIM_HZ;
+
+//delays, in milliseconds
+const int START_DELAY = 500;
+const int SERVE_DELAY = 2000;
+const int SCORED_DELAY = 400;
+const int SERVE_BLINK = 500; //the waiting ball shows and hides this long in turn
+
+//what a match schedules on its timer wheel
+enum MatchEvents
+{
+    EVENT_START,    //the opening wait is over
+    EVENT_SERVE,    //the waiting ball sets off
+    EVENT_RESET,    //back to the centre after a point
+    EVENT_BLINK,    //the waiting ball shows or hides, data is the serve it belongs to
+};
+
+//results of Ball::move and match_step
+enum MoveResults
+{
+    MOVE_NONE,
+    MOVE_LEFT_SCORED,
+    MOVE_RIGHT_SCORED,
+};
+
+//what the ball touched first while sweeping along its path
+enum BallHits
+{
+    HIT_NONE,
+    HIT_TOP,
+    HIT_BOTTOM,
+    HIT_LEFT_PADDLE,
+    HIT_RIGHT_PADDLE,
+};
+
+//most bounces followed within one step
+const int MAX_BOUNCES = 8;
+
+//paddle input - bitmask, so holding both keys cancels out
+enum PaddleInputs
+{
+    INPUT_NONE = 0,
+    INPUT_UP = 1,
+    INPUT_DOWN = 2,
+};
+
+//An input can also say when in the step it arrived: bits from
+//INPUT_PHASE_SHIFT up hold how many INPUT_PHASES of the step go by with the
+//previous input before this one takes over. Plain masks have phase 0.
+const int INPUT_KEYS = INPUT_UP | INPUT_DOWN;
+const int INPUT_PHASE_SHIFT = 4;
+const int INPUT_PHASES = 16;
+
+int input_with_phase(int input, int phase);
+int input_phase(int input);
+
+//random streams drawn from one match seed
+enum RandomStreams
+{
+    STREAM_SERVE,
+    STREAM_SWARM,
+    STREAM_AI_LEFT,
+    STREAM_AI_RIGHT,
+    STREAM_NET_SHIM,
+};
+
+unsigned long long split_mix(unsigned long long x);
+
+//Counter based random numbers - value n of a stream is split_mix(key + n),
+//so each match (and each thread running one) owns its generator outright
+//and the same seed always gives the same serves
+class SplitMix
+{
+    private:
+        unsigned long long key;
+        unsigned long long counter;
+    public:
+        SplitMix();
+        void seed(unsigned int seed, int stream);
+        unsigned long long next();
+        bool next_bool();
+        double next_unit();
+};
+
+enum Sides
+{
+    SIDE_LEFT,
+    SIDE_RIGHT,
+};
+
+//x of the ball's left edge when it touches each paddle face
+const double LEFT_FACE = PADDLE_MARGIN + PADDLE_WIDTH;
+const double RIGHT_FACE = SCREEN_WIDTH - PADDLE_MARGIN - PADDLE_WIDTH - BALL_WIDTH;
+
+//range of the ball's top edge between the walls
+const double BALL_SPAN = SCREEN_HEIGHT - BALL_WIDTH;
+
+//plain rectangle, converted to an SDL_Rect by the front end
+struct Rect
+{
+    int x, y, w, h;
+};
+
+bool check_collision(int ballX, int ballY, Rect *pad);
+double fold_walls(double position, double span, double *velocity);
+
+//The ball and paddles run on a Number type - Fixed by default, so a match
+//plays out the same to the bit on every build and its replays and lockstep
+//peers agree; -DPONG_DOUBLE_PHYSICS switches to double. Positions are in
+//pixels, velocities in pixels per step.
+template <class Number> Number physics_ratio(int num, int den);
+
+template <> inline double physics_ratio<double>(int num, int den)
+{
+    return double(num) / den;
+}
+
+template <> inline Fixed physics_ratio<Fixed>(int num, int den)
+{
+    return Fixed::ratio(num, den);
+}
+
+inline int physics_int(double value) { return int(value); }
+inline int physics_int(Fixed value) { return value.to_int(); }
+inline double physics_double(double value) { return value; }
+inline double physics_double(Fixed value) { return value.to_double(); }
+
+//cos 45 degrees, to 16 bits - the serve direction
+const int DIAGONAL_NUM = 46341;
+const int DIAGONAL_DEN = 65536;
+
+template <class Number>
+Number paddle_hit_time(Number x, Number y, Number vx, Number vy, Number face, Rect *pad);
+
+//Paddle class - movement of paddle
+template <class Number>
+class BasicPaddle
+{
+    private:
+        int vel;
+        int prevVel;
+        int phase;
+        Number frameVel;
+        Number realY, prevY;
+        Rect position;
+    public:
+        BasicPaddle();
+        void init(Rect initialPosition);
+        void set_input(int input);
+        void move();
+        Rect *get_position();
+        Rect get_interpolated(double alpha);
+};
+
+//Ball class - movement of ball, also handles collisions between ball and scoring areas, walls, paddle
+template <class Number>
+class BasicBall
+{
+    private:
+        int speed;          //pixels per second
+        Number dirX, dirY;  //unit vector the ball travels along
+        Number vx, vy;      //speed along dirX, dirY, per step
+        bool delayed;
+        bool scored;
+        Number realX, realY;
+        Number prevX, prevY;
+        Rect position;
+
+        void update_velocity();
+    public:
+        BasicBall();
+        int move(Rect *leftPad, Rect *rightPad);
+        void reset(SplitMix *random);
+        bool is_delayed();
+        void delay();
+        void stop_delay();
+        void have_scored();
+        bool is_scored();
+        double get_speed();
+        void get_velocity(double *vx, double *vy);
+        Rect *get_position();
+        Rect get_interpolated(double alpha);
+};
+
+//PHYSICS_KIND goes in replay headers, builds on different physics don't agree
+#ifdef PONG_DOUBLE_PHYSICS
+typedef double PhysicsNumber;
+const int PHYSICS_KIND = 1;
+#else
+typedef Fixed PhysicsNumber;
+const int PHYSICS_KIND = 0;
+#endif
+
+typedef BasicPaddle<PhysicsNumber> Paddle;
+typedef BasicBall<PhysicsNumber> Ball;
+
+class BallSwarm;
+
+//Everything needed to play one match
+struct MatchState
+{
+    Paddle leftPaddle;
+    Paddle rightPaddle;
+    Ball theBall;
+    int leftScore, rightScore;
+    bool endGame, justStarted;
+    //the serve, score and opening waits, in steps
+    TimerWheel timers;
+    int serves;
+    bool blinkShown;
+    unsigned int seed;
+    SplitMix random;
+    int scoreLimit;
+    //extra balls for multi-ball mode, NULL for a normal match
+    BallSwarm *swarm;
+};
+
+int delay_steps(int ms);
+
+void match_init(MatchState *match, unsigned int seed);
+int match_step(MatchState *match, int leftInput, int rightInput);
+bool match_ball_shown(MatchState *match);
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "sim.h"
+#include "swarm.h"
+#include <atomic>
+#include <chrono>
+
+//Hand-offs between the main thread and the simulation thread
+
+inline long long steady_micros(std::chrono::steady_clock::time_point when)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(when.time_since_epoch()).count();
+}
+
+//Lock free triple buffer - one thread publishes whole values, another
+//always reads the newest one, and neither ever waits for the other. The
+//writer fills the back slot and swaps it with the middle one; the reader
+//swaps its front slot with the middle one only when something new is there.
+template <class T>
+class TripleBuffer
+{
+    private:
+        static const int INDEX_MASK = 3;
+        static const int FRESH = 4; //set on the middle slot when it holds an unread value
+
+        T slots[3];
+        std::atomic<int> middle;
+        int back, front;
+    public:
+        TripleBuffer() : middle(1), back(0), front(2) {}
+
+        //writer side - fill write_slot(), then publish() it
+        T *write_slot() { return &slots[back]; }
+        void publish() { back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+
+        //reader side - update() switches read_slot() to the newest value, if there is one
+        bool update()
+        {
+            if (!(middle.load(std::memory_order_relaxed) & FRESH))
+                return false;
+            front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+            return true;
+        }
+        T *read_slot() { return &slots[front]; }
+};
+
+//Everything the renderer needs from one physics step, copied so the
+//simulation can carry on while it is drawn
+struct MatchSnapshot
+{
+    MatchState match; //swarm is NULL in a snapshot, its balls are copied below
+    Rect swarmBalls[MAX_SWARM_BALLS];
+    int swarmCount;
+    long long stepTime; //steady clock microseconds when the step was taken
+    unsigned int appliedInputs; //key changes taken from the InputQueue so far
+    unsigned int skippedInputs; //the first this many were taken without a step, not measured
+};
+
+//One change of the held keys, stamped when the main thread saw it
+struct InputEvent
+{
+    long long time; //steady clock microseconds
+    int leftKeys, rightKeys;
+};
+
+const unsigned int INPUT_QUEUE_SIZE = 256;
+
+//Single producer, single consumer ring - the main thread pushes key
+//changes as they come in, the simulation thread applies them in the step
+//they arrived in. push fails if the simulation has fallen that far behind.
+class InputQueue
+{
+    private:
+        InputEvent events[INPUT_QUEUE_SIZE];
+        std::atomic<unsigned int> head, tail;
+    public:
+        InputQueue() : head(0), tail(0) {}
+
+        bool push(const InputEvent &event)
+        {
+            unsigned int t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) >= INPUT_QUEUE_SIZE)
+                return false;
+            events[t % INPUT_QUEUE_SIZE] = event;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        //oldest event not taken yet, or NULL
+        InputEvent *peek()
+        {
+            unsigned int h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire))
+                return NULL;
+            return &events[h % INPUT_QUEUE_SIZE];
+        }
+
+        void pop() { head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+};
+
+#endif
@@ -0,0 +1,394 @@
+#define _USE_MATH_DEFINES
+#include "swarm.h"
+#include <cmath>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+//paddle values handed to the kernels, all floats
+enum SwarmPaddleValues
+{
+    SWARM_LEFT_FACE,   //x of the left paddle's right edge
+    SWARM_LEFT_TOP,
+    SWARM_LEFT_BOTTOM,
+    SWARM_RIGHT_FACE,  //x the ball's left edge has when touching the right paddle
+    SWARM_RIGHT_TOP,
+    SWARM_RIGHT_BOTTOM,
+    SWARM_PADDLE_VALUES,
+};
+
+BallSwarm::BallSwarm()
+{
+    count = 0;
+}
+
+//Back to the centre, served at a random angle within 60 degrees of flat
+void BallSwarm::respawn(int i)
+{
+    float angle = float((random.next_unit() * 2 - 1) * M_PI / 3);
+    float dir = random.next_bool() ? -1.0f : 1.0f;
+
+    x[i] = (SCREEN_WIDTH - BALL_WIDTH) / 2.0f;
+    y[i] = float(random.next_unit() * (SCREEN_HEIGHT - BALL_WIDTH));
+    vx[i] = dir * BALL_INIT_VEL * cosf(angle);
+    vy[i] = BALL_INIT_VEL * sinf(angle);
+}
+
+void BallSwarm::init(int balls, unsigned int seed)
+{
+    if (balls < 0)
+        balls = 0;
+    if (balls > MAX_SWARM_BALLS)
+        balls = MAX_SWARM_BALLS;
+
+    count = balls;
+    random.seed(seed, STREAM_SWARM);
+    for (int i = 0; i < count; i++)
+        respawn(i);
+}
+
+int BallSwarm::get_count()
+{
+    return count;
+}
+
+Rect BallSwarm::get_ball(int i)
+{
+    Rect pos;
+    pos.x = int(x[i]);
+    pos.y = int(y[i]);
+    pos.w = BALL_WIDTH;
+    pos.h = BALL_WIDTH;
+    return pos;
+}
+
+//One ball, one step. Returns MOVE_LEFT_SCORED/MOVE_RIGHT_SCORED if it got past a paddle.
+int BallSwarm::step_scalar(int i, float *paddles)
+{
+    const float dt = float(SIM_DT);
+    const float bottom = float(SCREEN_HEIGHT - BALL_WIDTH);
+
+    float nx = x[i] + vx[i] * dt;
+    float ny = y[i] + vy[i] * dt;
+
+    //walls
+    if (ny < 0)
+    {
+        ny = -ny;
+        vy[i] = -vy[i];
+    }
+    else if (ny > bottom)
+    {
+        ny = 2 * bottom - ny;
+        vy[i] = -vy[i];
+    }
+
+    //paddle faces, swept along the step
+    bool hit = false;
+    float face = paddles[SWARM_LEFT_FACE];
+    if (vx[i] < 0 && x[i] >= face && nx < face)
+    {
+        float crossY = y[i] + (ny - y[i]) * (face - x[i]) / (nx - x[i]);
+        if (crossY < paddles[SWARM_LEFT_BOTTOM] && crossY + BALL_WIDTH > paddles[SWARM_LEFT_TOP])
+        {
+            nx = 2 * face - nx;
+            vx[i] = -vx[i];
+            hit = true;
+        }
+    }
+    face = paddles[SWARM_RIGHT_FACE];
+    if (vx[i] > 0 && x[i] <= face && nx > face)
+    {
+        float crossY = y[i] + (ny - y[i]) * (face - x[i]) / (nx - x[i]);
+        if (crossY < paddles[SWARM_RIGHT_BOTTOM] && crossY + BALL_WIDTH > paddles[SWARM_RIGHT_TOP])
+        {
+            nx = 2 * face - nx;
+            vx[i] = -vx[i];
+            hit = true;
+        }
+    }
+
+    if (hit)
+    {
+        float speed = sqrtf(vx[i] * vx[i] + vy[i] * vy[i]);
+        float scale = (speed + BALL_SPEED_UP) / speed;
+        vx[i] *= scale;
+        vy[i] *= scale;
+    }
+
+    x[i] = nx;
+    y[i] = ny;
+
+    if (nx < 0)
+        return MOVE_RIGHT_SCORED;
+    else if (nx + BALL_WIDTH > SCREEN_WIDTH)
+        return MOVE_LEFT_SCORED;
+    return MOVE_NONE;
+}
+
+#if defined(__AVX2__)
+//Same as step_scalar, 8 balls at a time
+void BallSwarm::step_simd(int *leftPoints, int *rightPoints, float *paddles)
+{
+    const __m256 dt = _mm256_set1_ps(float(SIM_DT));
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 bottom = _mm256_set1_ps(float(SCREEN_HEIGHT - BALL_WIDTH));
+    const __m256 width = _mm256_set1_ps(float(BALL_WIDTH));
+    const __m256 right = _mm256_set1_ps(float(SCREEN_WIDTH - BALL_WIDTH));
+    const __m256 speedUp = _mm256_set1_ps(float(BALL_SPEED_UP));
+    const __m256 leftFace = _mm256_set1_ps(paddles[SWARM_LEFT_FACE]);
+    const __m256 leftTop = _mm256_set1_ps(paddles[SWARM_LEFT_TOP]);
+    const __m256 leftBottom = _mm256_set1_ps(paddles[SWARM_LEFT_BOTTOM]);
+    const __m256 rightFace = _mm256_set1_ps(paddles[SWARM_RIGHT_FACE]);
+    const __m256 rightTop = _mm256_set1_ps(paddles[SWARM_RIGHT_TOP]);
+    const __m256 rightBottom = _mm256_set1_ps(paddles[SWARM_RIGHT_BOTTOM]);
+    const __m256 two = _mm256_set1_ps(2.0f);
+
+    int simdCount = count & ~7;
+    for (int i = 0; i < simdCount; i += 8)
+    {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        __m256 vxs = _mm256_loadu_ps(vx + i);
+        __m256 vys = _mm256_loadu_ps(vy + i);
+
+        __m256 nx = _mm256_add_ps(px, _mm256_mul_ps(vxs, dt));
+        __m256 ny = _mm256_add_ps(py, _mm256_mul_ps(vys, dt));
+
+        //walls
+        __m256 top = _mm256_cmp_ps(ny, zero, _CMP_LT_OQ);
+        __m256 low = _mm256_cmp_ps(ny, bottom, _CMP_GT_OQ);
+        ny = _mm256_blendv_ps(ny, _mm256_sub_ps(zero, ny), top);
+        ny = _mm256_blendv_ps(ny, _mm256_sub_ps(_mm256_mul_ps(two, bottom), ny), low);
+        vys = _mm256_blendv_ps(vys, _mm256_sub_ps(zero, vys), _mm256_or_ps(top, low));
+
+        //both paddle faces, swept along the step
+        __m256 crossT, crossY;
+        __m256 hitLeft = _mm256_and_ps(_mm256_cmp_ps(vxs, zero, _CMP_LT_OQ),
+                         _mm256_and_ps(_mm256_cmp_ps(px, leftFace, _CMP_GE_OQ), _mm256_cmp_ps(nx, leftFace, _CMP_LT_OQ)));
+        crossT = _mm256_div_ps(_mm256_sub_ps(leftFace, px), _mm256_sub_ps(nx, px));
+        crossY = _mm256_add_ps(py, _mm256_mul_ps(_mm256_sub_ps(ny, py), crossT));
+        hitLeft = _mm256_and_ps(hitLeft, _mm256_and_ps(_mm256_cmp_ps(crossY, leftBottom, _CMP_LT_OQ),
+                                                       _mm256_cmp_ps(_mm256_add_ps(crossY, width), leftTop, _CMP_GT_OQ)));
+
+        __m256 hitRight = _mm256_and_ps(_mm256_cmp_ps(vxs, zero, _CMP_GT_OQ),
+                          _mm256_and_ps(_mm256_cmp_ps(px, rightFace, _CMP_LE_OQ), _mm256_cmp_ps(nx, rightFace, _CMP_GT_OQ)));
+        crossT = _mm256_div_ps(_mm256_sub_ps(rightFace, px), _mm256_sub_ps(nx, px));
+        crossY = _mm256_add_ps(py, _mm256_mul_ps(_mm256_sub_ps(ny, py), crossT));
+        hitRight = _mm256_and_ps(hitRight, _mm256_and_ps(_mm256_cmp_ps(crossY, rightBottom, _CMP_LT_OQ),
+                                                         _mm256_cmp_ps(_mm256_add_ps(crossY, width), rightTop, _CMP_GT_OQ)));
+
+        __m256 hit = _mm256_or_ps(hitLeft, hitRight);
+        __m256 face = _mm256_blendv_ps(rightFace, leftFace, hitLeft);
+        nx = _mm256_blendv_ps(nx, _mm256_sub_ps(_mm256_mul_ps(two, face), nx), hit);
+
+        //bounce and speed up, keeping the direction
+        __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vxs, vxs), _mm256_mul_ps(vys, vys)));
+        __m256 scale = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_div_ps(_mm256_add_ps(speed, speedUp), speed), hit);
+        vxs = _mm256_blendv_ps(vxs, _mm256_sub_ps(zero, vxs), hit);
+        vxs = _mm256_mul_ps(vxs, scale);
+        vys = _mm256_mul_ps(vys, scale);
+
+        _mm256_storeu_ps(x + i, nx);
+        _mm256_storeu_ps(y + i, ny);
+        _mm256_storeu_ps(vx + i, vxs);
+        _mm256_storeu_ps(vy + i, vys);
+
+        //anything past a paddle scores and comes back, rare enough to do one by one
+        int outLeft = _mm256_movemask_ps(_mm256_cmp_ps(nx, zero, _CMP_LT_OQ));
+        int outRight = _mm256_movemask_ps(_mm256_cmp_ps(nx, right, _CMP_GT_OQ));
+        for (int lane = 0; (outLeft | outRight) != 0; lane++, outLeft >>= 1, outRight >>= 1)
+        {
+            if (outLeft & 1)
+            {
+                (*rightPoints)++;
+                respawn(i + lane);
+            }
+            else if (outRight & 1)
+            {
+                (*leftPoints)++;
+                respawn(i + lane);
+            }
+        }
+    }
+
+    for (int i = simdCount; i < count; i++)
+    {
+        switch (step_scalar(i, paddles))
+        {
+            case MOVE_LEFT_SCORED:
+                (*leftPoints)++;
+                respawn(i);
+                break;
+            case MOVE_RIGHT_SCORED:
+                (*rightPoints)++;
+                respawn(i);
+                break;
+            default:
+                break;
+        }
+    }
+}
+#elif defined(__SSE2__) || defined(_M_X64)
+//SSE2 has no blend, so select with and/andnot/or
+inline __m128 select_ps(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+//Same as step_scalar, 4 balls at a time
+void BallSwarm::step_simd(int *leftPoints, int *rightPoints, float *paddles)
+{
+    const __m128 dt = _mm_set1_ps(float(SIM_DT));
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 bottom = _mm_set1_ps(float(SCREEN_HEIGHT - BALL_WIDTH));
+    const __m128 width = _mm_set1_ps(float(BALL_WIDTH));
+    const __m128 right = _mm_set1_ps(float(SCREEN_WIDTH - BALL_WIDTH));
+    const __m128 speedUp = _mm_set1_ps(float(BALL_SPEED_UP));
+    const __m128 leftFace = _mm_set1_ps(paddles[SWARM_LEFT_FACE]);
+    const __m128 leftTop = _mm_set1_ps(paddles[SWARM_LEFT_TOP]);
+    const __m128 leftBottom = _mm_set1_ps(paddles[SWARM_LEFT_BOTTOM]);
+    const __m128 rightFace = _mm_set1_ps(paddles[SWARM_RIGHT_FACE]);
+    const __m128 rightTop = _mm_set1_ps(paddles[SWARM_RIGHT_TOP]);
+    const __m128 rightBottom = _mm_set1_ps(paddles[SWARM_RIGHT_BOTTOM]);
+    const __m128 two = _mm_set1_ps(2.0f);
+
+    int simdCount = count & ~3;
+    for (int i = 0; i < simdCount; i += 4)
+    {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 vxs = _mm_loadu_ps(vx + i);
+        __m128 vys = _mm_loadu_ps(vy + i);
+
+        __m128 nx = _mm_add_ps(px, _mm_mul_ps(vxs, dt));
+        __m128 ny = _mm_add_ps(py, _mm_mul_ps(vys, dt));
+
+        //walls
+        __m128 top = _mm_cmplt_ps(ny, zero);
+        __m128 low = _mm_cmpgt_ps(ny, bottom);
+        ny = select_ps(top, _mm_sub_ps(zero, ny), ny);
+        ny = select_ps(low, _mm_sub_ps(_mm_mul_ps(two, bottom), ny), ny);
+        vys = select_ps(_mm_or_ps(top, low), _mm_sub_ps(zero, vys), vys);
+
+        //both paddle faces, swept along the step
+        __m128 crossT, crossY;
+        __m128 hitLeft = _mm_and_ps(_mm_cmplt_ps(vxs, zero),
+                         _mm_and_ps(_mm_cmpge_ps(px, leftFace), _mm_cmplt_ps(nx, leftFace)));
+        crossT = _mm_div_ps(_mm_sub_ps(leftFace, px), _mm_sub_ps(nx, px));
+        crossY = _mm_add_ps(py, _mm_mul_ps(_mm_sub_ps(ny, py), crossT));
+        hitLeft = _mm_and_ps(hitLeft, _mm_and_ps(_mm_cmplt_ps(crossY, leftBottom),
+                                                 _mm_cmpgt_ps(_mm_add_ps(crossY, width), leftTop)));
+
+        __m128 hitRight = _mm_and_ps(_mm_cmpgt_ps(vxs, zero),
+                          _mm_and_ps(_mm_cmple_ps(px, rightFace), _mm_cmpgt_ps(nx, rightFace)));
+        crossT = _mm_div_ps(_mm_sub_ps(rightFace, px), _mm_sub_ps(nx, px));
+        crossY = _mm_add_ps(py, _mm_mul_ps(_mm_sub_ps(ny, py), crossT));
+        hitRight = _mm_and_ps(hitRight, _mm_and_ps(_mm_cmplt_ps(crossY, rightBottom),
+                                                   _mm_cmpgt_ps(_mm_add_ps(crossY, width), rightTop)));
+
+        __m128 hit = _mm_or_ps(hitLeft, hitRight);
+        __m128 face = select_ps(hitLeft, leftFace, rightFace);
+        nx = select_ps(hit, _mm_sub_ps(_mm_mul_ps(two, face), nx), nx);
+
+        //bounce and speed up, keeping the direction
+        __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vxs, vxs), _mm_mul_ps(vys, vys)));
+        __m128 scale = select_ps(hit, _mm_div_ps(_mm_add_ps(speed, speedUp), speed), _mm_set1_ps(1.0f));
+        vxs = select_ps(hit, _mm_sub_ps(zero, vxs), vxs);
+        vxs = _mm_mul_ps(vxs, scale);
+        vys = _mm_mul_ps(vys, scale);
+
+        _mm_storeu_ps(x + i, nx);
+        _mm_storeu_ps(y + i, ny);
+        _mm_storeu_ps(vx + i, vxs);
+        _mm_storeu_ps(vy + i, vys);
+
+        //anything past a paddle scores and comes back, rare enough to do one by one
+        int outLeft = _mm_movemask_ps(_mm_cmplt_ps(nx, zero));
+        int outRight = _mm_movemask_ps(_mm_cmpgt_ps(nx, right));
+        for (int lane = 0; (outLeft | outRight) != 0; lane++, outLeft >>= 1, outRight >>= 1)
+        {
+            if (outLeft & 1)
+            {
+                (*rightPoints)++;
+                respawn(i + lane);
+            }
+            else if (outRight & 1)
+            {
+                (*leftPoints)++;
+                respawn(i + lane);
+            }
+        }
+    }
+
+    for (int i = simdCount; i < count; i++)
+    {
+        switch (step_scalar(i, paddles))
+        {
+            case MOVE_LEFT_SCORED:
+                (*leftPoints)++;
+                respawn(i);
+                break;
+            case MOVE_RIGHT_SCORED:
+                (*rightPoints)++;
+                respawn(i);
+                break;
+            default:
+                break;
+        }
+    }
+}
+#else
+//No SIMD on this target
+void BallSwarm::step_simd(int *leftPoints, int *rightPoints, float *paddles)
+{
+    for (int i = 0; i < count; i++)
+    {
+        switch (step_scalar(i, paddles))
+        {
+            case MOVE_LEFT_SCORED:
+                (*leftPoints)++;
+                respawn(i);
+                break;
+            case MOVE_RIGHT_SCORED:
+                (*rightPoints)++;
+                respawn(i);
+                break;
+            default:
+                break;
+        }
+    }
+}
+#endif
+
+//Move every ball one step, adding up the points scored
+void BallSwarm::step(Rect *leftPad, Rect *rightPad, int *leftPoints, int *rightPoints)
+{
+    float paddles[SWARM_PADDLE_VALUES];
+
+    paddles[SWARM_LEFT_FACE] = float(leftPad->x + leftPad->w);
+    paddles[SWARM_LEFT_TOP] = float(leftPad->y);
+    paddles[SWARM_LEFT_BOTTOM] = float(leftPad->y + leftPad->h);
+    paddles[SWARM_RIGHT_FACE] = float(rightPad->x - BALL_WIDTH);
+    paddles[SWARM_RIGHT_TOP] = float(rightPad->y);
+    paddles[SWARM_RIGHT_BOTTOM] = float(rightPad->y + rightPad->h);
+
+    step_simd(leftPoints, rightPoints, paddles);
+}
+
+//Multi-ball mode - serve the swarm from the match seed, and scale the
+//score limit up since every ball can score
+void match_add_swarm(MatchState *match, BallSwarm *swarm, int balls)
+{
+    if (balls <= 0)
+    {
+        match->swarm = NULL;
+        return;
+    }
+
+    swarm->init(balls, match->seed);
+    match->swarm = swarm;
+    match->scoreLimit = SCORE_LIMIT * (swarm->get_count() + 1);
+}
@@ -0,0 +1,38 @@
+#ifndef SWARM_H
+#define SWARM_H
+
+#include "sim.h"
+
+//most balls in multi-ball mode
+const int MAX_SWARM_BALLS = 4096;
+
+//Ball swarm - extra balls for multi-ball mode. Positions and velocities are
+//kept as separate float arrays (structure of arrays) so walls and both
+//paddles can be tested against 4 (SSE2) or 8 (AVX2) balls at once.
+//The swarm lives inside Game, whose static storage (build_state) is only
+//aligned as far as Game needs, so the arrays aren't guaranteed SIMD
+//alignment and the kernels use unaligned loads.
+class BallSwarm
+{
+    private:
+        float x[MAX_SWARM_BALLS];
+        float y[MAX_SWARM_BALLS];
+        float vx[MAX_SWARM_BALLS];
+        float vy[MAX_SWARM_BALLS];
+        int count;
+        SplitMix random;
+
+        void respawn(int i);
+        int step_scalar(int i, float *paddles);
+        void step_simd(int *leftPoints, int *rightPoints, float *paddles);
+    public:
+        BallSwarm();
+        void init(int balls, unsigned int seed);
+        int get_count();
+        Rect get_ball(int i);
+        void step(Rect *leftPad, Rect *rightPad, int *leftPoints, int *rightPoints);
+};
+
+void match_add_swarm(MatchState *match, BallSwarm *swarm, int balls);
+
+#endif
@@ -0,0 +1,330 @@
+#include "text.h"
+#include "fontdata.h"
+#include <cstring>
+
+//Copy the glyph pixels of source into destination, keeping whichever pixel
+//is more opaque. Both surfaces are 32 bit, same format, single colour text,
+//so overlapping glyph cells merge instead of erasing each other.
+void blit_max_alpha(SDL_Surface *source, SDL_Rect *clip, SDL_Surface *destination, int x, int y)
+{
+    Uint32 alphaMask = source->format->Amask;
+
+    if (SDL_MUSTLOCK(source))
+        SDL_LockSurface(source);
+    if (SDL_MUSTLOCK(destination))
+        SDL_LockSurface(destination);
+
+    for (int row = 0; row < clip->h; row++)
+    {
+        if (y + row < 0 || y + row >= destination->h)
+            continue;
+
+        Uint32 *src = (Uint32 *)((Uint8 *)source->pixels + (clip->y + row) * source->pitch) + clip->x;
+        Uint32 *dst = (Uint32 *)((Uint8 *)destination->pixels + (y + row) * destination->pitch);
+
+        for (int col = 0; col < clip->w; col++)
+        {
+            if (x + col < 0 || x + col >= destination->w)
+                continue;
+            if ((src[col] & alphaMask) > (dst[x + col] & alphaMask))
+                dst[x + col] = src[col];
+        }
+    }
+
+    if (SDL_MUSTLOCK(destination))
+        SDL_UnlockSurface(destination);
+    if (SDL_MUSTLOCK(source))
+        SDL_UnlockSurface(source);
+}
+
+GlyphAtlas::GlyphAtlas()
+{
+    sheet = NULL;
+    height = 0;
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        cells[i].x = 0;
+        cells[i].y = 0;
+        cells[i].w = 0;
+        cells[i].h = 0;
+        advances[i] = 0;
+    }
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    free_sheet();
+}
+
+//Render every glyph once and pack them into a grid on one sheet
+bool GlyphAtlas::build(TTF_Font *font, SDL_Color color)
+{
+    SDL_Surface *glyphs[GLYPH_COUNT];
+    SDL_Surface *first = NULL;
+    int cellWidth = 0;
+
+    free_sheet();
+    height = TTF_FontHeight(font);
+
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        char str[2] = {char(FIRST_GLYPH + i), '\0'};
+        int advance = 0;
+
+        glyphs[i] = TTF_RenderText_Blended(font, str, color);
+        if (TTF_GlyphMetrics(font, FIRST_GLYPH + i, NULL, NULL, NULL, NULL, &advance) == -1)
+            advance = 0;
+        advances[i] = advance;
+
+        if (glyphs[i] == NULL)
+            continue;
+        if (first == NULL)
+            first = glyphs[i];
+        if (glyphs[i]->w > cellWidth)
+            cellWidth = glyphs[i]->w;
+    }
+
+    if (first == NULL)
+        return false;
+
+    int rows = (GLYPH_COUNT + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+    SDL_PixelFormat *fmt = first->format;
+    sheet = SDL_CreateRGBSurface(SDL_SWSURFACE, ATLAS_COLUMNS * cellWidth, rows * height, 32,
+                                 fmt->Rmask, fmt->Gmask, fmt->Bmask, fmt->Amask);
+
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        if (glyphs[i] == NULL)
+            continue;
+
+        if (sheet != NULL)
+        {
+            cells[i].x = (i % ATLAS_COLUMNS) * cellWidth;
+            cells[i].y = (i / ATLAS_COLUMNS) * height;
+            cells[i].w = glyphs[i]->w;
+            cells[i].h = glyphs[i]->h < height ? glyphs[i]->h : height;
+
+            //copy the alpha channel as is rather than blending it
+            SDL_SetAlpha(glyphs[i], 0, SDL_ALPHA_OPAQUE);
+            SDL_Rect offset = cells[i];
+            SDL_BlitSurface(glyphs[i], NULL, sheet, &offset);
+        }
+        SDL_FreeSurface(glyphs[i]);
+    }
+
+    if (sheet == NULL)
+        return false;
+
+    SDL_SetAlpha(sheet, SDL_SRCALPHA, SDL_ALPHA_OPAQUE);
+    return true;
+}
+
+//Same layout as build, from the glyphs fontbake baked into fontdata.h
+bool GlyphAtlas::build_baked(int size, SDL_Color color)
+{
+    const BakedFont *baked = NULL;
+    for (int i = 0; i < BAKED_FONT_COUNT; i++)
+    {
+        if (BAKED_FONTS[i]->size == size)
+            baked = BAKED_FONTS[i];
+    }
+    if (baked == NULL)
+        return false;
+
+    free_sheet();
+    height = baked->height;
+
+    int cellWidth = 1;
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        if (baked->glyphs[i].width > cellWidth)
+            cellWidth = baked->glyphs[i].width;
+    }
+
+    //the pixel layout TTF_RenderText_Blended gives
+    int rows = (GLYPH_COUNT + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+    sheet = SDL_CreateRGBSurface(SDL_SWSURFACE, ATLAS_COLUMNS * cellWidth, rows * height, 32,
+                                 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    if (sheet == NULL)
+        return false;
+
+    SDL_FillRect(sheet, NULL, 0);
+    Uint32 rgb = (color.r << 16) | (color.g << 8) | color.b;
+
+    if (SDL_MUSTLOCK(sheet))
+        SDL_LockSurface(sheet);
+
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        const BakedGlyph &glyph = baked->glyphs[i];
+        cells[i].x = (i % ATLAS_COLUMNS) * cellWidth;
+        cells[i].y = (i / ATLAS_COLUMNS) * height;
+        cells[i].w = glyph.width;
+        cells[i].h = height;
+        advances[i] = glyph.advance;
+
+        //unpack the runs row by row into the glyph's place in its cell
+        const unsigned char *run = baked->runs + glyph.runs;
+        for (int row = 0; row < glyph.h; row++)
+        {
+            Uint32 *dst = (Uint32 *)((Uint8 *)sheet->pixels + (cells[i].y + glyph.top + row) * sheet->pitch)
+                          + cells[i].x + glyph.left;
+            for (int col = 0; col < glyph.w; run += 2)
+            {
+                for (int n = 0; n < run[0]; n++)
+                    dst[col++] = rgb | (Uint32(run[1]) << 24);
+            }
+        }
+    }
+
+    if (SDL_MUSTLOCK(sheet))
+        SDL_UnlockSurface(sheet);
+
+    SDL_SetAlpha(sheet, SDL_SRCALPHA, SDL_ALPHA_OPAQUE);
+    return true;
+}
+
+void GlyphAtlas::free_sheet()
+{
+    if (sheet != NULL)
+        SDL_FreeSurface(sheet);
+    sheet = NULL;
+}
+
+int GlyphAtlas::get_height()
+{
+    return height;
+}
+
+int GlyphAtlas::text_width(const char *text)
+{
+    int pen = 0, width = 0;
+
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        int i = *c - FIRST_GLYPH;
+        if (i < 0 || i >= GLYPH_COUNT)
+            continue;
+        if (pen + cells[i].w > width)
+            width = pen + cells[i].w;
+        pen += advances[i];
+    }
+
+    if (pen > width)
+        width = pen;
+    return width;
+}
+
+void GlyphAtlas::draw(int x, int y, const char *text, SDL_Surface *destination)
+{
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        int i = *c - FIRST_GLYPH;
+        if (i < 0 || i >= GLYPH_COUNT)
+            continue;
+
+        SDL_Rect offset;
+        offset.x = x;
+        offset.y = y;
+        SDL_BlitSurface(sheet, &cells[i], destination, &offset);
+        x += advances[i];
+    }
+}
+
+//Make a surface wide enough for any string of up to length glyphs, caller frees it
+SDL_Surface *GlyphAtlas::create_surface(int length)
+{
+    if (sheet == NULL)
+        return NULL;
+
+    int widestCell = 1, widestAdvance = 0;
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        if (cells[i].w > widestCell)
+            widestCell = cells[i].w;
+        if (advances[i] > widestAdvance)
+            widestAdvance = advances[i];
+    }
+
+    SDL_PixelFormat *fmt = sheet->format;
+    SDL_Surface *surface = SDL_CreateRGBSurface(SDL_SWSURFACE, (length - 1) * widestAdvance + widestCell, height, 32,
+                                                fmt->Rmask, fmt->Gmask, fmt->Bmask, fmt->Amask);
+    if (surface != NULL)
+        SDL_SetAlpha(surface, SDL_SRCALPHA, SDL_ALPHA_OPAQUE);
+    return surface;
+}
+
+//Draw the whole string at the left of surface, returns how wide it came out
+int GlyphAtlas::compose(const char *text, SDL_Surface *surface)
+{
+    if (sheet == NULL || surface == NULL)
+        return 0;
+
+    SDL_FillRect(surface, NULL, 0);
+
+    int pen = 0;
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        int i = *c - FIRST_GLYPH;
+        if (i < 0 || i >= GLYPH_COUNT)
+            continue;
+        blit_max_alpha(sheet, &cells[i], surface, pen, 0);
+        pen += advances[i];
+    }
+
+    int width = text_width(text);
+    return width < surface->w ? width : surface->w;
+}
+
+CachedText::CachedText()
+{
+    atlas = NULL;
+    surface = NULL;
+    text[0] = '\0';
+    width = 0;
+    composed = false;
+}
+
+CachedText::~CachedText()
+{
+    if (surface != NULL)
+        SDL_FreeSurface(surface);
+}
+
+void CachedText::init(GlyphAtlas *glyphs)
+{
+    atlas = glyphs;
+    if (surface == NULL)
+        surface = atlas->create_surface(CACHED_TEXT_LENGTH - 1);
+}
+
+void CachedText::set(const char *newText)
+{
+    if (composed && strcmp(text, newText) == 0)
+        return;
+
+    strncpy(text, newText, CACHED_TEXT_LENGTH - 1);
+    text[CACHED_TEXT_LENGTH - 1] = '\0';
+    width = atlas->compose(text, surface);
+    composed = true;
+}
+
+int CachedText::get_width()
+{
+    return width;
+}
+
+int CachedText::get_height()
+{
+    return surface != NULL ? surface->h : 0;
+}
+
+void CachedText::draw(int x, int y, SDL_Surface *destination)
+{
+    if (surface == NULL)
+        return;
+
+    SDL_Rect used = {0, 0, Uint16(width), Uint16(surface->h)};
+    SDL_Rect offset = {Sint16(x), Sint16(y), 0, 0};
+    SDL_BlitSurface(surface, &used, destination, &offset);
+}
@@ -0,0 +1,55 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include "SDL/SDL.h"
+#include "SDL/SDL_ttf.h"
+#include "bakedfont.h"
+
+//longest string a CachedText holds
+const int CACHED_TEXT_LENGTH = 32;
+
+//Glyph atlas - every glyph of one font rendered once into a single sheet,
+//so drawing text is just blits. Built from the glyphs baked into the
+//binary, or from the font file when none were baked at that size.
+class GlyphAtlas
+{
+    private:
+        SDL_Surface *sheet;
+        SDL_Rect cells[GLYPH_COUNT];
+        int advances[GLYPH_COUNT];
+        int height;
+    public:
+        GlyphAtlas();
+        ~GlyphAtlas();
+        bool build(TTF_Font *font, SDL_Color color);
+        bool build_baked(int size, SDL_Color color);
+        void free_sheet();
+        int get_height();
+        int text_width(const char *text);
+        void draw(int x, int y, const char *text, SDL_Surface *destination);
+        SDL_Surface *create_surface(int length);
+        int compose(const char *text, SDL_Surface *surface);
+};
+
+//Pre-composed string - only re-composed from the atlas when the text
+//changes, into a surface made once up front that fits any string it can
+//hold, so changing the text never allocates
+class CachedText
+{
+    private:
+        GlyphAtlas *atlas;
+        SDL_Surface *surface;
+        char text[CACHED_TEXT_LENGTH];
+        int width;
+        bool composed;
+    public:
+        CachedText();
+        ~CachedText();
+        void init(GlyphAtlas *glyphs);
+        void set(const char *newText);
+        int get_width();
+        int get_height();
+        void draw(int x, int y, SDL_Surface *destination);
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include "timers.h"
+
+TimerWheel::TimerWheel()
+{
+    clear();
+}
+
+//Drop every timer and start counting from step 0
+void TimerWheel::clear()
+{
+    for (int level = 0; level < WHEEL_LEVELS; level++)
+    {
+        for (int i = 0; i < WHEEL_SLOTS; i++)
+            slots[level][i] = -1;
+    }
+
+    for (int i = 0; i < MAX_TIMERS; i++)
+        timers[i].next = i + 1 < MAX_TIMERS ? i + 1 : -1;
+    freeTimers = 0;
+    dueTimers = -1;
+    now = 0;
+}
+
+//File a timer under the slot its deadline falls in. Anything further off
+//than level 1 reaches waits in its last slot and is filed again from there.
+void TimerWheel::insert(int index)
+{
+    WheelTimer &timer = timers[index];
+    long long ahead = timer.deadline - now;
+    int *slot;
+
+    if (ahead < WHEEL_SLOTS)
+        slot = &slots[0][timer.deadline & WHEEL_MASK];
+    else if (ahead < WHEEL_SLOTS * WHEEL_SLOTS)
+        slot = &slots[1][(timer.deadline >> WHEEL_BITS) & WHEEL_MASK];
+    else
+        slot = &slots[1][((now >> WHEEL_BITS) + WHEEL_MASK) & WHEEL_MASK];
+
+    timer.next = *slot;
+    *slot = index;
+}
+
+//Fire event (with data) steps from now, at least one. False when every timer is taken.
+bool TimerWheel::schedule(int steps, int event, int data)
+{
+    if (freeTimers < 0)
+        return false;
+    if (steps < 1)
+        steps = 1;
+
+    int index = freeTimers;
+    freeTimers = timers[index].next;
+
+    timers[index].deadline = now + steps;
+    timers[index].event = event;
+    timers[index].data = data;
+    insert(index);
+    return true;
+}
+
+//Move on one step - the timers due on it are then taken with next_due,
+//timers scheduled from here on count from this step
+void TimerWheel::advance()
+{
+    now++;
+
+    //a new block of steps, bring its timers down to level 0
+    if ((now & WHEEL_MASK) == 0)
+    {
+        int *slot = &slots[1][(now >> WHEEL_BITS) & WHEEL_MASK];
+        int index = *slot;
+        *slot = -1;
+        while (index >= 0)
+        {
+            int next = timers[index].next;
+            insert(index);
+            index = next;
+        }
+    }
+
+    int *slot = &slots[0][now & WHEEL_MASK];
+    dueTimers = *slot;
+    *slot = -1;
+}
+
+bool TimerWheel::next_due(int *event, int *data)
+{
+    if (dueTimers < 0)
+        return false;
+
+    int index = dueTimers;
+    dueTimers = timers[index].next;
+    *event = timers[index].event;
+    *data = timers[index].data;
+
+    timers[index].next = freeTimers;
+    freeTimers = index;
+    return true;
+}
+
+long long TimerWheel::get_now()
+{
+    return now;
+}
@@ -0,0 +1,45 @@
+#ifndef TIMERS_H
+#define TIMERS_H
+
+//Hierarchical timer wheel, counting simulation steps. Level 0 has a slot
+//for each of the next WHEEL_SLOTS steps, level 1 a slot for each of the
+//next WHEEL_SLOTS blocks of WHEEL_SLOTS steps; a level 1 slot is cascaded
+//down into level 0 when its block comes round. Scheduling and firing are
+//O(1), and everything lives in fixed arrays so a match holding one copies
+//like any other state. Timers due on the same step fire in no set order.
+const int WHEEL_BITS = 6;
+const int WHEEL_SLOTS = 1 << WHEEL_BITS;
+const int WHEEL_MASK = WHEEL_SLOTS - 1;
+const int WHEEL_LEVELS = 2;
+
+//timers pending at once
+const int MAX_TIMERS = 16;
+
+struct WheelTimer
+{
+    long long deadline;
+    int event;
+    int data;
+    int next; //index of the next timer in the same list, or -1
+};
+
+class TimerWheel
+{
+    private:
+        WheelTimer timers[MAX_TIMERS];
+        int slots[WHEEL_LEVELS][WHEEL_SLOTS];
+        int freeTimers;
+        int dueTimers;
+        long long now;
+
+        void insert(int index);
+    public:
+        TimerWheel();
+        void clear();
+        bool schedule(int steps, int event, int data);
+        void advance();
+        bool next_due(int *event, int *data);
+        long long get_now();
+};
+
+#endif
@@ -0,0 +1,224 @@
+#include "tournament.h"
+#include <cstring>
+#include <thread>
+#include <vector>
+
+void stats_clear(TournamentStats *stats)
+{
+    memset(stats, 0, sizeof(TournamentStats));
+}
+
+void stats_merge(TournamentStats *into, TournamentStats *from)
+{
+    into->matches += from->matches;
+    into->leftWins += from->leftWins;
+    into->rightWins += from->rightWins;
+    into->unfinished += from->unfinished;
+    into->steps += from->steps;
+    into->points += from->points;
+    for (int i = 0; i < RALLY_BUCKETS; i++)
+        into->rallies[i] += from->rallies[i];
+    for (int i = 0; i < SPEED_BUCKETS; i++)
+        into->speeds[i] += from->speeds[i];
+}
+
+//Simple bot - chase the centre of the ball
+int track_ball(Paddle &paddle, Ball &ball)
+{
+    Rect *pad = paddle.get_position();
+    Rect *pos = ball.get_position();
+    int padCentre = pad->y + pad->h/2;
+    int ballCentre = pos->y + pos->h/2;
+
+    if (ballCentre < padCentre - pad->h/4)
+        return INPUT_UP;
+    else if (ballCentre > padCentre + pad->h/4)
+        return INPUT_DOWN;
+
+    return INPUT_NONE;
+}
+
+//Play one bot vs bot match to the end and add it to stats
+void play_match(MatchState *match, unsigned int seed, TournamentStats *stats)
+{
+    match_init(match, seed);
+
+    int steps = 0;
+    while (!match->endGame && steps < MAX_MATCH_STEPS)
+    {
+        int leftInput = track_ball(match->leftPaddle, match->theBall);
+        int rightInput = track_ball(match->rightPaddle, match->theBall);
+
+        if (match_step(match, leftInput, rightInput) != MOVE_NONE)
+        {
+            //every paddle hit adds BALL_SPEED_UP, so the speed gives the rally length
+            double speed = match->theBall.get_speed();
+            int rally = int((speed - BALL_INIT_VEL) / BALL_SPEED_UP + 0.5);
+            int bucket = int(speed) / SPEED_BUCKET_WIDTH;
+
+            stats->rallies[rally < RALLY_BUCKETS ? rally : RALLY_BUCKETS - 1]++;
+            stats->speeds[bucket < SPEED_BUCKETS ? bucket : SPEED_BUCKETS - 1]++;
+            stats->points++;
+        }
+        steps++;
+    }
+
+    stats->matches++;
+    stats->steps += steps;
+    if (!match->endGame)
+        stats->unfinished++;
+    else if (match->leftScore >= match->scoreLimit)
+        stats->leftWins++;
+    else
+        stats->rightWins++;
+}
+
+unsigned long long pack_range(unsigned int first, unsigned int end)
+{
+    return ((unsigned long long)first << 32) | end;
+}
+
+Tournament::Tournament()
+{
+    workers = NULL;
+    threadCount = 0;
+    seed = 0;
+    steals = 0;
+    stats_clear(&total);
+}
+
+Tournament::~Tournament()
+{
+    delete[] workers;
+}
+
+//Owner side - take up to TOURNAMENT_CHUNK matches off the front of our own range
+bool Tournament::take_chunk(TournamentWorker *worker, unsigned int *first, unsigned int *end)
+{
+    unsigned long long range = worker->range.load(std::memory_order_acquire);
+
+    for (;;)
+    {
+        unsigned int rangeFirst = (unsigned int)(range >> 32);
+        unsigned int rangeEnd = (unsigned int)range;
+        if (rangeFirst >= rangeEnd)
+            return false;
+
+        unsigned int count = rangeEnd - rangeFirst;
+        if (count > TOURNAMENT_CHUNK)
+            count = TOURNAMENT_CHUNK;
+
+        //a failed CAS reloads range, a thief may have shortened it
+        if (worker->range.compare_exchange_weak(range, pack_range(rangeFirst + count, rangeEnd),
+                                                std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            *first = rangeFirst;
+            *end = rangeFirst + count;
+            return true;
+        }
+    }
+}
+
+//Thief side - split off the back half of the first worker with more than one match left
+bool Tournament::steal(int thief)
+{
+    for (int k = 1; k < threadCount; k++)
+    {
+        TournamentWorker *victim = &workers[(thief + k) % threadCount];
+        unsigned long long range = victim->range.load(std::memory_order_acquire);
+
+        for (;;)
+        {
+            unsigned int rangeFirst = (unsigned int)(range >> 32);
+            unsigned int rangeEnd = (unsigned int)range;
+            if (rangeFirst + 1 >= rangeEnd)
+                break;
+
+            unsigned int middle = rangeFirst + (rangeEnd - rangeFirst) / 2;
+            if (victim->range.compare_exchange_weak(range, pack_range(rangeFirst, middle),
+                                                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                //our range is empty, so no one else can be changing it
+                workers[thief].range.store(pack_range(middle, rangeEnd), std::memory_order_release);
+                workers[thief].steals++;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void Tournament::work(int id)
+{
+    TournamentWorker *worker = &workers[id];
+    MatchState match;
+    unsigned int first, end;
+
+    for (;;)
+    {
+        if (!take_chunk(worker, &first, &end))
+        {
+            if (!steal(id))
+                return;
+            continue;
+        }
+
+        for (unsigned int i = first; i < end; i++)
+            play_match(&match, seed + i, &worker->stats);
+    }
+}
+
+//Play matches, seeded firstSeed, firstSeed + 1, ... across threads (0 for one per core)
+void Tournament::run(unsigned int matches, unsigned int firstSeed, int threads)
+{
+    if (threads <= 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads <= 0)
+        threads = 1;
+
+    delete[] workers;
+    workers = new TournamentWorker[threads];
+    threadCount = threads;
+    seed = firstSeed;
+
+    //equal slices to start with, stealing evens out the rest
+    for (int i = 0; i < threads; i++)
+    {
+        unsigned int first = (unsigned int)((unsigned long long)matches * i / threads);
+        unsigned int end = (unsigned int)((unsigned long long)matches * (i + 1) / threads);
+        workers[i].range.store(pack_range(first, end));
+        stats_clear(&workers[i].stats);
+        workers[i].steals = 0;
+    }
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++)
+        pool.push_back(std::thread(&Tournament::work, this, i));
+    work(0);
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].join();
+
+    stats_clear(&total);
+    steals = 0;
+    for (int i = 0; i < threads; i++)
+    {
+        stats_merge(&total, &workers[i].stats);
+        steals += workers[i].steals;
+    }
+}
+
+TournamentStats *Tournament::get_stats()
+{
+    return &total;
+}
+
+long long Tournament::get_steals()
+{
+    return steals;
+}
+
+int Tournament::get_threads()
+{
+    return threadCount;
+}
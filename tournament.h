@@ -0,0 +1,77 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include "sim.h"
+#include <atomic>
+
+//rally lengths (paddle hits before a point) kept exactly up to this, longer ones share the last bucket
+const int RALLY_BUCKETS = 64;
+
+//ball speed at the end of a point, in buckets of SPEED_BUCKET_WIDTH pixels per second
+const int SPEED_BUCKET_WIDTH = 50;
+const int SPEED_BUCKETS = 64;
+
+//matches a worker takes from its own range at a time
+const unsigned int TOURNAMENT_CHUNK = 16;
+
+//give up on a match that goes on for longer than this (one hour of game time)
+const int MAX_MATCH_STEPS = 60 * 60 * SIM_HZ;
+
+//keeps data written by different workers on different cache lines
+const int CACHE_LINE = 64;
+
+//Results of a batch of matches
+struct TournamentStats
+{
+    long long matches;
+    long long leftWins, rightWins, unfinished;
+    long long steps;
+    long long points;
+    long long rallies[RALLY_BUCKETS];
+    long long speeds[SPEED_BUCKETS];
+};
+
+void stats_clear(TournamentStats *stats);
+void stats_merge(TournamentStats *into, TournamentStats *from);
+
+int track_ball(Paddle &paddle, Ball &ball);
+void play_match(MatchState *match, unsigned int seed, TournamentStats *stats);
+
+//One thread's share of the tournament. range packs the matches it still
+//has to play as (first << 32 | end), so the owner taking a chunk from the
+//front and a thief splitting off the back half are both a single CAS.
+struct TournamentWorker
+{
+    std::atomic<unsigned long long> range;
+    char rangePad[CACHE_LINE];
+    TournamentStats stats;
+    long long steals;
+    char statsPad[CACHE_LINE];
+};
+
+//Tournament runner - plays bot vs bot matches on every core. Each worker
+//starts with an equal slice of the matches and steals half of another
+//worker's remaining slice when it runs dry. Stats are kept per worker and
+//only merged once every thread has finished, so workers never share a counter.
+class Tournament
+{
+    private:
+        TournamentWorker *workers;
+        int threadCount;
+        unsigned int seed;
+        TournamentStats total;
+        long long steals;
+
+        bool take_chunk(TournamentWorker *worker, unsigned int *first, unsigned int *end);
+        bool steal(int thief);
+        void work(int id);
+    public:
+        Tournament();
+        ~Tournament();
+        void run(unsigned int matches, unsigned int firstSeed, int threads);
+        TournamentStats *get_stats();
+        long long get_steals();
+        int get_threads();
+};
+
+#endif